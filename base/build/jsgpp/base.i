@@ -35,6 +35,10 @@ namespace std {
 %ignore sgpp::base::DataMatrixSP::operator();
 %ignore sgpp::base::DataMatrix::getPointer const;
 %ignore sgpp::base::DataMatrixSP::getPointer const;
+%ignore sgpp::base::DataMatrix::getRowView;
+%ignore sgpp::base::DataMatrix::getColumnView;
+%ignore sgpp::base::DataMatrix::getView;
+%ignore sgpp::base::OperationEval::eval(const DataVector&, const ConstDataVectorView&);
 %include "base/src/sgpp/base/datatypes/DataVectorSP.hpp"
 %include "base/src/sgpp/base/datatypes/DataMatrixSP.hpp"
 %include "base/src/sgpp/base/datatypes/DataVector.hpp"
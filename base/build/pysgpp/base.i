@@ -70,6 +70,7 @@ namespace std {
 %ignore sgpp::base::DataMatrixSP::operator=;
 %ignore sgpp::base::DataMatrixSP::operator[];
 %ignore sgpp::base::DataMatrixSP::toString(std::string& text) const;
+%ignore sgpp::base::OperationEval::eval(const DataVector&, const ConstDataVectorView&);
 %include "base/src/sgpp/base/datatypes/DataMatrixSP.hpp"
 
 // The Good, i.e. without any modifications
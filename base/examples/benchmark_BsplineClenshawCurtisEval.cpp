@@ -0,0 +1,85 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Strong scaling benchmark of the naive multi-evaluation on
+ * modified Clenshaw-Curtis B-spline grids. The 1D basis evaluation is
+ * reentrant, so the speedup should be close to the number of threads.
+ */
+int main() {
+  const size_t dim = 5;
+  const size_t level = 5;
+  const size_t degree = 3;
+  const size_t numberDataPoints = 2000;
+
+  std::unique_ptr<sgpp::base::Grid> grid(
+      sgpp::base::Grid::createModBsplineClenshawCurtisGrid(dim, degree));
+  grid->getGenerator().regular(level);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  sgpp::base::DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = distribution(generator);
+    }
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opMultEval(
+      sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+  sgpp::base::DataVector result(numberDataPoints);
+
+  std::cout << "ModBsplineClenshawCurtis multi-eval benchmark:\n";
+  std::cout << "dim = " << dim << ", level = " << level << ", degree = " << degree
+            << ", grid points = " << grid->getSize() << ", data points = " << numberDataPoints
+            << "\n\n";
+
+#ifdef _OPENMP
+  const int maxThreads = omp_get_max_threads();
+#else
+  const int maxThreads = 1;
+#endif
+  double serialTime = 0.0;
+
+  for (int threads = 1; threads <= maxThreads; threads *= 2) {
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#endif
+    auto begin = std::chrono::high_resolution_clock::now();
+    opMultEval->mult(alpha, result);
+    auto end = std::chrono::high_resolution_clock::now();
+    const double time = std::chrono::duration<double>(end - begin).count();
+
+    if (threads == 1) {
+      serialTime = time;
+    }
+
+    std::cout << "threads = " << threads << ": " << time << "s, speedup = " << serialTime / time
+              << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * Compares loading a grid with its coefficients from the text format
+ * (Grid::unserialize and DataVector::fromFile) and from the
+ * memory-mapped binary format (Grid::unserializeBinary).
+ */
+int main() {
+  const size_t dim = 10;
+  const size_t level = 6;
+  const std::string textGridFile = "benchmark_GridSerialization.grid.txt";
+  const std::string textAlphaFile = "benchmark_GridSerialization.alpha.txt";
+  const std::string binaryFile = "benchmark_GridSerialization.grid.bin";
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  sgpp::base::DataVector alpha(grid->getSize(), 1.0);
+
+  std::cout << "dim = " << dim << ", level = " << level << ", grid points = " << grid->getSize()
+            << "\n";
+
+  {
+    std::ofstream ostr(textGridFile);
+    grid->serialize(ostr);
+  }
+  alpha.toFile(textAlphaFile);
+  grid->serializeBinary(binaryFile, alpha);
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  std::unique_ptr<sgpp::base::Grid> textGrid;
+  {
+    std::ifstream istr(textGridFile);
+    textGrid.reset(sgpp::base::Grid::unserialize(istr));
+  }
+  sgpp::base::DataVector textAlpha = sgpp::base::DataVector::fromFile(textAlphaFile);
+  auto end = std::chrono::high_resolution_clock::now();
+  const double textTime = std::chrono::duration<double>(end - begin).count();
+
+  begin = std::chrono::high_resolution_clock::now();
+  sgpp::base::DataVector binaryAlpha;
+  std::unique_ptr<sgpp::base::Grid> binaryGrid(
+      sgpp::base::Grid::unserializeBinary(binaryFile, binaryAlpha));
+  end = std::chrono::high_resolution_clock::now();
+  const double binaryTime = std::chrono::duration<double>(end - begin).count();
+
+  std::cout << "text format:   " << textTime << "s\n";
+  std::cout << "binary format: " << binaryTime << "s\n";
+  std::cout << "speedup = " << textTime / binaryTime << std::endl;
+
+  if ((binaryGrid->getSize() != textGrid->getSize()) ||
+      (binaryAlpha.getSize() != textAlpha.getSize())) {
+    std::cout << "MISMATCH" << std::endl;
+  }
+
+  std::remove(textGridFile.c_str());
+  std::remove(textAlphaFile.c_str());
+  std::remove(binaryFile.c_str());
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPointMap.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+typedef std::unordered_map<sgpp::base::HashGridPoint*, size_t,
+                           sgpp::base::HashGridPointPointerHashFunctor,
+                           sgpp::base::HashGridPointPointerEqualityFunctor>
+    NodeMap;
+
+/**
+ * Looks up all query points in the given map and returns the sum of the sequence numbers
+ * (to prevent the compiler from optimizing the lookups away).
+ */
+template <class MAP>
+size_t lookup(const MAP& map, std::vector<sgpp::base::HashGridPoint>& queries) {
+  size_t sum = 0;
+
+  for (sgpp::base::HashGridPoint& query : queries) {
+    typename MAP::const_iterator it = map.find(&query);
+
+    if (it != map.end()) {
+      sum += it->second;
+    }
+  }
+
+  return sum;
+}
+
+/**
+ * Looks up all query points in the storage (comparing with its packed levels and indices)
+ * and returns the sum of the sequence numbers.
+ */
+size_t lookup(sgpp::base::HashGridStorage& storage,
+              std::vector<sgpp::base::HashGridPoint>& queries) {
+  size_t sum = 0;
+
+  for (sgpp::base::HashGridPoint& query : queries) {
+    const size_t seq = storage.getSequenceNumber(query);
+
+    if (!storage.isInvalidSequenceNumber(seq)) {
+      sum += seq;
+    }
+  }
+
+  return sum;
+}
+
+/**
+ * Memory and lookup benchmark of the flat open-addressing HashGridPointMap used by
+ * HashGridStorage compared to the node-based std::unordered_map used previously.
+ * The storage itself compares the candidates with its packed levels and indices
+ * instead of dereferencing the grid points.
+ * Half of the queries are grid points, the other half are children of leaves
+ * (i.e., unsuccessful lookups as in refinement or sweeps at the boundary of the grid).
+ */
+int main() {
+  const size_t dims[] = {2, 5, 10, 20};
+  const size_t levels[] = {16, 9, 7, 5};
+  const size_t numberOfRuns = 5;
+
+  std::mt19937 generator(42);
+
+  for (size_t k = 0; k < sizeof(dims) / sizeof(dims[0]); k++) {
+    const size_t dim = dims[k];
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(levels[k]);
+    sgpp::base::HashGridStorage& storage = grid->getStorage();
+    const size_t size = storage.getSize();
+
+    // both maps index the grid points of the storage
+    sgpp::base::HashGridPointMap flatMap;
+    NodeMap nodeMap;
+
+    for (size_t seq = 0; seq < size; seq++) {
+      flatMap[&storage.getPoint(seq)] = seq;
+      nodeMap[&storage.getPoint(seq)] = seq;
+    }
+
+    std::vector<sgpp::base::HashGridPoint> queries;
+    std::uniform_int_distribution<size_t> seqDistribution(0, size - 1);
+    std::uniform_int_distribution<size_t> dimDistribution(0, dim - 1);
+
+    for (size_t q = 0; q < 1000000; q++) {
+      queries.push_back(storage.getPoint(seqDistribution(generator)));
+
+      if (q % 2 == 1) {
+        queries.back().getLeftChild(dimDistribution(generator));
+      }
+    }
+
+    // memory of the maps (std::unordered_map: one node per entry plus one pointer per bucket;
+    // nodes contain next pointer, key, value and cached hash plus allocator overhead)
+    const size_t nodeBytes = nodeMap.size() * (4 * sizeof(size_t) + 16) +
+                             nodeMap.bucket_count() * sizeof(void*);
+    const size_t flatBytes = flatMap.capacity() * 3 * sizeof(size_t);
+    // memory of one grid point (object, one allocation for level/index plus overhead)
+    const size_t pointBytes = sizeof(sgpp::base::HashGridPoint) + 16 +
+                              2 * dim * sizeof(sgpp::base::HashGridPoint::level_type) + 16;
+    // memory of the packed levels and indices of one grid point
+    const size_t packedBytes = dim * (sizeof(sgpp::base::HashGridStorage::packed_level_type) +
+                                      sizeof(sgpp::base::HashGridPoint::index_type));
+
+    double nodeTime = 1e100, flatTime = 1e100, packedTime = 1e100;
+    size_t nodeSum = 0, flatSum = 0, packedSum = 0;
+
+    for (size_t run = 0; run < numberOfRuns; run++) {
+      auto begin = std::chrono::high_resolution_clock::now();
+      nodeSum = lookup(nodeMap, queries);
+      auto end = std::chrono::high_resolution_clock::now();
+      nodeTime = std::min(nodeTime, std::chrono::duration<double>(end - begin).count());
+
+      begin = std::chrono::high_resolution_clock::now();
+      flatSum = lookup(flatMap, queries);
+      end = std::chrono::high_resolution_clock::now();
+      flatTime = std::min(flatTime, std::chrono::duration<double>(end - begin).count());
+
+      begin = std::chrono::high_resolution_clock::now();
+      packedSum = lookup(storage, queries);
+      end = std::chrono::high_resolution_clock::now();
+      packedTime = std::min(packedTime, std::chrono::duration<double>(end - begin).count());
+    }
+
+    std::cout << "dim = " << dim << ", level = " << levels[k] << ", grid points = " << size
+              << "\n";
+    std::cout << "  grid points:        " << static_cast<double>(size * pointBytes) / 1048576.0
+              << " MiB\n";
+    std::cout << "  packed levels/indices: " << static_cast<double>(size * packedBytes) / 1048576.0
+              << " MiB\n";
+    std::cout << "  std::unordered_map: " << static_cast<double>(nodeBytes) / 1048576.0
+              << " MiB, " << queries.size() << " lookups in " << nodeTime << "s\n";
+    std::cout << "  HashGridPointMap:   " << static_cast<double>(flatBytes) / 1048576.0
+              << " MiB, " << queries.size() << " lookups in " << flatTime << "s"
+              << ((nodeSum == flatSum) ? "" : " (MISMATCH)") << "\n";
+    std::cout << "  HashGridStorage:    " << queries.size() << " lookups in " << packedTime << "s"
+              << ((nodeSum == packedSum) ? "" : " (MISMATCH)") << "\n";
+    std::cout << "  speedup = " << nodeTime / flatTime << " (map), " << nodeTime / packedTime
+              << " (storage)" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Benchmark of the (parallel) sweep-based hierarchisation and dehierarchisation
+ * on regular linear grids of dimensionality 5 to 20.
+ */
+int main() {
+  const size_t dims[] = {5, 10, 15, 20};
+  const size_t levels[] = {7, 5, 4, 4};
+
+#ifdef _OPENMP
+  const int maxThreads = omp_get_max_threads();
+#else
+  const int maxThreads = 1;
+#endif
+
+  std::cout << "hierarchisation benchmark (linear grids):\n\n";
+
+  for (size_t k = 0; k < sizeof(dims) / sizeof(dims[0]); k++) {
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dims[k]));
+    grid->getGenerator().regular(levels[k]);
+
+    std::unique_ptr<sgpp::base::OperationHierarchisation> opHier(
+        sgpp::op_factory::createOperationHierarchisation(*grid));
+    sgpp::base::DataVector alpha(grid->getSize());
+
+    std::cout << "dim = " << dims[k] << ", level = " << levels[k]
+              << ", grid points = " << grid->getSize() << "\n";
+
+    double serialTime = 0.0;
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+#ifdef _OPENMP
+      omp_set_num_threads(threads);
+#endif
+      alpha.setAll(1.0);
+
+      auto begin = std::chrono::high_resolution_clock::now();
+      opHier->doHierarchisation(alpha);
+      opHier->doDehierarchisation(alpha);
+      auto end = std::chrono::high_resolution_clock::now();
+      const double time = std::chrono::duration<double>(end - begin).count();
+
+      if (threads == 1) {
+        serialTime = time;
+      }
+
+      std::cout << "  threads = " << threads << ": " << time
+                << "s, speedup = " << serialTime / time << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Strong scaling benchmark of the transposed multi-evaluation (B^T) on linear grids,
+ * as used in every CG iteration of a least squares regression. The per-thread partial
+ * results are reduced in parallel and the scratch vectors are reused between calls.
+ */
+int main() {
+  const size_t dim = 6;
+  const size_t level = 6;
+  const size_t numberDataPoints = 10000;
+  const size_t numberOfCalls = 5;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+  sgpp::base::DataVector source(numberDataPoints);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = distribution(generator);
+    }
+
+    source[i] = distribution(generator);
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opMultEval(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  sgpp::base::DataVector result(grid->getSize());
+
+  std::cout << "transposed multi-eval benchmark (linear grid):\n";
+  std::cout << "dim = " << dim << ", level = " << level << ", grid points = " << grid->getSize()
+            << ", data points = " << numberDataPoints << "\n\n";
+
+#ifdef _OPENMP
+  const int maxThreads = omp_get_max_threads();
+#else
+  const int maxThreads = 1;
+#endif
+  double serialTime = 0.0;
+
+  for (int threads = 1; threads <= maxThreads; threads *= 2) {
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#endif
+    auto begin = std::chrono::high_resolution_clock::now();
+
+    for (size_t call = 0; call < numberOfCalls; call++) {
+      opMultEval->multTranspose(source, result);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    const double time = std::chrono::duration<double>(end - begin).count() /
+                        static_cast<double>(numberOfCalls);
+
+    if (threads == 1) {
+      serialTime = time;
+    }
+
+    std::cout << "threads = " << threads << ": " << time << "s per call, speedup = "
+              << serialTime / time << std::endl;
+  }
+
+  return 0;
+}
@@ -17,6 +17,9 @@
 #include <vector>
 #include <utility>
 #include <iostream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 namespace sgpp {
@@ -28,6 +31,9 @@ namespace base {
  * @f[ (B)_{i,j} = \varphi_i(x_j). @f]
  * (The common known name for this operation is the BLAS routine DGEMV.)
  *
+ * The transposed multiplication accumulates into per-thread scratch vectors, which are
+ * kept in the object and reused by subsequent calls (e.g., in every CG iteration),
+ * so they should be reused by keeping the object alive.
  */
 template<class BASIS>
 class AlgorithmDGEMV {
@@ -35,7 +41,10 @@ class AlgorithmDGEMV {
   /**
    * Performs the DGEMV Operation on the grid
    *
-   * This operation can be executed in parallel by setting the USEOMP define
+   * This operation can be executed in parallel by setting the USEOMP define.
+   * The data points are distributed among the threads, each of which accumulates into
+   * its own scratch vector. Afterwards, the scratch vectors are summed up in parallel,
+   * with each thread reducing a contiguous range of grid points.
    *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
@@ -47,18 +56,32 @@ class AlgorithmDGEMV {
                        const DataVector& source, DataMatrix& x, DataVector& result) {
     typedef std::vector<std::pair<size_t, double> > IndexValVector;
 
-    result.setAll(0.0);
+    const size_t source_size = source.getSize();
+    const size_t result_size = result.getSize();
 
     #pragma omp parallel
     {
-      size_t source_size = source.getSize();
-      DataVector privateResult(result);
+      #pragma omp single
+      {
+#ifdef _OPENMP
+        scratch.resize(omp_get_num_threads());
+#else
+        scratch.resize(1);
+#endif
+      }
+
+#ifdef _OPENMP
+      std::vector<double>& privateResult = scratch[omp_get_thread_num()];
+#else
+      std::vector<double>& privateResult = scratch[0];
+#endif
+      // no reallocation if the size of the grid did not grow since the last call
+      privateResult.assign(result_size, 0.0);
+
       DataVector line(x.getNcols());
       IndexValVector vec;
       GetAffectedBasisFunctions<BASIS> ga(storage);
 
-      privateResult.setAll(0.0);
-
       #pragma omp for schedule(static)
 
       for (size_t i = 0; i < source_size; i++) {
@@ -73,9 +96,19 @@ class AlgorithmDGEMV {
         }
       }
 
-      #pragma omp critical
-      {
-        result.add(privateResult);
+      // implicit barrier, all contributions are available now
+      const size_t numberOfThreads = scratch.size();
+
+      #pragma omp for schedule(static)
+
+      for (size_t j = 0; j < result_size; j++) {
+        double sum = scratch[0][j];
+
+        for (size_t k = 1; k < numberOfThreads; k++) {
+          sum += scratch[k][j];
+        }
+
+        result[j] = sum;
       }
     }
   }
@@ -157,6 +190,10 @@ class AlgorithmDGEMV {
       }
     }
   }
+
+ protected:
+  /// per-thread accumulation vectors of the transposed multiplication
+  std::vector<std::vector<double>> scratch;
 };
 
 }  // namespace base
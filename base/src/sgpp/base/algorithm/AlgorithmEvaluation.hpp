@@ -14,6 +14,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <utility>
+#include <vector>
 
 
 namespace sgpp {
@@ -52,7 +53,8 @@ template<class BASIS>
 class AlgorithmEvaluation {
  public:
   explicit AlgorithmEvaluation(GridStorage& storage) :
-    storage(storage) {
+    storage(storage), working(storage), newPoint(storage.getDimension()),
+    sourceIndex(storage.getDimension()) {
   }
 
   ~AlgorithmEvaluation() {
@@ -66,20 +68,20 @@ class AlgorithmEvaluation {
    * \f[ \sum_{r\in\mathbf{result}} \alpha[r\rightarrow\mathbf{first}] \cdot r\rightarrow\mathbf{second}. \f]
    *
    * @param basis a sparse grid basis
-   * @param point evaluation point within the domain
-   * @param alpha the sparse grid's coefficients
+   * @param point evaluation point within the domain (DataVector or a view of the
+   *        coordinates, e.g., a ConstDataVectorView of a row of a DataMatrix)
+   * @param alpha the sparse grid's coefficients (DataVector or DataVectorSP,
+   *        the evaluation is always done in double precision)
    *
    * @result result result of the function evaluation
    */
-  double operator()(BASIS& basis, const DataVector& point, const DataVector& alpha) {
-    GridStorage::grid_iterator working(storage);
-
+  template <class POINT, class VECTOR>
+  double operator()(BASIS& basis, const POINT& point, const VECTOR& alpha) {
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
     const size_t dim = storage.getDimension();
 
     // Check for bounding box
     BoundingBox* bb = storage.getBoundingBox();
-    DataVector newPoint(dim);
 
     for (size_t d = 0; d < dim; d++) {
       if (!bb->isContainingPoint(d, point[d])) {
@@ -89,7 +91,7 @@ class AlgorithmEvaluation {
       newPoint[d] = bb->transformPointToUnitCube(d, point[d]);
     }
 
-    index_t* source = new index_t[dim];
+    index_t* source = sourceIndex.data();
 
     for (size_t d = 0; d < dim; d++) {
       // This does not really work on grids with borders.
@@ -103,14 +105,20 @@ class AlgorithmEvaluation {
     }
 
     double result = 0.0;
+    working.resetToLevelOne();
     rec(basis, newPoint, 0, 1.0, working, source, alpha, result);
-    delete[] source;
 
     return result;
   }
 
  protected:
   GridStorage& storage;
+  /// iterator for the traversal (kept to avoid allocations for every evaluation)
+  GridStorage::grid_iterator working;
+  /// evaluation point transformed to the unit cube
+  DataVector newPoint;
+  /// indices of the evaluation point on the finest level
+  std::vector<index_t> sourceIndex;
 
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
@@ -126,9 +134,10 @@ class AlgorithmEvaluation {
    * @param alpha the spars grid's ansatzfunctions coefficients
    * @param result reference to a double into which the result should be stored
    */
+  template <class VECTOR>
   void rec(BASIS& basis, const DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
-           index_t* source, const DataVector& alpha,
+           index_t* source, const VECTOR& alpha,
            double& result) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
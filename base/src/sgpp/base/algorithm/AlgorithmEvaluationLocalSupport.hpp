@@ -0,0 +1,228 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMEVALUATIONLOCALSUPPORT_HPP
+#define ALGORITHMEVALUATIONLOCALSUPPORT_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Evaluation of sparse grid functions by a hierarchical descent,
+ * generalizing AlgorithmEvaluation to bases whose supports overlap within a level
+ * (e.g., B-splines of higher degree or polynomial bases).
+ *
+ * The algorithm descends recursively in the dimension and the level.
+ * In every dimension, it starts at level 1 and only visits the children of
+ * basis functions that are non-zero at the evaluation point and whose grid point exists.
+ * The remaining dimensions are kept at level 1 during the descent.
+ * Therefore, only the grid points whose basis functions are non-zero at the
+ * evaluation point (plus one layer of children) are visited instead of all grid points.
+ *
+ * This requires that
+ * - the grid has no boundary points and contains all hierarchical ancestors of its points
+ *   (which holds for grids generated by the grid generators, see isApplicable) and
+ * - the 1D basis functions do not vanish in the interior of their support and the support of
+ *   each basis function contains the supports of its hierarchical descendants
+ *   (which holds for B-splines, modified B-splines, polynomial and modified polynomial bases,
+ *   but not for bases with global support like fundamental splines).
+ */
+template <class BASIS>
+class AlgorithmEvaluationLocalSupport {
+ public:
+  /**
+   * @param storage   storage of the sparse grid
+   */
+  explicit AlgorithmEvaluationLocalSupport(GridStorage& storage)
+      : storage(storage),
+        working(storage.getDimension()),
+        checked(false),
+        checkedModificationCount(0),
+        applicable(false) {}
+
+  ~AlgorithmEvaluationLocalSupport() {}
+
+  /**
+   * Checks whether the grid has no boundary points and contains all hierarchical parents
+   * of its points. The result is cached until grid points are added, removed or replaced
+   * (see GridStorage::getModificationCount).
+   * If the check fails, callers should fall back to evaluating all basis functions.
+   *
+   * @return  whether the hierarchical descent can be used for the grid
+   */
+  bool isApplicable() {
+    if (checked && (storage.getModificationCount() == checkedModificationCount)) {
+      return applicable;
+    }
+
+    const size_t dim = storage.getDimension();
+    const size_t gridSize = storage.getSize();
+    checked = true;
+    checkedModificationCount = storage.getModificationCount();
+    applicable = true;
+
+    for (size_t k = 0; (k < gridSize) && applicable; k++) {
+      working = storage.getPoint(k);
+
+      for (size_t t = 0; t < dim; t++) {
+        const level_t l = working.getLevel(t);
+        const index_t i = working.getIndex(t);
+
+        if (l == 0) {
+          applicable = false;
+          break;
+        } else if (l > 1) {
+          working.set(t, l - 1, (i >> 1) | 1);
+
+          if (!storage.isContaining(working)) {
+            applicable = false;
+            break;
+          }
+
+          working.set(t, l, i);
+        }
+      }
+    }
+
+    return applicable;
+  }
+
+  /**
+   * @param basis     1D basis of the grid
+   * @param point     evaluation point in the unit cube
+   * @param alpha     coefficient vector
+   * @return          value of the linear combination
+   */
+  double operator()(BASIS& basis, const DataVector& point, const DataVector& alpha) {
+    double result = 0.0;
+    descend(basis, point, [&alpha, &result](size_t seq, double value) {
+      result += alpha[seq] * value;
+    });
+    return result;
+  }
+
+  /**
+   * @param      basis  1D basis of the grid
+   * @param      point  evaluation point in the unit cube
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param[out] value  values of the linear combinations
+   */
+  void operator()(BASIS& basis, const DataVector& point, const DataMatrix& alpha,
+                  DataVector& value) {
+    const size_t m = alpha.getNcols();
+
+    value.resize(m);
+    value.setAll(0.0);
+
+    descend(basis, point, [&alpha, &value, m](size_t seq, double basisValue) {
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(seq, j) * basisValue;
+      }
+    });
+  }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// grid point which is currently visited
+  GridPoint working;
+  /// whether isApplicable was called before
+  bool checked;
+  /// modification count of the storage when isApplicable was called the last time
+  size_t checkedModificationCount;
+  /// result of the last call of isApplicable
+  bool applicable;
+
+  /**
+   * Calls accumulate(seq, value) for all grid points with non-zero basis function values.
+   *
+   * @param basis       1D basis of the grid
+   * @param point       evaluation point in the unit cube
+   * @param accumulate  functor called with the sequence number and the basis function value
+   */
+  template <class ACCUMULATOR>
+  void descend(BASIS& basis, const DataVector& point, ACCUMULATOR accumulate) {
+    const size_t dim = storage.getDimension();
+
+    if ((storage.getSize() == 0) || (dim == 0)) {
+      return;
+    }
+
+    for (size_t t = 0; t < dim; t++) {
+      working.push(t, 1, 1);
+    }
+
+    recDimension(basis, point, 0, 1.0, accumulate);
+  }
+
+  /**
+   * Descends in dimension t, starting with the root at level 1.
+   *
+   * @param basis       1D basis of the grid
+   * @param point       evaluation point in the unit cube
+   * @param t           current dimension
+   * @param value       product of the 1D values of the dimensions before t
+   * @param accumulate  functor called with the sequence number and the basis function value
+   */
+  template <class ACCUMULATOR>
+  void recDimension(BASIS& basis, const DataVector& point, size_t t, double value,
+                    ACCUMULATOR& accumulate) {
+    recLevel(basis, point, t, 1, 1, value, accumulate);
+    // restore the root for the descents in the previous dimensions
+    working.push(t, 1, 1);
+  }
+
+  /**
+   * Visits the 1D basis function with level l and index i in dimension t and its descendants.
+   *
+   * @param basis       1D basis of the grid
+   * @param point       evaluation point in the unit cube
+   * @param t           current dimension
+   * @param l           level in dimension t
+   * @param i           index in dimension t
+   * @param value       product of the 1D values of the dimensions before t
+   * @param accumulate  functor called with the sequence number and the basis function value
+   */
+  template <class ACCUMULATOR>
+  void recLevel(BASIS& basis, const DataVector& point, size_t t, level_t l, index_t i,
+                double value, ACCUMULATOR& accumulate) {
+    working.set(t, l, i);
+    const size_t seq = storage.getSequenceNumber(working);
+
+    if (storage.isInvalidSequenceNumber(seq)) {
+      // no grid point with this level and index in dimension t (and no descendants)
+      return;
+    }
+
+    const double value1d = basis.eval(l, i, point[t]);
+
+    if (value1d == 0.0) {
+      // the descendants vanish at the point, too
+      return;
+    }
+
+    if (t == storage.getDimension() - 1) {
+      accumulate(seq, value * value1d);
+    } else {
+      recDimension(basis, point, t + 1, value * value1d, accumulate);
+    }
+
+    recLevel(basis, point, t, l + 1, 2 * i - 1, value, accumulate);
+    recLevel(basis, point, t, l + 1, 2 * i + 1, value, accumulate);
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMEVALUATIONLOCALSUPPORT_HPP */
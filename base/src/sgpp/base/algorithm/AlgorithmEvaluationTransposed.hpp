@@ -12,7 +12,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 
 namespace sgpp {
@@ -27,7 +29,8 @@ template<class BASIS>
 class AlgorithmEvaluationTransposed {
  public:
   explicit AlgorithmEvaluationTransposed(GridStorage& storage) :
-    storage(storage) {
+    storage(storage), working(storage), newPoint(storage.getDimension()),
+    sourceIndex(storage.getDimension()) {
   }
 
   ~AlgorithmEvaluationTransposed() {
@@ -41,19 +44,19 @@ class AlgorithmEvaluationTransposed {
    * \f[ \sum_{r\in\mathbf{result}} \alpha[r\rightarrow\mathbf{first}] \cdot r\rightarrow\mathbf{second}. \f]
    *
    * @param basis a sparse grid basis
-   * @param point evaluation point within the domain
+   * @param point evaluation point within the domain (DataVector or a view of the
+   *        coordinates, e.g., a ConstDataVectorView of a row of a DataMatrix)
    * @param alpha the coefficient of the regarded ansatzfunction
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
+   *        (DataVector or DataVectorSP)
    */
-  void operator()(BASIS& basis, const DataVector& point, double alpha, DataVector& result) {
-    GridStorage::grid_iterator working(storage);
-
+  template <class POINT, class VECTOR>
+  void operator()(BASIS& basis, const POINT& point, double alpha, VECTOR& result) {
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
     const size_t dim = storage.getDimension();
 
     // Check for bounding box
     BoundingBox* bb = storage.getBoundingBox();
-    DataVector newPoint(dim);
 
     for (size_t d = 0; d < dim; d++) {
       if (!bb->isContainingPoint(d, point[d])) {
@@ -63,7 +66,7 @@ class AlgorithmEvaluationTransposed {
       newPoint[d] = bb->transformPointToUnitCube(d, point[d]);
     }
 
-    index_t* source = new index_t[dim];
+    index_t* source = sourceIndex.data();
 
     for (size_t d = 0; d < dim; d++) {
       // This does not really work on grids with borders.
@@ -76,12 +79,18 @@ class AlgorithmEvaluationTransposed {
       }
     }
 
+    working.resetToLevelOne();
     rec(basis, newPoint, 0, 1.0, working, source, alpha, result);
-    delete[] source;
   }
 
  protected:
   GridStorage& storage;
+  /// iterator for the traversal (kept to avoid allocations for every evaluation)
+  GridStorage::grid_iterator working;
+  /// evaluation point transformed to the unit cube
+  DataVector newPoint;
+  /// indices of the evaluation point on the finest level
+  std::vector<index_t> sourceIndex;
 
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
@@ -96,11 +105,13 @@ class AlgorithmEvaluationTransposed {
    * @param source array of indices for each dimension (identifying the indices of the current grid point)
    * @param alpha the coefficient of current ansatzfunction
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
+   *        (DataVector or DataVectorSP)
    */
+  template <class VECTOR>
   void rec(BASIS& basis, DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
            index_t* source, double alpha,
-           DataVector& result) {
+           VECTOR& result) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -125,7 +136,9 @@ class AlgorithmEvaluationTransposed {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result[seq] += alpha * new_value;
+          // accumulate in the precision of the result vector
+          typedef typename std::remove_reference<decltype(result[seq])>::type value_type;
+          result[seq] += static_cast<value_type>(alpha * new_value);
         } else {
           rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
           if (!hint) working.resetToLevelOne(current_dim+1);
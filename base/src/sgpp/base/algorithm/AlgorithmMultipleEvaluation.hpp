@@ -8,15 +8,23 @@
 
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorSP.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixSP.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
 
 #include <sgpp/globaldef.hpp>
 
-#include <utility>
 #include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 namespace sgpp {
@@ -31,6 +39,9 @@ namespace base {
  * If there are @f$N@f$ basis functions @f$\varphi(\vec{x})@f$ and @f$m@f$ data points, then B is a (mxN) matrix, with
  * @f[ (B)_{j,i} = \varphi_i(x_j). @f]
  *
+ * The transposed evaluation accumulates into per-thread scratch vectors, which are
+ * kept in the object and reused by subsequent calls (e.g., in every CG iteration),
+ * so they should be reused by keeping the object alive.
  */
 template<class BASIS>
 class AlgorithmMultipleEvaluation {
@@ -46,86 +57,158 @@ class AlgorithmMultipleEvaluation {
    */
   void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source,
                       DataMatrix& x, DataVector& result) {
+    transposedEvaluation(storage, basis, source, x, result, doubleScratch);
+  }
+
+  /**
+   * Performs a mass evaluation
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   */
+  void mult(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
+            DataVector& result) {
     result.setAll(0.0);
-    size_t source_size = source.getSize();
+    size_t result_size = result.getSize();
+
 
     #pragma omp parallel
     {
-      DataVector privateResult(result.getSize());
-      privateResult.setAll(0.0);
+      AlgorithmEvaluation<BASIS> AlgoEval(storage);
 
-      DataVector line(x.getNcols());
-      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+      #pragma omp for schedule(static)
 
-      privateResult.setAll(0.0);
+      for (size_t i = 0; i < result_size; i++) {
+        result[i] = AlgoEval(basis, x.getRowView(i), source);
+      }
+    }
+  }
 
+  /**
+   * Performs a transposed mass evaluation on single precision data.
+   * The basis functions are evaluated in double precision, the contributions
+   * of the data points are accumulated in ACCUMULATOR, i.e., float for pure single
+   * precision or double for mixed precision (single precision storage,
+   * double precision accumulation).
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   */
+  template <class ACCUMULATOR>
+  void mult_transpose(GridStorage& storage, BASIS& basis, DataVectorSP& source,
+                      DataMatrixSP& x, DataVectorSP& result) {
+    transposedEvaluation(storage, basis, source, x, result, getScratch(ACCUMULATOR()));
+  }
 
-      #pragma omp for schedule(static)
+  /**
+   * Performs a mass evaluation on single precision data.
+   * The function values are evaluated and summed up in double precision
+   * and rounded to single precision afterwards.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   */
+  void mult(GridStorage& storage, BASIS& basis, DataVectorSP& source, DataMatrixSP& x,
+            DataVectorSP& result) {
+    result.setAll(0.0f);
+    const size_t result_size = result.getSize();
+    const size_t dim = x.getNcols();
 
-      for (size_t i = 0; i < source_size; i++) {
-        x.getRow(i, line);
+    #pragma omp parallel
+    {
+      AlgorithmEvaluation<BASIS> AlgoEval(storage);
 
-        AlgoEvalTrans(basis, line, source[i], privateResult);
-      }
+      #pragma omp for schedule(static)
 
-      #pragma omp critical
-      {
-        result.add(privateResult);
+      for (size_t i = 0; i < result_size; i++) {
+        const ConstDataVectorViewSP line(x.getPointer() + i * dim, dim);
+        result[i] = static_cast<float>(AlgoEval(basis, line, source));
       }
     }
   }
-  // implementation requires OpenMP 4.0 support
-  //        void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source,
-  //                            DataMatrix& x, DataVector& result) {
-  //          result.setAll(0.0);
-  //          size_t source_size = source.getSize();
-  //
-  //          #pragma omp declare reduction(accumulate :
-  // ...      sgpp::base::DataVector : omp_out.add(omp_in))
-  // ...      initializer ( omp_priv = DataVector(omp_orig.getSize(), 0))
-  //
-  //          #pragma omp parallel
-  //          {
-  //            DataVector line(x.getNcols());
-  //            AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
-  //
-  //            #pragma omp for reduction(accumulate:result) schedule(static)
-  //
-  //            for (size_t i = 0; i < source_size; i++) {
-  //              x.getRow(i, line);
-  //
-  //              AlgoEvalTrans(basis, line, source[i], result);
-  //            }
-  //          }
-  //        }
 
+ protected:
+  /// per-thread accumulation vectors of the transposed evaluation (double precision)
+  std::vector<std::vector<double>> doubleScratch;
+  /// per-thread accumulation vectors of the transposed evaluation (single precision)
+  std::vector<std::vector<float>> floatScratch;
+
+  std::vector<std::vector<double>>& getScratch(double) { return doubleScratch; }
+  std::vector<std::vector<float>>& getScratch(float) { return floatScratch; }
 
   /**
-   * Performs a mass evaluation
+   * Transposed mass evaluation. The data points are distributed among the threads,
+   * each of which accumulates into its own scratch vector. Afterwards, the scratch
+   * vectors are summed up in parallel, with each thread reducing a contiguous range
+   * of grid points (instead of merging whole vectors one after another in a
+   * critical section).
    *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
-   * @param source the coefficients of the grid points
+   * @param source the coefficients of the data points
    * @param x the d-dimensional vector with data points (row-wise)
    * @param result the result vector of the matrix vector multiplication
+   * @param scratch per-thread accumulation vectors, resized if necessary
    */
-  void mult(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
-            DataVector& result) {
-    result.setAll(0.0);
-    size_t result_size = result.getSize();
-
+  template <class T, class VECTOR, class MATRIX>
+  void transposedEvaluation(GridStorage& storage, BASIS& basis, VECTOR& source, MATRIX& x,
+                            VECTOR& result, std::vector<std::vector<T>>& scratch) {
+    typedef typename std::remove_reference<decltype(result[0])>::type value_type;
+    const size_t source_size = source.getSize();
+    const size_t result_size = result.getSize();
+    const size_t dim = x.getNcols();
 
     #pragma omp parallel
     {
-      DataVector line(x.getNcols());
-      AlgorithmEvaluation<BASIS> AlgoEval(storage);
+      #pragma omp single
+      {
+#ifdef _OPENMP
+        scratch.resize(omp_get_num_threads());
+#else
+        scratch.resize(1);
+#endif
+      }
+
+#ifdef _OPENMP
+      std::vector<T>& privateResult = scratch[omp_get_thread_num()];
+#else
+      std::vector<T>& privateResult = scratch[0];
+#endif
+      // no reallocation if the size of the grid did not grow since the last call
+      privateResult.assign(result_size, T(0));
+
+      const auto* points = x.getPointer();
+      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
 
       #pragma omp for schedule(static)
 
-      for (size_t i = 0; i < result_size; i++) {
-        x.getRow(i, line);
+      for (size_t i = 0; i < source_size; i++) {
+        const BasicDataVectorView<const value_type> line(points + i * dim, dim);
+        AlgoEvalTrans(basis, line, source[i], privateResult);
+      }
+
+      // implicit barrier, all contributions are available now
+      const size_t numberOfThreads = scratch.size();
+
+      #pragma omp for schedule(static)
+
+      for (size_t j = 0; j < result_size; j++) {
+        T sum = scratch[0][j];
+
+        for (size_t k = 1; k < numberOfThreads; k++) {
+          sum += scratch[k][j];
+        }
 
-        result[i] = AlgoEval(basis, line, source);
+        result[j] = static_cast<value_type>(sum);
       }
     }
   }
@@ -14,6 +14,9 @@
 #include <vector>
 #include <utility>
 #include <iostream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 namespace sgpp {
@@ -24,6 +27,12 @@ namespace base {
  * FUNC should be a class with overwritten operator(). For an example see laplace_up_functor in laplace.hpp.
  * It must be default constructable or copyable.
  * STORAGE must provide a grid_iterator supporting left_child, step_right, up, hint and seq.
+ *
+ * The *_Parallel variants first collect the roots of all 1D poles in the
+ * sweep dimension and then process the poles concurrently with dynamic
+ * scheduling. Each thread works on its own copy of the functor, so FUNC has
+ * to be copyable and must only modify the entries of the pole it has been
+ * called for (this holds for all hierarchisation functors).
  */
 template<class FUNC>
 class sweep {
@@ -38,6 +47,8 @@ class sweep {
   const std::vector<size_t> algoDims;
   /// number of algorithmic dimensions
   const size_t numAlgoDims_;
+  /// minimal number of poles for which the parallel sweeps spawn threads
+  static const size_t MIN_POLES_PARALLEL = 64;
 
  public:
   /**
@@ -172,7 +183,202 @@ class sweep {
                        dim_sweep);
   }
 
+  /**
+   * Parallel version of sweep1D(DataVector&, DataVector&, size_t).
+   * The independent 1D poles in dimension dim_sweep are distributed
+   * among the OpenMP threads.
+   * Boundaries are not regarded
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_Parallel(DataVector& source, DataVector& result, size_t dim_sweep) {
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+    std::vector<size_t> poles;
+
+    collect_rec(source, result, index, dim_list, storage.getDimension() - 1, dim_sweep, poles);
+    sweep_poles(source, result, poles, dim_sweep);
+  }
+
+  /**
+   * Parallel version of sweep1D_Boundary(DataVector&, DataVector&, size_t).
+   * The independent 1D poles in dimension dim_sweep are distributed
+   * among the OpenMP threads.
+   * Boundaries are regarded
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_Boundary_Parallel(DataVector& source, DataVector& result, size_t dim_sweep) {
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+    index.resetToLevelZero();
+    std::vector<size_t> poles;
+
+    collect_Boundary_rec(source, result, index, dim_list, storage.getDimension() - 1,
+                         dim_sweep, poles);
+    sweep_poles(source, result, poles, dim_sweep);
+  }
+
  protected:
+  /**
+   * Applies the functor to the given poles in parallel.
+   *
+   * @param source coefficients of the sparse grid
+   * @param result coefficients of the function computed by sweep
+   * @param poles sequence numbers of the roots of the poles
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   */
+  template <class DataType>
+  void sweep_poles(DataType& source, DataType& result, const std::vector<size_t>& poles,
+                   size_t dim_sweep) {
+    const size_t numPoles = poles.size();
+
+#pragma omp parallel if (numPoles >= MIN_POLES_PARALLEL)
+    {
+      FUNC threadFunctor(functor);
+      grid_iterator index(storage);
+
+#pragma omp for schedule(dynamic)
+      for (size_t k = 0; k < numPoles; k++) {
+        index.set(storage.getPoint(poles[k]));
+        threadFunctor(source, result, index, dim_sweep);
+      }
+    }
+  }
+
+  /**
+   * Collects the roots of all poles in dimension dim_sweep, traversing the
+   * grid in the same way as sweep_rec. Poles whose roots are not contained
+   * in the grid are handled directly.
+   *
+   * @param source coefficients of the sparse grid
+   * @param result coefficients of the function computed by sweep
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   * @param poles sequence numbers of the roots of the poles (output)
+   */
+  template <class DataType>
+  void collect_rec(DataType& source, DataType& result, grid_iterator& index,
+                   std::vector<size_t>& dim_list, size_t dim_rem, size_t dim_sweep,
+                   std::vector<size_t>& poles) {
+    if (storage.isInvalidSequenceNumber(index.seq())) {
+      functor(source, result, index, dim_sweep);
+    } else {
+      poles.push_back(index.seq());
+    }
+
+    // dimension recursion unrolled
+    for (size_t d = 0; d < dim_rem; d++) {
+      size_t current_dim = dim_list[d];
+
+      if (index.hint()) {
+        continue;
+      }
+
+      index.leftChild(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collect_rec(source, result, index, dim_list, d + 1, dim_sweep, poles);
+      }
+
+      index.stepRight(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collect_rec(source, result, index, dim_list, d + 1, dim_sweep, poles);
+      }
+
+      index.up(current_dim);
+    }
+  }
+
+  /**
+   * Collects the roots of all poles in dimension dim_sweep, traversing the
+   * grid in the same way as sweep_Boundary_rec. Poles whose roots are not
+   * contained in the grid are handled directly.
+   *
+   * @param source coefficients of the sparse grid
+   * @param result coefficients of the function computed by sweep
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   * @param poles sequence numbers of the roots of the poles (output)
+   */
+  template <class DataType>
+  void collect_Boundary_rec(DataType& source, DataType& result, grid_iterator& index,
+                            std::vector<size_t>& dim_list, size_t dim_rem, size_t dim_sweep,
+                            std::vector<size_t>& poles) {
+    if (dim_rem == 0) {
+      if (storage.isInvalidSequenceNumber(index.seq())) {
+        functor(source, result, index, dim_sweep);
+      } else {
+        poles.push_back(index.seq());
+      }
+    } else {
+      level_t current_level;
+      index_t current_index;
+
+      index.get(dim_list[dim_rem - 1], current_level, current_index);
+
+      // handle level greater zero
+      if (current_level > 0) {
+        // given current point to next dim
+        collect_Boundary_rec(source, result, index, dim_list, dim_rem - 1, dim_sweep, poles);
+
+        if (!index.hint()) {
+          index.leftChild(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(source, result, index, dim_list, dim_rem, dim_sweep, poles);
+          }
+
+          index.stepRight(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(source, result, index, dim_list, dim_rem, dim_sweep, poles);
+          }
+
+          index.up(dim_list[dim_rem - 1]);
+        }
+      } else {  // handle level zero
+        collect_Boundary_rec(source, result, index, dim_list, dim_rem - 1, dim_sweep, poles);
+
+        index.resetToRightLevelZero(dim_list[dim_rem - 1]);
+        collect_Boundary_rec(source, result, index, dim_list, dim_rem - 1, dim_sweep, poles);
+
+        if (!index.hint()) {
+          index.resetToLevelOne(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(source, result, index, dim_list, dim_rem, dim_sweep, poles);
+          }
+        }
+
+        index.resetToLeftLevelZero(dim_list[dim_rem - 1]);
+      }
+    }
+  }
+
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep.
    * Boundaries are not regarded
@@ -326,6 +326,44 @@ void DataMatrix::setColumn(size_t col, const DataVector& vec) {
   }
 }
 
+DataVectorView DataMatrix::getRowView(size_t row) {
+  if (row >= this->nrows) {
+    throw sgpp::base::data_exception("DataMatrix::getRowView : Row out of range");
+  }
+
+  return DataVectorView(this->data() + row * ncols, ncols);
+}
+
+ConstDataVectorView DataMatrix::getRowView(size_t row) const {
+  if (row >= this->nrows) {
+    throw sgpp::base::data_exception("DataMatrix::getRowView : Row out of range");
+  }
+
+  return ConstDataVectorView(this->data() + row * ncols, ncols);
+}
+
+DataVectorView DataMatrix::getColumnView(size_t col) {
+  if (col >= this->ncols) {
+    throw sgpp::base::data_exception("DataMatrix::getColumnView : Column out of range");
+  }
+
+  return DataVectorView(this->data() + col, nrows, ncols);
+}
+
+ConstDataVectorView DataMatrix::getColumnView(size_t col) const {
+  if (col >= this->ncols) {
+    throw sgpp::base::data_exception("DataMatrix::getColumnView : Column out of range");
+  }
+
+  return ConstDataVectorView(this->data() + col, nrows, ncols);
+}
+
+DataMatrixView DataMatrix::getView() { return DataMatrixView(this->data(), nrows, ncols); }
+
+ConstDataMatrixView DataMatrix::getView() const {
+  return ConstDataMatrixView(this->data(), nrows, ncols);
+}
+
 void DataMatrix::copyFrom(const DataMatrix& matr) {
   if (*this == matr) {
     return;
@@ -6,7 +6,9 @@
 #ifndef DATAMATRIX_H_
 #define DATAMATRIX_H_
 
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -316,6 +318,59 @@ class DataMatrix : public std::vector<double> {
    */
   void setColumn(size_t col, const DataVector& vec);
 
+  /**
+   * Returns a view of a row without copying the data.
+   * The view becomes invalid if the DataMatrix is resized.
+   *
+   * @param row The row
+   * @return contiguous view of the row
+   */
+  DataVectorView getRowView(size_t row);
+
+  /**
+   * Returns a read-only view of a row without copying the data.
+   * The view becomes invalid if the DataMatrix is resized.
+   *
+   * @param row The row
+   * @return contiguous view of the row
+   */
+  ConstDataVectorView getRowView(size_t row) const;
+
+  /**
+   * Returns a view of a column without copying the data.
+   * The view becomes invalid if the DataMatrix is resized.
+   *
+   * @param col The column
+   * @return strided view of the column
+   */
+  DataVectorView getColumnView(size_t col);
+
+  /**
+   * Returns a read-only view of a column without copying the data.
+   * The view becomes invalid if the DataMatrix is resized.
+   *
+   * @param col The column
+   * @return strided view of the column
+   */
+  ConstDataVectorView getColumnView(size_t col) const;
+
+  /**
+   * Returns a view of the whole DataMatrix, which can be used to obtain views of
+   * sub-matrices (see BasicDataMatrixView::getSubMatrix).
+   * The view becomes invalid if the DataMatrix is resized.
+   *
+   * @return view of the DataMatrix
+   */
+  DataMatrixView getView();
+
+  /**
+   * Returns a read-only view of the whole DataMatrix.
+   * The view becomes invalid if the DataMatrix is resized.
+   *
+   * @return view of the DataMatrix
+   */
+  ConstDataMatrixView getView() const;
+
   /**
    * Adds the values from another DataMatrix to the current values.
    * Modifies the current values.
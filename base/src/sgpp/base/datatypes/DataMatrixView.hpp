@@ -0,0 +1,171 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATAMATRIXVIEW_HPP
+#define DATAMATRIXVIEW_HPP
+
+#include <sgpp/base/datatypes/DataVectorView.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Non-owning view of row-major two-dimensional data, e.g., of a DataMatrix or of a block of
+ * consecutive rows and columns of a DataMatrix. Rows are returned as contiguous views and
+ * columns as strided views (see BasicDataVectorView), so no data is copied.
+ * The viewed data has to outlive the view and must not be reallocated while the view is used.
+ *
+ * Use the typedefs DataMatrixView (mutable data) and ConstDataMatrixView (read-only data).
+ *
+ * @tparam T type of the entries (possibly const qualified)
+ */
+template <class T>
+class BasicDataMatrixView {
+ public:
+  /// type of the entries without const qualifier
+  typedef typename std::remove_const<T>::type value_type;
+
+  /**
+   * Creates an empty view.
+   */
+  BasicDataMatrixView() : data(nullptr), nrows(0), ncols(0), rowStride(0) {}
+
+  /**
+   * Creates a view of a row-major array.
+   *
+   * @param data      pointer to the first entry
+   * @param nrows     number of rows
+   * @param ncols     number of columns
+   * @param rowStride distance between the first entries of two consecutive rows
+   */
+  BasicDataMatrixView(T* data, size_t nrows, size_t ncols, size_t rowStride)
+      : data(data), nrows(nrows), ncols(ncols), rowStride(rowStride) {}
+
+  /**
+   * Creates a view of a contiguous row-major array.
+   *
+   * @param data      pointer to the first entry
+   * @param nrows     number of rows
+   * @param ncols     number of columns
+   */
+  BasicDataMatrixView(T* data, size_t nrows, size_t ncols)
+      : BasicDataMatrixView(data, nrows, ncols, ncols) {}
+
+  /**
+   * Converts a view of mutable data to a view of const data.
+   *
+   * @param other   view to be converted
+   */
+  template <class U, class = typename std::enable_if<
+                         std::is_const<T>::value && std::is_same<const U, T>::value>::type>
+  BasicDataMatrixView(const BasicDataMatrixView<U>& other)  // NOLINT(runtime/explicit)
+      : data(other.getPointer()),
+        nrows(other.getNrows()),
+        ncols(other.getNcols()),
+        rowStride(other.getRowStride()) {}
+
+  /**
+   * @param row index of the row
+   * @param col index of the column
+   * @return reference to the entry
+   */
+  T& operator()(size_t row, size_t col) const { return data[row * rowStride + col]; }
+
+  /**
+   * @param row index of the row
+   * @param col index of the column
+   * @return value of the entry
+   */
+  value_type get(size_t row, size_t col) const { return data[row * rowStride + col]; }
+
+  /**
+   * Sets an entry (only for views of mutable data).
+   *
+   * @param row   index of the row
+   * @param col   index of the column
+   * @param value new value of the entry
+   */
+  void set(size_t row, size_t col, value_type value) const {
+    data[row * rowStride + col] = value;
+  }
+
+  /**
+   * @param row index of the row
+   * @return contiguous view of the row
+   */
+  BasicDataVectorView<T> getRow(size_t row) const {
+    return BasicDataVectorView<T>(data + row * rowStride, ncols, 1);
+  }
+
+  /**
+   * @param col index of the column
+   * @return strided view of the column
+   */
+  BasicDataVectorView<T> getColumn(size_t col) const {
+    return BasicDataVectorView<T>(data + col, nrows, rowStride);
+  }
+
+  /**
+   * Returns a view of a block of the matrix.
+   *
+   * @param rowStart  index of the first row of the block
+   * @param colStart  index of the first column of the block
+   * @param numRows   number of rows of the block
+   * @param numCols   number of columns of the block
+   * @return view of the block
+   */
+  BasicDataMatrixView<T> getSubMatrix(size_t rowStart, size_t colStart, size_t numRows,
+                                      size_t numCols) const {
+    return BasicDataMatrixView<T>(data + rowStart * rowStride + colStart, numRows, numCols,
+                                  rowStride);
+  }
+
+  /**
+   * @return number of rows
+   */
+  size_t getNrows() const { return nrows; }
+
+  /**
+   * @return number of columns
+   */
+  size_t getNcols() const { return ncols; }
+
+  /**
+   * @return distance between the first entries of two consecutive rows
+   */
+  size_t getRowStride() const { return rowStride; }
+
+  /**
+   * @return pointer to the first entry
+   */
+  T* getPointer() const { return data; }
+
+ protected:
+  /// pointer to the first entry
+  T* data;
+  /// number of rows
+  size_t nrows;
+  /// number of columns
+  size_t ncols;
+  /// distance between the first entries of two consecutive rows
+  size_t rowStride;
+};
+
+/// view of mutable double precision data
+typedef BasicDataMatrixView<double> DataMatrixView;
+/// view of read-only double precision data
+typedef BasicDataMatrixView<const double> ConstDataMatrixView;
+/// view of read-only single precision data
+typedef BasicDataMatrixView<const float> ConstDataMatrixViewSP;
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* DATAMATRIXVIEW_HPP */
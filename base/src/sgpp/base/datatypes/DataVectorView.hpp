@@ -0,0 +1,178 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATAVECTORVIEW_HPP
+#define DATAVECTORVIEW_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Non-owning view of one-dimensional data with a constant stride, e.g., of a DataVector, of a
+ * row of a DataMatrix (stride 1) or of a column of a DataMatrix (stride = number of columns).
+ * Creating a view neither copies the data nor allocates memory, so views can be passed to
+ * evaluation routines for every data point of a data set.
+ * The viewed data has to outlive the view and must not be reallocated (e.g., by resizing the
+ * viewed DataVector) while the view is used.
+ *
+ * Use the typedefs DataVectorView (mutable data) and ConstDataVectorView (read-only data).
+ *
+ * @tparam T type of the entries (possibly const qualified)
+ */
+template <class T>
+class BasicDataVectorView {
+ public:
+  /// type of the entries without const qualifier
+  typedef typename std::remove_const<T>::type value_type;
+
+  /**
+   * Creates an empty view.
+   */
+  BasicDataVectorView() : data(nullptr), size(0), stride(1) {}
+
+  /**
+   * Creates a view of an array.
+   *
+   * @param data    pointer to the first entry
+   * @param size    number of entries
+   * @param stride  distance between two consecutive entries
+   */
+  BasicDataVectorView(T* data, size_t size, size_t stride = 1)
+      : data(data), size(size), stride(stride) {}
+
+  /**
+   * Creates a view of a (mutable) std::vector or DataVector.
+   *
+   * @param vector  vector to be viewed
+   */
+  BasicDataVectorView(std::vector<value_type>& vector)  // NOLINT(runtime/explicit)
+      : data(vector.data()), size(vector.size()), stride(1) {}
+
+  /**
+   * Creates a read-only view of a std::vector or DataVector.
+   * Only available for views of const data.
+   *
+   * @param vector  vector to be viewed
+   */
+  template <class U = T, class = typename std::enable_if<std::is_const<U>::value>::type>
+  BasicDataVectorView(const std::vector<value_type>& vector)  // NOLINT(runtime/explicit)
+      : data(vector.data()), size(vector.size()), stride(1) {}
+
+  /**
+   * Converts a view of mutable data to a view of const data.
+   *
+   * @param other   view to be converted
+   */
+  template <class U, class = typename std::enable_if<
+                         std::is_const<T>::value && std::is_same<const U, T>::value>::type>
+  BasicDataVectorView(const BasicDataVectorView<U>& other)  // NOLINT(runtime/explicit)
+      : data(other.getPointer()), size(other.getSize()), stride(other.getStride()) {}
+
+  /**
+   * @param i index of the entry
+   * @return reference to the i-th entry
+   */
+  T& operator[](size_t i) const { return data[i * stride]; }
+
+  /**
+   * @param i index of the entry
+   * @return value of the i-th entry
+   */
+  value_type get(size_t i) const { return data[i * stride]; }
+
+  /**
+   * Sets the i-th entry (only for views of mutable data).
+   *
+   * @param i     index of the entry
+   * @param value new value of the entry
+   */
+  void set(size_t i, value_type value) const { data[i * stride] = value; }
+
+  /**
+   * @return number of entries
+   */
+  size_t getSize() const { return size; }
+
+  /**
+   * @return distance between two consecutive entries in the underlying array
+   */
+  size_t getStride() const { return stride; }
+
+  /**
+   * @return pointer to the first entry
+   */
+  T* getPointer() const { return data; }
+
+  /**
+   * @return whether the entries are stored contiguously
+   */
+  bool isContiguous() const { return (stride == 1) || (size <= 1); }
+
+  /**
+   * Returns a view of a contiguous range of the entries.
+   *
+   * @param start index of the first entry of the range
+   * @param n     number of entries of the range
+   * @return view of the entries start, ..., start + n - 1
+   */
+  BasicDataVectorView<T> subView(size_t start, size_t n) const {
+    return BasicDataVectorView<T>(data + start * stride, n, stride);
+  }
+
+  /**
+   * Copies the entries into a vector (e.g., a DataVector), which is resized if necessary.
+   * No memory is allocated if the capacity of the vector suffices.
+   *
+   * @param[out] vector vector to which the entries are copied
+   */
+  void copyTo(std::vector<value_type>& vector) const {
+    vector.resize(size);
+
+    for (size_t i = 0; i < size; i++) {
+      vector[i] = data[i * stride];
+    }
+  }
+
+  /**
+   * @param other view of the same size
+   * @return scalar product of the two views
+   */
+  template <class U>
+  value_type dotProduct(const BasicDataVectorView<U>& other) const {
+    value_type result = 0;
+
+    for (size_t i = 0; i < size; i++) {
+      result += data[i * stride] * other[i];
+    }
+
+    return result;
+  }
+
+ protected:
+  /// pointer to the first entry
+  T* data;
+  /// number of entries
+  size_t size;
+  /// distance between two consecutive entries
+  size_t stride;
+};
+
+/// view of mutable double precision data
+typedef BasicDataVectorView<double> DataVectorView;
+/// view of read-only double precision data
+typedef BasicDataVectorView<const double> ConstDataVectorView;
+/// view of read-only single precision data
+typedef BasicDataVectorView<const float> ConstDataVectorViewSP;
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* DATAVECTORVIEW_HPP */
@@ -0,0 +1,110 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/SparseDataMatrix.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+SparseDataMatrix::SparseDataMatrix() : SparseDataMatrix(0, 0) {}
+
+SparseDataMatrix::SparseDataMatrix(size_t nrows, size_t ncols)
+    : nrows(nrows), ncols(ncols), rowPointers(nrows + 1, 0) {}
+
+SparseDataMatrix::SparseDataMatrix(size_t nrows, size_t ncols, std::vector<size_t> rowPointers,
+                                   std::vector<size_t> columnIndices, std::vector<double> values)
+    : SparseDataMatrix() {
+  assign(nrows, ncols, std::move(rowPointers), std::move(columnIndices), std::move(values));
+}
+
+void SparseDataMatrix::assign(size_t nrows, size_t ncols, std::vector<size_t> rowPointers,
+                              std::vector<size_t> columnIndices, std::vector<double> values) {
+  if (rowPointers.size() != nrows + 1 || rowPointers[0] != 0 ||
+      rowPointers[nrows] != values.size() || columnIndices.size() != values.size()) {
+    throw data_exception("SparseDataMatrix::assign : inconsistent CSR arrays");
+  }
+
+  for (size_t i = 0; i < nrows; i++) {
+    if (rowPointers[i] > rowPointers[i + 1]) {
+      throw data_exception("SparseDataMatrix::assign : row pointers are not ascending");
+    }
+
+    for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+      if (columnIndices[k] >= ncols ||
+          (k > rowPointers[i] && columnIndices[k - 1] >= columnIndices[k])) {
+        throw data_exception("SparseDataMatrix::assign : invalid column indices");
+      }
+    }
+  }
+
+  this->nrows = nrows;
+  this->ncols = ncols;
+  this->rowPointers = std::move(rowPointers);
+  this->columnIndices = std::move(columnIndices);
+  this->values = std::move(values);
+}
+
+double SparseDataMatrix::get(size_t row, size_t col) const {
+  if (row >= nrows || col >= ncols) {
+    throw data_exception("SparseDataMatrix::get : index out of range");
+  }
+
+  auto begin = columnIndices.begin() + rowPointers[row];
+  auto end = columnIndices.begin() + rowPointers[row + 1];
+  auto it = std::lower_bound(begin, end, col);
+
+  if ((it != end) && (*it == col)) {
+    return values[it - columnIndices.begin()];
+  } else {
+    return 0.0;
+  }
+}
+
+void SparseDataMatrix::mult(const DataVector& x, DataVector& result) const {
+  if (x.getSize() != ncols || result.getSize() != nrows) {
+    throw data_exception("SparseDataMatrix::mult : Dimensions do not match!");
+  }
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < nrows; i++) {
+    double temp = 0.0;
+
+    for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+      temp += values[k] * x[columnIndices[k]];
+    }
+
+    result[i] = temp;
+  }
+}
+
+void SparseDataMatrix::toDense(DataMatrix& dense) const {
+  dense.resizeZero(nrows, ncols);
+  dense.setAll(0.0);
+
+  for (size_t i = 0; i < nrows; i++) {
+    for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+      dense.set(i, columnIndices[k], values[k]);
+    }
+  }
+}
+
+std::string SparseDataMatrix::toString() const {
+  std::ostringstream stream;
+  stream << "SparseDataMatrix(" << nrows << " x " << ncols << ", " << getNnz()
+         << " non-zero entries)";
+  return stream.str();
+}
+
+}  // namespace base
+}  // namespace sgpp
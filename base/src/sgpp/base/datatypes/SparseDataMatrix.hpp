@@ -0,0 +1,147 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SPARSEDATAMATRIX_HPP
+#define SPARSEDATAMATRIX_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * A sparse matrix in compressed sparse row (CSR) format.
+ * The non-zero entries of row i are stored in
+ * values[rowPointers[i]], ..., values[rowPointers[i + 1] - 1], the corresponding column indices
+ * in columnIndices. Within each row, the column indices are strictly increasing.
+ *
+ * SparseDataMatrix is used for system matrices of sparse grids (e.g., explicit L2 dot product or
+ * Laplace matrices), for which most pairs of basis functions have disjoint supports.
+ */
+class SparseDataMatrix {
+ public:
+  /**
+   * Creates an empty 0 x 0 matrix.
+   */
+  SparseDataMatrix();
+
+  /**
+   * Creates a matrix with @em nrows rows and @em ncols columns without non-zero entries.
+   *
+   * @param nrows Number of rows
+   * @param ncols Number of columns
+   */
+  SparseDataMatrix(size_t nrows, size_t ncols);
+
+  /**
+   * Creates a matrix from given CSR arrays.
+   * Throws a data_exception if the arrays are inconsistent.
+   *
+   * @param nrows Number of rows
+   * @param ncols Number of columns
+   * @param rowPointers Offsets of the rows (size nrows + 1)
+   * @param columnIndices Column indices of the non-zero entries
+   * @param values Values of the non-zero entries
+   */
+  SparseDataMatrix(size_t nrows, size_t ncols, std::vector<size_t> rowPointers,
+                   std::vector<size_t> columnIndices, std::vector<double> values);
+
+  /**
+   * Replaces the matrix by the given CSR arrays.
+   * Throws a data_exception if the arrays are inconsistent.
+   *
+   * @param nrows Number of rows
+   * @param ncols Number of columns
+   * @param rowPointers Offsets of the rows (size nrows + 1)
+   * @param columnIndices Column indices of the non-zero entries
+   * @param values Values of the non-zero entries
+   */
+  void assign(size_t nrows, size_t ncols, std::vector<size_t> rowPointers,
+              std::vector<size_t> columnIndices, std::vector<double> values);
+
+  /**
+   * Returns the entry in row @em row and column @em col (0 if it is not stored).
+   *
+   * @param row Row
+   * @param col Column
+   * @return Value of the entry
+   */
+  double get(size_t row, size_t col) const;
+
+  /**
+   * Computes result = A * x, parallelized over the rows.
+   *
+   * @param x Vector of size getNcols()
+   * @param result Vector of size getNrows(), overwritten with the product
+   */
+  void mult(const DataVector& x, DataVector& result) const;
+
+  /**
+   * Converts the matrix to a dense matrix.
+   *
+   * @param dense Matrix that is resized to getNrows() x getNcols() and overwritten
+   */
+  void toDense(DataMatrix& dense) const;
+
+  /**
+   * @return Number of rows
+   */
+  inline size_t getNrows() const { return nrows; }
+
+  /**
+   * @return Number of columns
+   */
+  inline size_t getNcols() const { return ncols; }
+
+  /**
+   * @return Number of stored entries
+   */
+  inline size_t getNnz() const { return values.size(); }
+
+  /**
+   * @return Offsets of the rows in getColumnIndices() and getValues() (size getNrows() + 1)
+   */
+  inline const std::vector<size_t>& getRowPointers() const { return rowPointers; }
+
+  /**
+   * @return Column indices of the stored entries
+   */
+  inline const std::vector<size_t>& getColumnIndices() const { return columnIndices; }
+
+  /**
+   * @return Values of the stored entries
+   */
+  inline const std::vector<double>& getValues() const { return values; }
+
+  /**
+   * Returns a description of the matrix (size and number of non-zero entries).
+   *
+   * @return String
+   */
+  std::string toString() const;
+
+ private:
+  /// number of rows
+  size_t nrows;
+  /// number of columns
+  size_t ncols;
+  /// offsets of the rows, size nrows + 1
+  std::vector<size_t> rowPointers;
+  /// column indices of the stored entries
+  std::vector<size_t> columnIndices;
+  /// values of the stored entries
+  std::vector<double> values;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* SPARSEDATAMATRIX_HPP */
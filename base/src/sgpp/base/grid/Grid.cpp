@@ -6,6 +6,7 @@
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 
 #include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
 #include <sgpp/base/grid/type/BsplineClenshawCurtisGrid.hpp>
@@ -40,6 +41,7 @@
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
 
 #include <sgpp/base/exception/generation_exception.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
@@ -48,7 +50,14 @@
 #include <sgpp/base/grid/type/LinearTruncatedBoundaryGrid.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <map>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -56,6 +65,40 @@
 namespace sgpp {
 namespace base {
 
+namespace {
+
+/// magic number at the beginning of binary grid files
+const char BINARY_GRID_MAGIC[8] = {'S', 'G', 'P', 'P', 'G', 'R', 'I', 'D'};
+/// byte order mark to detect files written on machines with different endianness
+const uint32_t BINARY_GRID_BYTE_ORDER_MARK = 0x01020304;
+
+/**
+ * Header of binary grid files, followed by the grid description, levels, indices,
+ * leaf properties and coefficients (see Grid::serializeBinary).
+ */
+struct BinaryGridHeader {
+  char magic[8];
+  uint32_t byteOrderMark;
+  uint32_t version;
+  uint64_t dimension;
+  uint64_t numberOfPoints;
+  uint64_t numberOfCoefficients;
+  uint64_t descriptionLength;
+};
+
+/// rounds up to the next multiple of 8 bytes
+inline uint64_t alignBinaryOffset(uint64_t offset) {
+  return (offset + 7) & ~static_cast<uint64_t>(7);
+}
+
+/// writes zeros to the stream until the offset is a multiple of 8 bytes
+void writeBinaryPadding(std::ostream& ostr, uint64_t offset) {
+  const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  ostr.write(zeros, static_cast<std::streamsize>(alignBinaryOffset(offset) - offset));
+}
+
+}  // namespace
+
 Grid* Grid::createLinearGridStencil(size_t dim) { return new LinearGridStencil(dim); }
 
 Grid* Grid::createModLinearGridStencil(size_t dim) { return new ModLinearGridStencil(dim); }
@@ -452,6 +495,99 @@ Grid* Grid::unserialize(std::istream& istr) {
   return nullptr;
 }
 
+Grid* Grid::unserializeBinary(const char* data, size_t size, DataVector* alpha) {
+  if (reinterpret_cast<uintptr_t>(data) % sizeof(uint64_t) != 0) {
+    // the arrays are accessed in place, so copy unaligned data to an aligned buffer
+    std::vector<uint64_t> alignedData((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    std::memcpy(alignedData.data(), data, size);
+    return unserializeBinary(reinterpret_cast<const char*>(alignedData.data()), size, alpha);
+  }
+
+  BinaryGridHeader header;
+
+  if (size < sizeof(header)) {
+    throw file_exception("Grid::unserializeBinary : data too short");
+  }
+
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, BINARY_GRID_MAGIC, sizeof(header.magic)) != 0) {
+    throw file_exception("Grid::unserializeBinary : not a binary grid file");
+  } else if (header.byteOrderMark != BINARY_GRID_BYTE_ORDER_MARK) {
+    throw file_exception("Grid::unserializeBinary : byte order not supported");
+  } else if (header.version > SERIALIZATION_VERSION) {
+    throw file_exception("Grid::unserializeBinary : serialization version not supported");
+  }
+
+  const uint64_t numberOfPoints = header.numberOfPoints;
+  const uint64_t dim = header.dimension;
+
+  // check the sizes against the remaining data before computing the next offset, since the
+  // header might be corrupted
+  if (header.descriptionLength > size - sizeof(header)) {
+    throw file_exception("Grid::unserializeBinary : description exceeds the data");
+  }
+
+  const uint64_t levelsOffset = alignBinaryOffset(sizeof(header) + header.descriptionLength);
+
+  if ((size < levelsOffset) ||
+      ((dim > 0) && (numberOfPoints > (size - levelsOffset) / sizeof(uint32_t) / dim))) {
+    throw file_exception("Grid::unserializeBinary : number of points exceeds the data");
+  }
+
+  const uint64_t arraySize = numberOfPoints * dim * sizeof(uint32_t);
+  const uint64_t indicesOffset = levelsOffset + arraySize;
+
+  if (arraySize > size - indicesOffset) {
+    throw file_exception("Grid::unserializeBinary : number of points exceeds the data");
+  }
+
+  const uint64_t leavesOffset = indicesOffset + arraySize;
+
+  if (numberOfPoints > size - leavesOffset) {
+    throw file_exception("Grid::unserializeBinary : number of points exceeds the data");
+  }
+
+  const uint64_t coefficientsOffset = alignBinaryOffset(leavesOffset + numberOfPoints);
+
+  if ((size < coefficientsOffset) ||
+      (header.numberOfCoefficients > (size - coefficientsOffset) / sizeof(double))) {
+    throw file_exception("Grid::unserializeBinary : coefficients exceed the data");
+  } else if ((alpha != nullptr) && (header.numberOfCoefficients != numberOfPoints)) {
+    throw file_exception("Grid::unserializeBinary : data does not contain coefficients");
+  }
+
+  // grid without points from the text description
+  std::unique_ptr<Grid> grid(
+      Grid::unserialize(std::string(data + sizeof(header), header.descriptionLength)));
+
+  if (grid->getDimension() != dim) {
+    throw file_exception("Grid::unserializeBinary : inconsistent dimension");
+  }
+
+  grid->getStorage().insert(reinterpret_cast<const uint32_t*>(data + levelsOffset),
+                            reinterpret_cast<const uint32_t*>(data + indicesOffset),
+                            reinterpret_cast<const uint8_t*>(data + leavesOffset),
+                            numberOfPoints);
+
+  if (alpha != nullptr) {
+    alpha->resize(numberOfPoints);
+    std::memcpy(alpha->getPointer(), data + coefficientsOffset, numberOfPoints * sizeof(double));
+  }
+
+  return grid.release();
+}
+
+Grid* Grid::unserializeBinary(const std::string& filename) {
+  MemoryMappedFile file(filename);
+  return unserializeBinary(file.getData(), file.getSize());
+}
+
+Grid* Grid::unserializeBinary(const std::string& filename, DataVector& alpha) {
+  MemoryMappedFile file(filename);
+  return unserializeBinary(file.getData(), file.getSize(), &alpha);
+}
+
 std::map<std::string, Grid::Factory>& Grid::typeMap() {
   // This is only executed once!
   static factoryMap* tMap = new factoryMap();
@@ -721,6 +857,102 @@ void Grid::serialize(std::ostream& ostr, int version) {
   storage.serialize(ostr, version);
 }
 
+void Grid::serializeBinary(std::ostream& ostr, const DataVector* alpha) {
+  const size_t dim = storage.getDimension();
+  const size_t numberOfPoints = storage.getSize();
+
+  if ((alpha != nullptr) && (alpha->getSize() != numberOfPoints)) {
+    throw application_exception(
+        "Grid::serializeBinary : coefficient vector does not match grid size");
+  }
+
+  // grid description in the text format without grid points: temporarily move the points
+  // to another storage, so that type-specific parameters are written by the subclasses
+  std::string description;
+  {
+    GridStorage points(dim);
+    storage.swapPoints(points);
+
+    try {
+      serialize(description, SERIALIZATION_VERSION);
+    } catch (...) {
+      storage.swapPoints(points);
+      throw;
+    }
+
+    storage.swapPoints(points);
+  }
+
+  BinaryGridHeader header;
+  std::memcpy(header.magic, BINARY_GRID_MAGIC, sizeof(header.magic));
+  header.byteOrderMark = BINARY_GRID_BYTE_ORDER_MARK;
+  header.version = SERIALIZATION_VERSION;
+  header.dimension = dim;
+  header.numberOfPoints = numberOfPoints;
+  header.numberOfCoefficients = (alpha != nullptr) ? numberOfPoints : 0;
+  header.descriptionLength = description.size();
+
+  uint64_t offset = sizeof(header) + description.size();
+  ostr.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  ostr.write(description.data(), static_cast<std::streamsize>(description.size()));
+  writeBinaryPadding(ostr, offset);
+  offset = alignBinaryOffset(offset);
+
+  // levels and indices, written in blocks of points to limit the buffer size
+  const size_t blockSize = 4096;
+  std::vector<uint32_t> buffer(blockSize * dim);
+
+  for (size_t writeIndices = 0; writeIndices < 2; writeIndices++) {
+    for (size_t start = 0; start < numberOfPoints; start += blockSize) {
+      const size_t end = std::min(start + blockSize, numberOfPoints);
+
+      for (size_t k = start; k < end; k++) {
+        const GridPoint& point = storage.getPoint(k);
+
+        for (size_t d = 0; d < dim; d++) {
+          buffer[(k - start) * dim + d] =
+              (writeIndices == 0) ? point.getLevel(d) : point.getIndex(d);
+        }
+      }
+
+      ostr.write(reinterpret_cast<const char*>(buffer.data()),
+                 static_cast<std::streamsize>((end - start) * dim * sizeof(uint32_t)));
+    }
+  }
+
+  offset += 2 * numberOfPoints * dim * sizeof(uint32_t);
+
+  std::vector<uint8_t> leaves(numberOfPoints);
+
+  for (size_t k = 0; k < numberOfPoints; k++) {
+    leaves[k] = storage.getPoint(k).isLeaf() ? 1 : 0;
+  }
+
+  ostr.write(reinterpret_cast<const char*>(leaves.data()),
+             static_cast<std::streamsize>(numberOfPoints));
+  offset += numberOfPoints;
+  writeBinaryPadding(ostr, offset);
+
+  if (alpha != nullptr) {
+    ostr.write(reinterpret_cast<const char*>(alpha->getPointer()),
+               static_cast<std::streamsize>(numberOfPoints * sizeof(double)));
+  }
+
+  if (!ostr) {
+    throw file_exception("Grid::serializeBinary : could not write grid");
+  }
+}
+
+void Grid::serializeBinary(const std::string& filename) {
+  std::ofstream ostr(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  serializeBinary(ostr);
+}
+
+void Grid::serializeBinary(const std::string& filename, const DataVector& alpha) {
+  std::ofstream ostr(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  serializeBinary(ostr, &alpha);
+}
+
 void Grid::refine(DataVector& vector, int numOfPoints) {
   SurplusRefinementFunctor functor(vector, numOfPoints);
   getGenerator().refine(functor);
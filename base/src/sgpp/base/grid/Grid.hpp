@@ -678,6 +678,38 @@ class Grid {
    */
   static Grid* unserialize(std::istream& istr);
 
+  /**
+   * reads a grid (and optionally its coefficients) in the binary format
+   * (see serializeBinary) from memory
+   *
+   * @param data  pointer to the binary data
+   * @param size  size of the binary data in bytes
+   * @param alpha if not nullptr, the stored coefficients are written to this vector
+   *              (it is resized to the number of grid points, throws if the
+   *              data does not contain coefficients)
+   * @return grid
+   */
+  static Grid* unserializeBinary(const char* data, size_t size, DataVector* alpha = nullptr);
+
+  /**
+   * reads a grid in the binary format (see serializeBinary) from a file,
+   * the file is memory-mapped
+   *
+   * @param filename  name of the file
+   * @return grid
+   */
+  static Grid* unserializeBinary(const std::string& filename);
+
+  /**
+   * reads a grid and its coefficients in the binary format (see serializeBinary)
+   * from a file, the file is memory-mapped
+   *
+   * @param filename  name of the file
+   * @param alpha     the stored coefficients are written to this vector
+   * @return grid
+   */
+  static Grid* unserializeBinary(const std::string& filename, DataVector& alpha);
+
  protected:
   /**
    * This constructor creates a new GridStorage out of the stream.
@@ -825,6 +857,39 @@ class Grid {
    */
   std::string serialize(int version = SERIALIZATION_VERSION);
 
+  /**
+   * Serializes the grid and optionally a coefficient vector in the binary format.
+   *
+   * The binary format consists of a header (magic number, byte order mark,
+   * SERIALIZATION_VERSION, dimension, number of grid points and coefficients),
+   * the grid description in the text format (grid type, bounding box or stretching and
+   * type-specific parameters, but no grid points), the levels and indices of all
+   * grid points as contiguous arrays of 32-bit integers, the leaf properties
+   * and the coefficients. All arrays are aligned, such that the file can be
+   * memory-mapped and converted to a grid without parsing the grid points,
+   * see unserializeBinary.
+   *
+   * @param ostr  stream to which the grid is written (should be opened in binary mode)
+   * @param alpha coefficient vector to store along with the grid (may be nullptr),
+   *              must have as many entries as the grid has points
+   */
+  void serializeBinary(std::ostream& ostr, const DataVector* alpha = nullptr);
+
+  /**
+   * Serializes the grid to a file in the binary format.
+   *
+   * @param filename  name of the file
+   */
+  void serializeBinary(const std::string& filename);
+
+  /**
+   * Serializes the grid and a coefficient vector to a file in the binary format.
+   *
+   * @param filename  name of the file
+   * @param alpha     coefficient vector
+   */
+  void serializeBinary(const std::string& filename, const DataVector& alpha);
+
   /**
    * Refine grid
    * Refine the given number of points on the grid according to the vector
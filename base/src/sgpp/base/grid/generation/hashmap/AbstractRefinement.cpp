@@ -9,6 +9,13 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -97,5 +104,138 @@ bool AbstractRefinement::isRefinable(GridStorage& storage, GridPoint& point) {
   return false;
 }
 
+bool AbstractRefinement::hasMissingChild(GridStorage& storage, GridPoint& point) const {
+  GridStorage::grid_map_iterator end_iter = storage.end();
+
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    index_t source_index;
+    level_t source_level;
+    point.get(d, source_level, source_index);
+
+    // test existence of left child
+    point.set(d, source_level + 1, 2 * source_index - 1);
+
+    if (storage.find(&point) == end_iter) {
+      point.set(d, source_level, source_index);
+      return true;
+    }
+
+    // test existence of right child
+    point.set(d, source_level + 1, 2 * source_index + 1);
+
+    if (storage.find(&point) == end_iter) {
+      point.set(d, source_level, source_index);
+      return true;
+    }
+
+    // reset current grid point in dimension d
+    point.set(d, source_level, source_index);
+  }
+
+  return false;
+}
+
+void AbstractRefinement::computeIndicators(GridStorage& storage,
+                                           const RefinementFunctor& functor,
+                                           std::vector<GridStorage::grid_map_iterator>& iterators,
+                                           std::vector<IndicatorEntry>& entries) const {
+  iterators.clear();
+  iterators.reserve(storage.getSize());
+
+  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != storage.end(); iter++) {
+    iterators.push_back(iter);
+  }
+
+  const size_t n = iterators.size();
+  std::vector<std::vector<IndicatorEntry>> threadEntries;
+
+#pragma omp parallel
+  {
+    size_t threadId = 0;
+    size_t numberOfThreads = 1;
+#ifdef _OPENMP
+    threadId = static_cast<size_t>(omp_get_thread_num());
+    numberOfThreads = static_cast<size_t>(omp_get_num_threads());
+#endif
+
+#pragma omp single
+    threadEntries.resize(numberOfThreads);
+
+    // contiguous part of the iteration order (the implicit barrier of single makes sure
+    // that threadEntries has been resized)
+    const size_t begin = threadId * n / numberOfThreads;
+    const size_t end = (threadId + 1) * n / numberOfThreads;
+    std::vector<IndicatorEntry>& localEntries = threadEntries[threadId];
+    GridPoint point;
+
+    for (size_t position = begin; position < end; position++) {
+      point = *(iterators[position]->first);
+
+      if (hasMissingChild(storage, point)) {
+        const refinement_list_type list = getIndicator(storage, iterators[position], functor);
+        size_t entry = 0;
+
+        for (const refinement_pair_type& pair : list) {
+          localEntries.push_back(IndicatorEntry{position, entry, pair.second});
+          entry++;
+        }
+      }
+    }
+  }
+
+  entries.clear();
+
+  for (const std::vector<IndicatorEntry>& localEntries : threadEntries) {
+    entries.insert(entries.end(), localEntries.begin(), localEntries.end());
+  }
+}
+
+AbstractRefinement::refinement_pair_type AbstractRefinement::getIndicatorEntry(
+    GridStorage& storage, const GridStorage::grid_map_iterator& iter,
+    const RefinementFunctor& functor, size_t entry) const {
+  const refinement_list_type list = getIndicator(storage, iter, functor);
+  refinement_list_type::const_iterator it = list.begin();
+  std::advance(it, entry);
+  return *it;
+}
+
+void AbstractRefinement::selectLargestIndicators(std::vector<IndicatorEntry>& entries,
+                                                 size_t refinementsNum) {
+  // same comparison as compare_pairs, i.e., the smallest value is on top of the heap
+  auto compare = [](const IndicatorEntry& lhs, const IndicatorEntry& rhs) {
+    return (lhs.value > rhs.value);
+  };
+  std::vector<IndicatorEntry> heap;
+  heap.reserve(std::min(entries.size(), refinementsNum) + 1);
+
+  for (const IndicatorEntry& entry : entries) {
+    heap.push_back(entry);
+    std::push_heap(heap.begin(), heap.end(), compare);
+
+    if (heap.size() > refinementsNum) {
+      // remove the top (smallest) element
+      std::pop_heap(heap.begin(), heap.end(), compare);
+      heap.pop_back();
+    }
+  }
+
+  entries.swap(heap);
+}
+
+void AbstractRefinement::refineGridpoints(GridStorage& storage,
+                                          const std::vector<size_t>& refineIndices) {
+  const bool parallel = canRefineInParallel();
+  storage.beginDeferredInsertion();
+
+  // static scheduling: every thread refines a contiguous chunk, the buffers of the threads
+  // are inserted in the order of the thread numbers
+#pragma omp parallel for schedule(static) if (parallel)
+  for (size_t i = 0; i < refineIndices.size(); i++) {
+    refineGridpoint(storage, refineIndices[i]);
+  }
+
+  storage.endDeferredInsertion();
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -237,8 +237,9 @@ class AbstractRefinement {
       createGridpoint(storage, point);
       // restore leaf value
       point.setLeaf(saveLeaf);
-    } else {
+    } else if (!storage.isInsertionDeferred()) {
       // set stored index to false
+      // (during deferred insertion, this is done when inserting the new points)
       storage.getPoint((storage.find(&point))->second).setLeaf(false);
     }
   }
@@ -274,6 +275,101 @@ class AbstractRefinement {
     refinement_container_type& collection) = 0;
 
 
+  /**
+   * Value of one entry of the indicator list (see getIndicator()) of a grid point.
+   */
+  struct IndicatorEntry {
+    /// position of the grid point in the iteration order of the storage
+    size_t position;
+    /// position of the entry in the indicator list of the grid point
+    size_t entry;
+    /// refinement value of the entry
+    refinement_value_type value;
+  };
+
+
+  /**
+   * Checks whether a grid point has at least one missing child, i.e., whether
+   * collectRefinablePoints() considers it for refinement.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param point grid point (modified during the check, but restored on return)
+   * @return whether the left or the right child is missing in some dimension
+   */
+  virtual bool hasMissingChild(GridStorage& storage, GridPoint& point) const;
+
+
+  /**
+   * Computes the indicator lists (see getIndicator()) of all grid points with a missing child
+   * (see hasMissingChild()) in parallel. Each thread processes a contiguous part of the
+   * iteration order of the storage, and the parts are concatenated in order, so the entries are
+   * in exactly the order in which a sequential loop over the storage would generate them.
+   * Only the values are stored, the entries finally chosen can be recreated with
+   * getIndicatorEntry(). Hence, getIndicator() and the functor must not modify the storage.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param functor a RefinementFunctor specifying the refinement criteria
+   * @param[out] iterators storage iterators in iteration order (IndicatorEntry::position)
+   * @param[out] entries indicator values of the refinable grid points
+   */
+  void computeIndicators(GridStorage& storage, const RefinementFunctor& functor,
+                         std::vector<GridStorage::grid_map_iterator>& iterators,
+                         std::vector<IndicatorEntry>& entries) const;
+
+
+  /**
+   * Recreates one entry of the indicator list of a grid point.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param iter grid_map iterator to the grid point
+   * @param functor refinement functor
+   * @param entry position of the entry in the indicator list
+   * @return key and value of the entry
+   */
+  refinement_pair_type getIndicatorEntry(GridStorage& storage,
+                                         const GridStorage::grid_map_iterator& iter,
+                                         const RefinementFunctor& functor, size_t entry) const;
+
+
+  /**
+   * Keeps only the refinementsNum entries with the largest values. The entries are inserted one
+   * after another into a bounded heap (the smallest value on top), which yields the same
+   * selection in the same order as inserting them into the collection with
+   * HashRefinement::addElementToCollection (also for equal values).
+   *
+   * @param[in,out] entries indicator values in iteration order, replaced by the selected ones
+   * (in heap order)
+   * @param refinementsNum maximal number of entries to keep
+   */
+  static void selectLargestIndicators(std::vector<IndicatorEntry>& entries,
+                                      size_t refinementsNum);
+
+
+  /**
+   * Refines several grid points with refineGridpoint(). The new grid points are buffered during
+   * the refinement and inserted with one call of HashGridStorage::endDeferredInsertion() (see
+   * HashGridStorage::beginDeferredInsertion()). If canRefineInParallel() is true, the grid points
+   * are refined in parallel by contiguous chunks; as refining a grid point only skips children
+   * and ancestors that already exist, the buffered grid points are then inserted in the same
+   * order as if the grid points were refined one after another, so the result does not depend
+   * on the number of threads.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param refineIndices sequence numbers of the (pairwise different) grid points to refine
+   */
+  void refineGridpoints(GridStorage& storage, const std::vector<size_t>& refineIndices);
+
+
+  /**
+   * Whether refineGridpoint() may be called in parallel during deferred insertion, i.e.,
+   * whether it modifies the storage only by inserting grid points (which are skipped if they
+   * already exist) and by changing the leaf property of the refined grid point.
+   *
+   * @return true if refineGridpoints() may refine the grid points in parallel
+   */
+  virtual bool canRefineInParallel() const { return true; }
+
+
   /**
    * Refines the collection of points.
    *
@@ -48,32 +48,54 @@ void HashCoarsening::free_coarsen_NFirstOnly(GridStorage& storage,
     removeCandidates[i].first = 0;
   }
 
-  // help variable to store the gridpoint with highest
-  // surplus in removeCandidates
-  size_t max_idx = 0;
+  // evaluate the functor for all leaves in parallel
+  // (non-leaves are marked with the initial value, they are never candidates)
+  const size_t firstIndex = std::min(minIndexConsidered, numFirstPoints);
+  std::vector<CoarseningFunctor::value_type> values(numFirstPoints - firstIndex);
+  std::vector<char> isLeaf(values.size());
+
+#pragma omp parallel for schedule(static)
+  for (size_t z = firstIndex; z < numFirstPoints; z++) {
+    isLeaf[z - firstIndex] = storage.getPoint(z).isLeaf();
+
+    if (isLeaf[z - firstIndex]) {
+      values[z - firstIndex] = functor(storage, z);
+    }
+  }
+
+  // max-heap of the entries of removeCandidates (surplus and position in the array),
+  // on top is the candidate with the largest surplus and, among those,
+  // the first one in the array, which is replaced by smaller surpluses
+  // (this selects the same points as searching the array for the
+  // first maximal entry after each replacement, but in O(log remove_num))
+  typedef std::pair<CoarseningFunctor::value_type, size_t> HeapEntry;
+  auto compare = [](const HeapEntry& lhs, const HeapEntry& rhs) {
+    return (lhs.first < rhs.first) || ((lhs.first == rhs.first) && (lhs.second > rhs.second));
+  };
+  std::vector<HeapEntry> heap(remove_num);
+
+  for (size_t i = 0; i < remove_num; i++) {
+    heap[i] = HeapEntry(removeCandidates[i].second, i);
+  }
+
+  std::make_heap(heap.begin(), heap.end(), compare);
 
   // assure that only the first numFirstPoints are checked for coarsening
   // also assure, that indices bigger than minIndexConsidered are not checked
-  for (size_t z = minIndexConsidered; z < numFirstPoints; z++) {
-    GridPoint& point = storage.getPoint(z);
+  for (size_t z = firstIndex; z < numFirstPoints; z++) {
+    if (isLeaf[z - firstIndex]) {
+      CoarseningFunctor::value_type current_value = values[z - firstIndex];
 
-    if (point.isLeaf()) {
-      CoarseningFunctor::value_type current_value = functor(storage, z);
-
-      if (current_value < removeCandidates[max_idx].second) {
+      if (current_value < heap.front().first) {
         // Replace the maximum point array of removable candidates,
         // find the new maximal point
+        const size_t max_idx = heap.front().second;
         removeCandidates[max_idx].second = current_value;
         removeCandidates[max_idx].first = z;
 
-        // find new maximum entry
-        max_idx = 0;
-
-        for (size_t i = 1; i < remove_num; i++) {
-          if (removeCandidates[i].second > removeCandidates[max_idx].second) {
-            max_idx = i;
-          }
-        }
+        std::pop_heap(heap.begin(), heap.end(), compare);
+        heap.back() = HeapEntry(current_value, max_idx);
+        std::push_heap(heap.begin(), heap.end(), compare);
       }
     }
   }
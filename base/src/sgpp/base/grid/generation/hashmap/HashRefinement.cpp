@@ -42,56 +42,17 @@ void HashRefinement::addElementToCollection(
 void HashRefinement::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-  size_t refinements_num = functor.getRefinementsNum();
-
-  // max value equals min value
-
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
-
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
-
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
-
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
-    }
+  // the indicators of all grid points with a missing child are computed in parallel,
+  // then the refinements_num largest ones are selected in the iteration order of the storage
+  // (as if addElementToCollection was called for each grid point)
+  std::vector<GridStorage::grid_map_iterator> iterators;
+  std::vector<AbstractRefinement::IndicatorEntry> entries;
+  computeIndicators(storage, functor, iterators, entries);
+  selectLargestIndicators(entries, functor.getRefinementsNum());
+
+  for (const AbstractRefinement::IndicatorEntry& entry : entries) {
+    collection.push_back(getIndicatorEntry(storage, iterators[entry.position], functor,
+                                           entry.entry));
   }
 }
 
@@ -114,11 +75,15 @@ void HashRefinement::refineGridpointsCollection(GridStorage& storage,
 
   double threshold = functor.getRefinementThreshold();
 
+  std::vector<size_t> refineIndices;
+
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     if (pair.second >= threshold) {
-      refineGridpoint(storage, pair.first->getSeq());
+      refineIndices.push_back(pair.first->getSeq());
     }
   }
+
+  refineGridpoints(storage, refineIndices);
 }
 
 void HashRefinement::free_refine(GridStorage& storage,
@@ -53,68 +53,52 @@ AbstractRefinement::refinement_list_type HashRefinementBoundaries::getIndicator(
 
 
 
-void HashRefinementBoundaries::collectRefinablePoints(GridStorage& storage,
-    RefinementFunctor& functor,
-    AbstractRefinement::refinement_container_type& collection) {
-
-  size_t refinements_num = functor.getRefinementsNum();
-  GridPoint point;
+bool HashRefinementBoundaries::hasMissingChild(GridStorage& storage, GridPoint& point) const {
   GridStorage::grid_map_iterator end_iter = storage.end();
+  bool result = false;
 
-  // I think this may be dependent on local support
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      if (source_level == 0) {
-        // we only have one child on level 1
-        point.set(d, 1, 1);
-        child_iter = storage.find(&point);
-
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
-      } else {
-        // left child
-        point.set(d, source_level + 1, 2 * source_index - 1);
-        child_iter = storage.find(&point);
-
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
+  for (size_t d = 0; (d < storage.getDimension()) && !result; d++) {
+    index_t source_index;
+    level_t source_level;
+    point.get(d, source_level, source_index);
 
+    if (source_level == 0) {
+      // we only have one child on level 1
+      point.set(d, 1, 1);
+      result = (storage.find(&point) == end_iter);
+    } else {
+      // left child
+      point.set(d, source_level + 1, 2 * source_index - 1);
+      result = (storage.find(&point) == end_iter);
+
+      if (!result) {
         // right child
         point.set(d, source_level + 1, 2 * source_index + 1);
-        child_iter = storage.find(&point);
-
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
+        result = (storage.find(&point) == end_iter);
       }
-
-      point.set(d, source_level, source_index);
     }
+
+    point.set(d, source_level, source_index);
+  }
+
+  return result;
+}
+
+
+void HashRefinementBoundaries::collectRefinablePoints(GridStorage& storage,
+    RefinementFunctor& functor,
+    AbstractRefinement::refinement_container_type& collection) {
+  // the indicators of all grid points with a missing child are computed in parallel,
+  // then the refinements_num largest ones are selected in the iteration order of the storage
+  // (as if addElementToCollection was called for each grid point)
+  std::vector<GridStorage::grid_map_iterator> iterators;
+  std::vector<AbstractRefinement::IndicatorEntry> entries;
+  computeIndicators(storage, functor, iterators, entries);
+  selectLargestIndicators(entries, functor.getRefinementsNum());
+
+  for (const AbstractRefinement::IndicatorEntry& entry : entries) {
+    collection.push_back(getIndicatorEntry(storage, iterators[entry.position], functor,
+                                           entry.entry));
   }
 }
 
@@ -124,11 +108,15 @@ void HashRefinementBoundaries::refineGridpointsCollection(GridStorage& storage,
     AbstractRefinement::refinement_container_type& collection) {
   double threshold = functor.getRefinementThreshold();
 
+  std::vector<size_t> refineIndices;
+
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     if (pair.second >= threshold) {
-      refineGridpoint(storage, pair.first->getSeq());
+      refineIndices.push_back(pair.first->getSeq());
     }
   }
+
+  refineGridpoints(storage, refineIndices);
 }
 
 void HashRefinementBoundaries::free_refine(GridStorage& storage,
@@ -345,8 +333,9 @@ void HashRefinementBoundaries::createGridpointLevelZeroConsistency(
             point.setLeaf(Leaf);
             createGridpoint(storage, point);
             point.setLeaf(saveLeaf);
-          } else {
+          } else if (!storage.isInsertionDeferred()) {
             // set stored index to Leaf from the left boundary
+            // (during deferred insertion, the leaf property is updated when inserting)
             storage.getPoint(storage.find(&point)->second).setLeaf(Leaf);
           }
         }
@@ -365,8 +354,9 @@ void HashRefinementBoundaries::createGridpointLevelZeroConsistency(
             point.setLeaf(Leaf);
             createGridpoint(storage, point);
             point.setLeaf(saveLeaf);
-          } else {
+          } else if (!storage.isInsertionDeferred()) {
             // set stored index to Leaf from the right boundary
+            // (during deferred insertion, the leaf property is updated when inserting)
             storage.getPoint(storage.find(&point)->second).setLeaf(Leaf);
           }
         }
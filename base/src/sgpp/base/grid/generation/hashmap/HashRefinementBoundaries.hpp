@@ -151,6 +151,16 @@ class HashRefinementBoundaries: public AbstractRefinement {
     GridStorage& storage,
     const GridStorage::grid_map_iterator& iter,
     const RefinementFunctor& functor) const override;
+
+  /**
+   * Checks whether a grid point has at least one missing child
+   * (grid points on level 0 have only one child on level 1).
+   *
+   * @param storage hashmap that stores the grid points
+   * @param point grid point (modified during the check, but restored on return)
+   * @return whether a child is missing in some dimension
+   */
+  bool hasMissingChild(GridStorage& storage, GridPoint& point) const override;
 };
 
 }  // namespace base
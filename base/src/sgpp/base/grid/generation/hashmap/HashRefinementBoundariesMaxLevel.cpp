@@ -149,6 +149,7 @@ void HashRefinementBoundariesMaxLevel::refineToMaxLevel(GridStorage& storage,
 
   // can refine grid on several points
   double threshold = functor.getRefinementThreshold();
+  std::vector<size_t> refineIndices;
 
   for (size_t i = 0; i < refinements_num; i++) {
     max_value = max_values[i];
@@ -157,12 +158,22 @@ void HashRefinementBoundariesMaxLevel::refineToMaxLevel(GridStorage& storage,
     // DEBUG
     // std::cout << "Num: " << i << " Max-value: " << max_value << std::endl;
     if (max_value != functor.start() && fabs(max_value) >= threshold) {
-      // DEBUG
-      // std::cout << "Start refining..." << std::endl;
-      refineGridpoint(storage, max_index, maxLevel);
+      refineIndices.push_back(max_index);
     }
   }
 
+  // refine in parallel if possible, the new grid points are inserted in the same order as
+  // if the grid points were refined one after another (see AbstractRefinement::refineGridpoints)
+  const bool parallel = canRefineInParallel();
+  storage.beginDeferredInsertion();
+
+#pragma omp parallel for schedule(static) if (parallel)
+  for (size_t i = 0; i < refineIndices.size(); i++) {
+    refineGridpoint(storage, refineIndices[i], maxLevel);
+  }
+
+  storage.endDeferredInsertion();
+
   delete[] max_values;
   delete[] max_indexes;
 }
@@ -133,13 +133,16 @@ void ForwardSelectorRefinement::refineGridpointsCollection(
 
   // check last sequence number
   size_t lastSeqNr = storage.getSize() - 1;
+  std::vector<size_t> refineIndices;
 
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     key = dynamic_cast<refinement_key_type*>(pair.first.get());
     GridPoint& point = key->getPoint();
-    this->refineGridpoint(storage, storage.getSequenceNumber(point));
+    refineIndices.push_back(storage.getSequenceNumber(point));
     // point.setLeaf(false); // this is done within refineGridpoint() already
   }
+
+  this->refineGridpoints(storage, refineIndices);
   // extend w1 and w2 vectors
   for (size_t seqNr = lastSeqNr + 1; seqNr < storage.getSize(); ++seqNr) {
     svmIndicator.update(storage.getPoint(seqNr));
@@ -131,6 +131,7 @@ void ImpurityRefinement::refineGridpointsCollection(
 
   // check last sequence number
   size_t lastSeqNr = storage.getSize() - 1;
+  std::vector<size_t> refineIndices;
 
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     key = dynamic_cast<refinement_key_type*>(pair.first.get());
@@ -139,10 +140,12 @@ void ImpurityRefinement::refineGridpointsCollection(
 
     // std::cout << "refine point: " << storage.getSequenceNumber(point) <<
     // std::endl;
-    this->refineGridpoint(storage, storage.getSequenceNumber(point));
+    refineIndices.push_back(storage.getSequenceNumber(point));
 
     point.setLeaf(false);
   }
+
+  this->refineGridpoints(storage, refineIndices);
   // for SVM learner -> extend w1 and w2 vectors
   if ((impurityIndicator.w1 != nullptr) && (impurityIndicator.w1 != nullptr) &&
       (impurityIndicator.alphas != nullptr)) {
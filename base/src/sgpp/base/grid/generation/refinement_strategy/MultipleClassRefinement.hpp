@@ -46,6 +46,8 @@ class MultipleClassRefinement : public HashRefinement {
 
  protected:
   void refineGridpoint(GridStorage& storage, size_t refine_index) override;
+  /// refineGridpoint() inserts into the grids of the classes, which are shared by all points
+  bool canRefineInParallel() const override { return false; }
   void collectRefinablePoints(GridStorage& storage,
         RefinementFunctor& functor,
         AbstractRefinement::refinement_container_type& collection) override;
@@ -130,16 +130,19 @@ void PredictiveRefinement::collectRefinablePoints(
 void PredictiveRefinement::refineGridpointsCollection(
   GridStorage& storage, RefinementFunctor& functor,
   AbstractRefinement::refinement_container_type& collection) {
-  PredictiveRefinementIndicator::value_type max_value;
-
   // now refine all grid points which satisfy the refinement criteria
+  // (in parallel, the new grid points are inserted in the order of the collection,
+  // see AbstractRefinement::refineGridpoints)
   double threshold = functor.getRefinementThreshold();
-  refinement_key_type* key;
+  const double start = functor.start();
+  storage.beginDeferredInsertion();
 
-  for (AbstractRefinement::refinement_pair_type& pair : collection) {
-    key = dynamic_cast<refinement_key_type*>(pair.first.get());
+#pragma omp parallel for schedule(static) if (canRefineInParallel())
+  for (size_t i = 0; i < collection.size(); i++) {
+    AbstractRefinement::refinement_pair_type& pair = collection[i];
+    refinement_key_type* key = dynamic_cast<refinement_key_type*>(pair.first.get());
 
-    if (pair.second > functor.start() && pair.second >= threshold) {
+    if (pair.second > start && pair.second >= threshold) {
       this->refineGridpoint1D(storage, key->getPoint(), key->getDim());
       key->getPoint().setLeaf(false);
     }
@@ -147,6 +150,8 @@ void PredictiveRefinement::refineGridpointsCollection(
     // delete key;
   }
 
+  storage.endDeferredInsertion();
+
   collection.empty();
 }
 
@@ -150,6 +150,15 @@ class RefinementDecorator: public AbstractRefinement {
     const GridStorage::grid_map_iterator& iter,
     const RefinementFunctor& functor) const;
 
+  /**
+   * Whether the decorated refinement may refine grid points in parallel
+   *
+   * @return true if the decorated refinement may refine in parallel
+   */
+  virtual bool canRefineInParallel() const {
+    return decorated_refinement_->canRefineInParallel();
+  }
+
  private:
   AbstractRefinement* decorated_refinement_;
 };
@@ -11,6 +11,9 @@
 
 #include <algorithm>
 #include <iostream>
+#include <map>
+#include <numeric>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -89,81 +92,50 @@ void SubspaceRefinement::collectRefinablePoints(GridStorage& storage,
 
   size_t refinements_num = functor.getRefinementsNum();
 
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
+  // compute the indicators of all grid points with a missing child in parallel
+  std::vector<GridStorage::grid_map_iterator> iterators;
+  std::vector<AbstractRefinement::IndicatorEntry> entries;
+  computeIndicators(storage, functor, iterators, entries);
 
+  // sum up the indicators per subspace in the iteration order of the storage
+  // (as addElementToCollection, but the subspaces are looked up by their level vector
+  // instead of searching the whole collection)
+  std::map<std::vector<level_t>, size_t> subspaces;
+  std::vector<level_t> level_vector(storage.getDimension());
 
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin();
-       iter != end_iter; iter++) {
-    point = *(iter->first);
+  for (const AbstractRefinement::IndicatorEntry& entry : entries) {
+    if (entry.value == 0) continue;
 
-    // std::cout <<"grid point " << iter->second << std::endl;
+    const GridPoint& point = *(iterators[entry.position]->first);
 
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
     for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // std::cout << "processing dimension " << d << std::endl;
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
-
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter,
-                       functor);
-
-        // std::cout << "size of the list " << current_value_list.empty() <<
-        // std::endl;
-
-        addElementToCollection(iter, current_value_list,
-                               refinements_num, collection);
-        break;
-      }
-
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter,
-                       functor);
+      level_vector[d] = point.getLevel(d);
+    }
 
-        addElementToCollection(iter, current_value_list,
-                               refinements_num, collection);
-        break;
-      }
+    auto subspace = subspaces.find(level_vector);
 
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
+    if (subspace != subspaces.end()) {
+      // subspace with this level is already in collection,
+      // hence increase the value
+      collection[subspace->second].second += entry.value;
+    } else {
+      // subspace is not yet in the collection, hence add it
+      subspaces.emplace(level_vector, collection.size());
+      collection.push_back(getIndicatorEntry(storage, iterators[entry.position], functor,
+                                             entry.entry));
     }
   }
 
+  if (collection.size() > refinements_num) {
+    // nth_element makes sure that the first refinements_num elements in the
+    // vector are larger then the rest
+    std::nth_element(collection.begin(),
+                     collection.begin() + refinements_num,
+                     collection.end(), AbstractRefinement::compare_pairs);
 
-
-
-  // nth_element makes sure that the first refinements_num elements in the
-  // vector are larger then the rest
-  std::nth_element(collection.begin(),
-                   collection.begin() + refinements_num,
-                   collection.end(), AbstractRefinement::compare_pairs);
-
-  if (collection.size() >= refinements_num) {
     // clear the collection and populate it only with those elements
     // that will be refined
-    for (size_t diff = collection.size() - refinements_num; diff > 0; diff--) {
-      collection.pop_back();
-    }
+    collection.resize(refinements_num);
   }
 }
 
@@ -173,11 +145,30 @@ void SubspaceRefinement::refineGridpointsCollection(GridStorage& storage,
     AbstractRefinement::refinement_container_type& collection) {
 
   HashGridPoint grid_index(storage.getDimension());
+  std::vector<size_t> refineIndices;
+
+  // refine coarser subspaces first, as their refinement may create points of the finer
+  // subspaces in the collection (which are then refined, too)
+  std::vector<std::pair<std::vector<level_t>, level_t>> subspaces;
 
-  // refine all points of the subspace in all dimensions
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     const std::vector<level_t> level_vector = pair.first->getLevelVector();
+    subspaces.emplace_back(level_vector,
+                           std::accumulate(level_vector.begin(), level_vector.end(), level_t{0}));
+  }
+
+  std::sort(subspaces.begin(), subspaces.end(),
+            [](const std::pair<std::vector<level_t>, level_t>& lhs,
+               const std::pair<std::vector<level_t>, level_t>& rhs) {
+              return (lhs.second < rhs.second) ||
+                     ((lhs.second == rhs.second) && (lhs.first < rhs.first));
+            });
+
+  // refine all points of the subspace in all dimensions
+  for (const std::pair<std::vector<level_t>, level_t>& levelSubspace : subspaces) {
+    const std::vector<level_t>& level_vector = levelSubspace.first;
     IndexInSubspaceGenerator subspace(level_vector);
+    refineIndices.clear();
 
     for (IndexInSubspaceGenerator::iterator index_it = subspace.begin();
          index_it != subspace.end(); index_it++) {
@@ -188,9 +179,13 @@ void SubspaceRefinement::refineGridpointsCollection(GridStorage& storage,
       const size_t seq = storage.getSequenceNumber(grid_index);
 
       if (seq < storage.getSize()) {
-        refineGridpoint(storage, seq);
+        refineIndices.push_back(seq);
       }
     }
+
+    // one batch per subspace: refining a subspace may create points of the subspaces that
+    // are refined afterwards, which have to be inserted before they are looked up
+    refineGridpoints(storage, refineIndices);
   }
 }
 
@@ -72,7 +72,10 @@ class SubspaceRefinement: public RefinementDecorator {
 
 
   /**
-   * Extends the grid adding elements defined in collection
+   * Extends the grid adding elements defined in collection. The subspaces are refined one after
+   * another in the order of their level sums (with one batch of refined grid points per
+   * subspace, see AbstractRefinement::refineGridpoints()), so that grid points of a subspace that
+   * are created by refining a coarser subspace are refined, too.
    *
    * @param storage hashmap that stores the grid points
    * @param functor a PredictiveRefinementIndicator specifying the refinement criteria
@@ -66,6 +66,16 @@ HashGridIterator::resetToRightLevelZero(size_t dim) {
   this->seq_ = storage.getSequenceNumber(index);
 }
 
+void
+HashGridIterator::resetToLevelOne() {
+  for (size_t i = 0; i < storage.getDimension(); i++) {
+    index.push(i, 1, 1);
+  }
+
+  index.rehash();
+  this->seq_ = storage.getSequenceNumber(index);
+}
+
 void
 HashGridIterator::resetToLevelOne(size_t d) {
   index.set(d, 1, 1);
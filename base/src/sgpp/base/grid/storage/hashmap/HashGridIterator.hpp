@@ -73,6 +73,11 @@ class HashGridIterator {
    */
   void resetToRightLevelZero(size_t dim);
 
+  /**
+   *  Sets 1,1 in every dimension, i.e., resets the iterator to the state after construction
+   */
+  void resetToLevelOne();
+
   /**
    * resets the iterator to the top if dimension d
    *
@@ -21,23 +21,19 @@ namespace sgpp {
 namespace base {
 
 HashGridPoint::HashGridPoint(size_t dimension)
-    : dimension(dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+    : dimension(dimension), level(nullptr), index(nullptr), hash(0) {
+  allocate();
   leaf = false;
 }
 
 HashGridPoint::HashGridPoint()
-    : dimension(0), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
+    : dimension(0), level(nullptr), index(nullptr), hash(0) {
   leaf = false;
 }
 
 HashGridPoint::HashGridPoint(const HashGridPoint& o)
-    : dimension(o.dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+    : dimension(o.dimension), level(nullptr), index(nullptr), hash(0) {
+  allocate();
   leaf = false;
 
   for (size_t d = 0; d < dimension; d++) {
@@ -50,14 +46,12 @@ HashGridPoint::HashGridPoint(const HashGridPoint& o)
 }
 
 HashGridPoint::HashGridPoint(std::istream& istream, int version)
-    : dimension(0), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
+    : dimension(0), level(nullptr), index(nullptr), hash(0) {
   size_t temp_leaf;
 
   istream >> dimension;
 
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+  allocate();
   leaf = false;
 
   for (size_t d = 0; d < dimension; d++) {
@@ -92,17 +86,15 @@ HashGridPoint::HashGridPoint(std::istream& istream, int version)
  * Destructor
  */
 HashGridPoint::~HashGridPoint() {
-  if (level) {
-    delete[] level;
-  }
-
-  if (index) {
-    delete[] index;
-  }
+  // index points into the same allocation
+  delete[] level;
+}
 
-  if (hInv) {
-    delete[] hInv;
-  }
+void HashGridPoint::allocate() {
+  // levels and indices are stored contiguously in one allocation
+  // (the mesh widths 1 << level[d] are computed on the fly)
+  level = new level_type[2 * dimension];
+  index = level + dimension;
 }
 
 void HashGridPoint::serialize(std::ostream& ostream, int version) {
@@ -152,8 +144,7 @@ void HashGridPoint::rehash() {
   size_t hash = 0xdeadbeef;
 
   for (size_t d = 0; d < dimension; d++) {
-    hInv[d] = static_cast<index_type>(1) << level[d];
-    hash = hInv[d] + index[d] + hash * 65599;
+    hash = (static_cast<index_type>(1) << level[d]) + index[d] + hash * 65599;
   }
 
   this->hash = hash;
@@ -185,23 +176,9 @@ HashGridPoint& HashGridPoint::operator=(const HashGridPoint& rhs) {
   }
 
   if (dimension != rhs.dimension) {
-    if (level) {
-      delete[] level;
-    }
-
-    if (index) {
-      delete[] index;
-    }
-
-    if (hInv) {
-      delete[] hInv;
-    }
-
+    delete[] level;
     dimension = rhs.dimension;
-
-    level = new level_type[dimension];
-    index = new index_type[dimension];
-    hInv = new index_type[dimension];
+    allocate();
   }
 
   for (size_t d = 0; d < dimension; d++) {
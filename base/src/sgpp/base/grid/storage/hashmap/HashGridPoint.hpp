@@ -195,7 +195,8 @@ class HashGridPoint {
    */
   inline double getStandardCoordinate(size_t d) const {
     // cast 1 to index_type to ensure that 1 << level[d] doesn't overflow
-    return static_cast<double>(index[d]) / static_cast<double>(hInv[d]);
+    return static_cast<double>(index[d]) /
+           static_cast<double>(static_cast<index_type>(1) << level[d]);
   }
 
   /**
@@ -216,7 +217,7 @@ class HashGridPoint {
   bool isInnerPoint() const;
 
   /**
-   * rehashs the current gridpoint and sets hInv
+   * rehashs the current gridpoint
    */
   void rehash();
 
@@ -448,14 +449,18 @@ class HashGridPoint {
   bool isHierarchicalAncestor(HashGridPoint& gpj, size_t dim);
 
  private:
+  /**
+   * Allocates level and index for the current dimension as
+   * one contiguous block (level points to the beginning of the block).
+   */
+  void allocate();
+
   /// the dimension of the gridpoint
   size_t dimension;
   /// pointer to array that stores the ansatzfunctions' level
   level_type* level;
   /// pointer to array that stores the ansatzfunctions' indices
   index_type* index;
-  /// pointer to array that stores the mesh widths (1 << level[d] for each dimension)
-  index_type* hInv;
   /// stores if this gridpoint is a leaf
   bool leaf;
   /// stores the hashvalue of the gridpoint
@@ -0,0 +1,440 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef HASHGRIDPOINTMAP_HPP
+#define HASHGRIDPOINTMAP_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Flat open-addressing hash map from grid points to sequence numbers.
+ *
+ * This replaces the node-based std::unordered_map formerly used by HashGridStorage.
+ * All entries are stored in one contiguous array of slots (linear probing,
+ * backward-shift deletion, power-of-two capacity), which avoids one heap allocation
+ * per grid point and the bucket/node indirections on every lookup.
+ * Each slot caches the hash value of its grid point, so the grid point itself
+ * is only dereferenced if the hash values match.
+ *
+ * The interface is the subset of std::unordered_map that is used throughout SG++
+ * (find, operator[], erase, begin/end, size, clear). As for std::unordered_map,
+ * inserting a new key may invalidate all iterators.
+ */
+class HashGridPointMap {
+ public:
+  /// key type
+  typedef HashGridPoint* key_type;
+  /// mapped type (sequence number)
+  typedef size_t mapped_type;
+  /// value type, iterators point to objects of this type
+  typedef std::pair<HashGridPoint*, size_t> value_type;
+  /// size type
+  typedef size_t size_type;
+
+ protected:
+  /// slot of the hash table, the slot is empty if entry.first is a null pointer
+  struct Slot {
+    /// key and sequence number
+    value_type entry;
+    /// cached hash value of the key
+    size_t hash;
+  };
+
+  /**
+   * Iterator over the occupied slots of the hash table.
+   *
+   * @tparam SlotType   Slot or const Slot
+   * @tparam ValueType  value_type or const value_type
+   */
+  template <class SlotType, class ValueType>
+  class SlotIterator {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef ValueType value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef ValueType* pointer;
+    typedef ValueType& reference;
+
+    SlotIterator() : slot(nullptr), last(nullptr) {}
+
+    SlotIterator(SlotType* slot, SlotType* last) : slot(slot), last(last) { skipEmpty(); }
+
+    /// conversion from iterator to const_iterator
+    template <class OtherSlotType, class OtherValueType>
+    SlotIterator(const SlotIterator<OtherSlotType, OtherValueType>& other)  // NOLINT
+        : slot(other.slot), last(other.last) {}
+
+    reference operator*() const { return slot->entry; }
+    pointer operator->() const { return &slot->entry; }
+
+    SlotIterator& operator++() {
+      ++slot;
+      skipEmpty();
+      return *this;
+    }
+
+    SlotIterator operator++(int) {
+      SlotIterator result(*this);
+      ++(*this);
+      return result;
+    }
+
+    template <class OtherSlotType, class OtherValueType>
+    bool operator==(const SlotIterator<OtherSlotType, OtherValueType>& other) const {
+      return slot == other.slot;
+    }
+
+    template <class OtherSlotType, class OtherValueType>
+    bool operator!=(const SlotIterator<OtherSlotType, OtherValueType>& other) const {
+      return slot != other.slot;
+    }
+
+   private:
+    template <class, class>
+    friend class SlotIterator;
+    friend class HashGridPointMap;
+
+    void skipEmpty() {
+      while ((slot != last) && (slot->entry.first == nullptr)) {
+        ++slot;
+      }
+    }
+
+    /// current slot
+    SlotType* slot;
+    /// one past the last slot
+    SlotType* last;
+  };
+
+ public:
+  /// iterator
+  typedef SlotIterator<Slot, value_type> iterator;
+  /// const iterator
+  typedef SlotIterator<const Slot, const value_type> const_iterator;
+
+  /**
+   * Constructor, creates an empty map.
+   */
+  HashGridPointMap() : slots(), numberOfEntries(0), shift(SIZE_BITS) {}
+
+  /**
+   * @return number of entries
+   */
+  inline size_t size() const { return numberOfEntries; }
+
+  /**
+   * @return whether the map is empty
+   */
+  inline bool empty() const { return numberOfEntries == 0; }
+
+  /**
+   * @return number of slots of the hash table
+   */
+  inline size_t capacity() const { return slots.size(); }
+
+  /**
+   * Removes all entries and frees the hash table.
+   */
+  void clear() {
+    std::vector<Slot>().swap(slots);
+    numberOfEntries = 0;
+    shift = SIZE_BITS;
+  }
+
+  /**
+   * Ensures that the map can hold at least n entries without rehashing.
+   *
+   * @param n   number of entries
+   */
+  void reserve(size_t n) {
+    size_t newCapacity = MIN_CAPACITY;
+
+    while (newCapacity * MAX_LOAD_NUMERATOR < n * MAX_LOAD_DENOMINATOR) {
+      newCapacity *= 2;
+    }
+
+    if (newCapacity > slots.size()) {
+      rehash(newCapacity);
+    }
+  }
+
+  inline iterator begin() {
+    return iterator(slots.data(), slots.data() + slots.size());
+  }
+
+  inline iterator end() {
+    return iterator(slots.data() + slots.size(), slots.data() + slots.size());
+  }
+
+  inline const_iterator begin() const {
+    return const_iterator(slots.data(), slots.data() + slots.size());
+  }
+
+  inline const_iterator end() const {
+    return const_iterator(slots.data() + slots.size(), slots.data() + slots.size());
+  }
+
+  /**
+   * Searches for a grid point.
+   *
+   * @param key   grid point to search for (compared by level and index)
+   * @return      iterator to the entry if found, end() otherwise
+   */
+  inline iterator find(const HashGridPoint* key) {
+    const size_t pos = findSlot(key);
+    Slot* last = slots.data() + slots.size();
+    return (pos == NOT_FOUND) ? iterator(last, last) : iterator(slots.data() + pos, last);
+  }
+
+  /**
+   * Searches for a grid point.
+   *
+   * @param key   grid point to search for (compared by level and index)
+   * @return      iterator to the entry if found, end() otherwise
+   */
+  inline const_iterator find(const HashGridPoint* key) const {
+    const size_t pos = findSlot(key);
+    const Slot* last = slots.data() + slots.size();
+    return (pos == NOT_FOUND) ? const_iterator(last, last)
+                              : const_iterator(slots.data() + pos, last);
+  }
+
+  /**
+   * Searches for a grid point, comparing the candidates with the given predicate
+   * instead of the stored grid points (e.g., to compare with a packed copy of
+   * their levels and indices, see HashGridStorage).
+   *
+   * @param key       grid point to search for (only its hash value is used)
+   * @param keyEqual  predicate called with an entry whose cached hash value matches,
+   *                  returns whether the entry is the key
+   * @return          iterator to the entry if found, end() otherwise
+   */
+  template <class KeyEqual>
+  inline iterator find(const HashGridPoint* key, const KeyEqual& keyEqual) {
+    const size_t pos = findSlot(key, keyEqual);
+    Slot* last = slots.data() + slots.size();
+    return (pos == NOT_FOUND) ? iterator(last, last) : iterator(slots.data() + pos, last);
+  }
+
+  /**
+   * Searches for a grid point, comparing the candidates with the given predicate.
+   *
+   * @param key       grid point to search for (only its hash value is used)
+   * @param keyEqual  predicate called with an entry whose cached hash value matches,
+   *                  returns whether the entry is the key
+   * @return          iterator to the entry if found, end() otherwise
+   */
+  template <class KeyEqual>
+  inline const_iterator find(const HashGridPoint* key, const KeyEqual& keyEqual) const {
+    const size_t pos = findSlot(key, keyEqual);
+    const Slot* last = slots.data() + slots.size();
+    return (pos == NOT_FOUND) ? const_iterator(last, last)
+                              : const_iterator(slots.data() + pos, last);
+  }
+
+  /**
+   * @param key   grid point to search for
+   * @return      1 if the grid point is contained, 0 otherwise
+   */
+  inline size_t count(const HashGridPoint* key) const {
+    return (findSlot(key) == NOT_FOUND) ? 0 : 1;
+  }
+
+  /**
+   * Returns the sequence number of a grid point, inserting the grid point
+   * (with sequence number 0) if it is not contained yet.
+   * Note that the map stores the pointer, i.e., the grid point has to
+   * outlive its entry.
+   *
+   * @param key   grid point
+   * @return      reference to the sequence number of the grid point
+   */
+  size_t& operator[](HashGridPoint* key) {
+    const size_t keyHash = key->getHash();
+
+    if (!slots.empty()) {
+      const size_t mask = slots.size() - 1;
+
+      for (size_t pos = homeSlot(keyHash);; pos = (pos + 1) & mask) {
+        Slot& slot = slots[pos];
+
+        if (slot.entry.first == nullptr) {
+          break;
+        } else if ((slot.hash == keyHash) && slot.entry.first->equals(*key)) {
+          return slot.entry.second;
+        }
+      }
+    }
+
+    if ((numberOfEntries + 1) * MAX_LOAD_DENOMINATOR > slots.size() * MAX_LOAD_NUMERATOR) {
+      rehash((slots.size() == 0) ? MIN_CAPACITY : 2 * slots.size());
+    }
+
+    numberOfEntries++;
+    return insertUnique(key, keyHash, 0).entry.second;
+  }
+
+  /**
+   * Removes a grid point from the map.
+   *
+   * @param key   grid point to remove (compared by level and index)
+   * @return      number of removed entries (0 or 1)
+   */
+  size_t erase(const HashGridPoint* key) {
+    size_t pos = findSlot(key);
+
+    if (pos == NOT_FOUND) {
+      return 0;
+    }
+
+    // backward-shift deletion: move subsequent entries of the same probe
+    // sequence into the hole, so that no tombstones are needed
+    const size_t mask = slots.size() - 1;
+    size_t next = (pos + 1) & mask;
+
+    while (slots[next].entry.first != nullptr) {
+      const size_t home = homeSlot(slots[next].hash);
+
+      // move the entry if its home slot is not in the cyclic range (pos, next]
+      if (((next - home) & mask) >= ((next - pos) & mask)) {
+        slots[pos] = slots[next];
+        pos = next;
+      }
+
+      next = (next + 1) & mask;
+    }
+
+    slots[pos].entry.first = nullptr;
+    numberOfEntries--;
+    return 1;
+  }
+
+ protected:
+  /// number of bits of size_t
+  static const size_t SIZE_BITS = 8 * sizeof(size_t);
+  /// minimal non-zero number of slots
+  static const size_t MIN_CAPACITY = 16;
+  /// maximal load factor (numerator)
+  static const size_t MAX_LOAD_NUMERATOR = 7;
+  /// maximal load factor (denominator)
+  static const size_t MAX_LOAD_DENOMINATOR = 10;
+  /// return value of findSlot if the key is not contained
+  static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+  /**
+   * Maps a hash value to its preferred slot (Fibonacci hashing, as the low bits of
+   * HashGridPoint::getHash are not well distributed).
+   *
+   * @param keyHash   hash value
+   * @return          index of the preferred slot
+   */
+  inline size_t homeSlot(size_t keyHash) const {
+    return (shift >= SIZE_BITS)
+               ? 0
+               : static_cast<size_t>((static_cast<uint64_t>(keyHash) * 0x9E3779B97F4A7C15ULL) >>
+                                     shift);
+  }
+
+  /**
+   * @param key   grid point to search for
+   * @return      index of the slot containing the grid point or NOT_FOUND
+   */
+  inline size_t findSlot(const HashGridPoint* key) const {
+    return findSlot(key, [key](const value_type& entry) { return entry.first->equals(*key); });
+  }
+
+  /**
+   * @param key       grid point to search for
+   * @param keyEqual  predicate called with the entries whose hash values match the key's
+   * @return          index of the slot containing the grid point or NOT_FOUND
+   */
+  template <class KeyEqual>
+  inline size_t findSlot(const HashGridPoint* key, const KeyEqual& keyEqual) const {
+    if (numberOfEntries == 0) {
+      return NOT_FOUND;
+    }
+
+    const size_t keyHash = key->getHash();
+    const size_t mask = slots.size() - 1;
+
+    for (size_t pos = homeSlot(keyHash);; pos = (pos + 1) & mask) {
+      const Slot& slot = slots[pos];
+
+      if (slot.entry.first == nullptr) {
+        return NOT_FOUND;
+      } else if ((slot.hash == keyHash) && keyEqual(slot.entry)) {
+        return pos;
+      }
+    }
+  }
+
+  /**
+   * Inserts a key which is known not to be contained, without checking the load factor.
+   *
+   * @param key       grid point
+   * @param keyHash   hash value of the grid point
+   * @param seq       sequence number
+   * @return          slot the key was inserted into
+   */
+  inline Slot& insertUnique(HashGridPoint* key, size_t keyHash, size_t seq) {
+    const size_t mask = slots.size() - 1;
+    size_t pos = homeSlot(keyHash);
+
+    while (slots[pos].entry.first != nullptr) {
+      pos = (pos + 1) & mask;
+    }
+
+    Slot& slot = slots[pos];
+    slot.entry.first = key;
+    slot.entry.second = seq;
+    slot.hash = keyHash;
+    return slot;
+  }
+
+  /**
+   * Resizes the hash table and reinserts all entries.
+   *
+   * @param newCapacity   new number of slots (power of two)
+   */
+  void rehash(size_t newCapacity) {
+    std::vector<Slot> oldSlots(newCapacity, Slot{value_type(nullptr, 0), 0});
+    oldSlots.swap(slots);
+
+    shift = SIZE_BITS;
+
+    for (size_t c = newCapacity; c > 1; c /= 2) {
+      shift--;
+    }
+
+    for (const Slot& slot : oldSlots) {
+      if (slot.entry.first != nullptr) {
+        insertUnique(slot.entry.first, slot.hash, slot.entry.second);
+      }
+    }
+  }
+
+  /// slots of the hash table
+  std::vector<Slot> slots;
+  /// number of occupied slots
+  size_t numberOfEntries;
+  /// shift for homeSlot, i.e., number of bits of size_t minus log2 of the capacity
+  size_t shift;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* HASHGRIDPOINTMAP_HPP */
@@ -7,17 +7,23 @@
 
 #include <sgpp/base/exception/generation_exception.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <exception>
 #include <list>
 #include <memory>
 #include <string>
 #include <typeinfo>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
 namespace base {
 
+const size_t HashGridStorage::DEFERRED_SEQUENCE_NUMBER;
+
 HashGridStorage::HashGridStorage(size_t dimension)
     :  //  GridStorage(dim),
       dimension(dimension),
@@ -149,10 +155,14 @@ void HashGridStorage::clear() {
     delete *iter;
   }
 
+  modificationCount++;
+
   // remove all elements from hashmap
   map.clear();
   // remove all list entries
   list.clear();
+  packedLevels.clear();
+  packedIndices.clear();
 }
 
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
@@ -160,6 +170,8 @@ std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoint
   std::vector<size_t> remainingPoints;
   size_t delCounter = 0;
 
+  modificationCount++;
+
   // sort list
   removePoints.sort();
 
@@ -194,6 +206,8 @@ std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoint
     map[curPoint] = i;
   }
 
+  rebuildPacked();
+
   // reset the whole grid's leaf property in order
   // to guarantee a consistent grid
   recalcLeafProperty();
@@ -273,6 +287,8 @@ void HashGridStorage::toString(std::ostream& stream) const {
 
 size_t HashGridStorage::getSize() const { return map.size(); }
 
+size_t HashGridStorage::getModificationCount() const { return modificationCount; }
+
 size_t HashGridStorage::getNumberOfInnerPoints() const {
   size_t innerPoints = 0;
 
@@ -286,8 +302,20 @@ size_t HashGridStorage::getNumberOfInnerPoints() const {
 size_t HashGridStorage::getDimension() const { return dimension; }
 
 size_t HashGridStorage::insert(const point_type& index) {
+  if (deferredInsertion) {
+    // the sequence number is only known after endDeferredInsertion()
+#ifdef _OPENMP
+    deferredPoints[omp_get_thread_num()]->insert(index);
+#else
+    deferredPoints[0]->insert(index);
+#endif
+    return DEFERRED_SEQUENCE_NUMBER;
+  }
+
+  modificationCount++;
   point_pointer insert = new HashGridPoint(index);
   list.push_back(insert);
+  appendPacked(*insert);
   return (map[insert] = list.size() - 1);
 }
 
@@ -298,7 +326,10 @@ void HashGridStorage::insert(point_type& index, std::vector<size_t>& insertedPoi
   if (!isContaining(index)) {
     // insert the current node
     size_t i = insert(index);
-    insertedPoints.push_back(i);
+
+    if (!deferredInsertion) {
+      insertedPoints.push_back(i);
+    }
 
     // insert all ancestors if they are missing
     for (size_t d = 0; d < dimension; d++) {
@@ -322,8 +353,227 @@ void HashGridStorage::insert(point_type& index, std::vector<size_t>& insertedPoi
   }
 }
 
+void HashGridStorage::insert(const point_type::level_type* levels,
+                             const point_type::index_type* indices, const uint8_t* leaves,
+                             size_t numberOfPoints) {
+  modificationCount++;
+  list.reserve(list.size() + numberOfPoints);
+  map.reserve(map.size() + numberOfPoints);
+  packedLevels.reserve(packedLevels.size() + numberOfPoints * dimension);
+  packedIndices.reserve(packedIndices.size() + numberOfPoints * dimension);
+
+  for (size_t k = 0; k < numberOfPoints; k++) {
+    point_pointer insert = new HashGridPoint(dimension);
+
+    for (size_t d = 0; d < dimension; d++) {
+      insert->push(d, levels[k * dimension + d], indices[k * dimension + d]);
+    }
+
+    insert->setLeaf((leaves != nullptr) && (leaves[k] != 0));
+    insert->rehash();
+
+    const size_t oldSize = map.size();
+    size_t& seq = map[insert];
+
+    if (map.size() == oldSize) {
+      delete insert;
+      throw generation_exception("HashGridStorage::insert : grid point is already contained");
+    }
+
+    list.push_back(insert);
+    appendPacked(*insert);
+    seq = list.size() - 1;
+  }
+}
+
+size_t HashGridStorage::insertPoints(const std::vector<point_type>& points,
+                                     std::vector<size_t>* insertedPoints) {
+  const size_t numberOfPoints = points.size();
+  std::vector<point_pointer> newPoints(numberOfPoints, nullptr);
+
+  // copy and hash the points, skip those already contained in the storage
+#pragma omp parallel for schedule(static)
+  for (size_t k = 0; k < numberOfPoints; k++) {
+    point_pointer insert = new HashGridPoint(points[k]);
+    insert->rehash();
+
+    if (find(insert) == map.end()) {
+      newPoints[k] = insert;
+    } else {
+      delete insert;
+    }
+  }
+
+  // append the new points in the given order, skip repeated points
+  const size_t oldSize = list.size();
+
+  for (size_t k = 0; k < numberOfPoints; k++) {
+    if (newPoints[k] != nullptr) {
+      const size_t mapSize = map.size();
+      size_t& seq = map[newPoints[k]];
+
+      if (map.size() == mapSize) {
+        delete newPoints[k];
+      } else {
+        list.push_back(newPoints[k]);
+        appendPacked(*newPoints[k]);
+        seq = list.size() - 1;
+      }
+    }
+  }
+
+  const size_t newSize = list.size();
+  std::vector<size_t> parents;
+
+  if (newSize > oldSize) {
+    modificationCount++;
+  }
+
+  // leaf property of the new points, collect the old points that are parents of new points
+#pragma omp parallel
+  {
+    std::vector<size_t> threadParents;
+
+#pragma omp for schedule(static)
+    for (size_t seq = oldSize; seq < newSize; seq++) {
+      HashGridPoint point(*list[seq]);
+      bool isLeaf = true;
+
+      for (size_t d = 0; d < dimension; d++) {
+        point_type::level_type l;
+        point_type::index_type i;
+        point.get(d, l, i);
+
+        if (l > 0) {
+          // children
+          point.getLeftChild(d);
+          isLeaf = isLeaf && (find(&point) == map.end());
+          point.set(d, l, i);
+          point.getRightChild(d);
+          isLeaf = isLeaf && (find(&point) == map.end());
+
+          // parents (the points on level 0 are the parents of the point on level 1)
+          if (l > 1) {
+            point.set(d, l, i);
+            point.getParent(d);
+            grid_map_const_iterator iter = find(&point);
+
+            if ((iter != map.end()) && (iter->second < oldSize)) {
+              threadParents.push_back(iter->second);
+            }
+          } else {
+            for (point_type::index_type boundaryIndex = 0; boundaryIndex < 2; boundaryIndex++) {
+              point.set(d, 0, boundaryIndex);
+              grid_map_const_iterator iter = find(&point);
+
+              if ((iter != map.end()) && (iter->second < oldSize)) {
+                threadParents.push_back(iter->second);
+              }
+            }
+          }
+        } else {
+          point.set(d, 1, 1);
+          isLeaf = isLeaf && (find(&point) == map.end());
+        }
+
+        point.set(d, l, i);
+      }
+
+      list[seq]->setLeaf(isLeaf);
+    }
+
+#pragma omp critical
+    parents.insert(parents.end(), threadParents.begin(), threadParents.end());
+  }
+
+  for (size_t seq : parents) {
+    list[seq]->setLeaf(false);
+  }
+
+  if (insertedPoints != nullptr) {
+    for (size_t seq = oldSize; seq < newSize; seq++) {
+      insertedPoints->push_back(seq);
+    }
+  }
+
+  return newSize - oldSize;
+}
+
+void HashGridStorage::beginDeferredInsertion() {
+  if (deferredInsertion) {
+    throw generation_exception(
+        "HashGridStorage::beginDeferredInsertion : deferred insertion already started");
+  }
+
+#ifdef _OPENMP
+  const size_t numberOfThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t numberOfThreads = 1;
+#endif
+
+  deferredPoints.clear();
+
+  for (size_t t = 0; t < numberOfThreads; t++) {
+    deferredPoints.emplace_back(new HashGridStorage(dimension));
+  }
+
+  deferredInsertion = true;
+}
+
+size_t HashGridStorage::endDeferredInsertion(std::vector<size_t>* insertedPoints) {
+  if (!deferredInsertion) {
+    throw generation_exception(
+        "HashGridStorage::endDeferredInsertion : deferred insertion not started");
+  }
+
+  deferredInsertion = false;
+  std::vector<point_type> points;
+
+  for (const std::unique_ptr<HashGridStorage>& buffer : deferredPoints) {
+    for (size_t k = 0; k < buffer->getSize(); k++) {
+      points.push_back(buffer->getPoint(k));
+    }
+  }
+
+  deferredPoints.clear();
+  return insertPoints(points, insertedPoints);
+}
+
+bool HashGridStorage::isContainingDeferred(HashGridPoint& index) const {
+#ifdef _OPENMP
+  return deferredPoints[omp_get_thread_num()]->isContaining(index);
+#else
+  return deferredPoints[0]->isContaining(index);
+#endif
+}
+
+void HashGridStorage::appendPacked(const HashGridPoint& index) {
+  // 8 bits suffice for the levels, as the 32-bit indices limit the levels to 31 anyway
+  for (size_t d = 0; d < dimension; d++) {
+    packedLevels.push_back(static_cast<packed_level_type>(index.getLevel(d)));
+    packedIndices.push_back(index.getIndex(d));
+  }
+}
+
+void HashGridStorage::setPacked(const HashGridPoint& index, size_t seq) {
+  for (size_t d = 0; d < dimension; d++) {
+    packedLevels[seq * dimension + d] = static_cast<packed_level_type>(index.getLevel(d));
+    packedIndices[seq * dimension + d] = index.getIndex(d);
+  }
+}
+
+void HashGridStorage::rebuildPacked() {
+  packedLevels.clear();
+  packedIndices.clear();
+
+  for (const point_pointer& index : list) {
+    appendPacked(*index);
+  }
+}
+
 void HashGridStorage::update(point_type& index, size_t pos) {
   if (pos < list.size()) {
+    modificationCount++;
     // Remove old element at pos
     point_pointer del = list[pos];
     map.erase(del);
@@ -331,14 +581,31 @@ void HashGridStorage::update(point_type& index, size_t pos) {
     // Insert update
     point_pointer insert = new HashGridPoint(index);
     list[pos] = insert;
+    setPacked(*insert, pos);
     map[insert] = pos;
   }
 }
 
+void HashGridStorage::swapPoints(HashGridStorage& other) {
+  if (other.dimension != dimension) {
+    throw generation_exception("HashGridStorage::swapPoints : dimensions do not match");
+  }
+
+  std::swap(list, other.list);
+  std::swap(map, other.map);
+  std::swap(packedLevels, other.packedLevels);
+  std::swap(packedIndices, other.packedIndices);
+  modificationCount++;
+  other.modificationCount++;
+}
+
 void HashGridStorage::deleteLast() {
+  modificationCount++;
   point_pointer del = list.back();
   map.erase(del);
   list.pop_back();
+  packedLevels.resize(list.size() * dimension);
+  packedIndices.resize(list.size() * dimension);
   delete del;
 }
 
@@ -440,7 +707,8 @@ void HashGridStorage::getLevelIndexArraysForEval(DataMatrix& level, DataMatrix&
   //      #pragma omp for schedule (static) private(curLevel, curIndex)
   for (size_t i = 0; i < list.size(); i++) {
     for (size_t current_dim = 0; current_dim < dimension; current_dim++) {
-      (list[i])->get(current_dim, curLevel, curIndex);
+      curLevel = packedLevels[i * dimension + current_dim];
+      curIndex = packedIndices[i * dimension + current_dim];
       level.set(i, current_dim, static_cast<double>(1 << curLevel));
       index.set(i, current_dim, static_cast<double>(curIndex));
     }
@@ -459,7 +727,8 @@ void HashGridStorage::getLevelIndexArraysForEval(DataMatrixSP& level, DataMatrix
   //      #pragma omp for schedule (static) private(curLevel, curIndex)
   for (size_t i = 0; i < list.size(); i++) {
     for (size_t current_dim = 0; current_dim < dimension; current_dim++) {
-      (list[i])->get(current_dim, curLevel, curIndex);
+      curLevel = packedLevels[i * dimension + current_dim];
+      curIndex = packedIndices[i * dimension + current_dim];
       level.set(i, current_dim, static_cast<float>(1 << curLevel));
       index.set(i, current_dim, static_cast<float>(curIndex));
     }
@@ -470,15 +739,14 @@ void HashGridStorage::getLevelIndexArraysForEval(DataMatrixSP& level, DataMatrix
 
 void HashGridStorage::getLevelForIntegral(DataMatrix& level) {
   point_type::level_type curLevel;
-  point_type::level_type curIndex;
 
   // Parallelization may lead to segfaults.... comment on your own risk
   //    #pragma omp parallel
   //    {
-  //      #pragma omp for schedule (static) private(curLevel, curIndex)
+  //      #pragma omp for schedule (static) private(curLevel)
   for (size_t i = 0; i < list.size(); i++) {
     for (size_t current_dim = 0; current_dim < dimension; current_dim++) {
-      (list[i])->get(current_dim, curLevel, curIndex);
+      curLevel = packedLevels[i * dimension + current_dim];
       level.set(i, current_dim, pow(2.0, static_cast<int>(-curLevel)));
     }
   }
@@ -497,19 +765,11 @@ void HashGridStorage::getCoordinateArrays(DataMatrix& coordinates) {
 }
 
 size_t HashGridStorage::getMaxLevel() const {
-  point_type::level_type curLevel;
-  point_type::level_type curIndex;
-  point_type::level_type maxLevel;
-
-  maxLevel = 0;
+  packed_level_type maxLevel = 0;
 
-  for (size_t i = 0; i < list.size(); i++) {
-    for (size_t current_dim = 0; current_dim < dimension; current_dim++) {
-      (list[i])->get(current_dim, curLevel, curIndex);
-
-      if (curLevel > maxLevel) {
-        maxLevel = curLevel;
-      }
+  for (packed_level_type curLevel : packedLevels) {
+    if (curLevel > maxLevel) {
+      maxLevel = curLevel;
     }
   }
 
@@ -523,7 +783,8 @@ void HashGridStorage::getLevelIndexMaskArraysForModEval(DataMatrix& level, DataM
 
   for (size_t i = 0; i < list.size(); i++) {
     for (size_t current_dim = 0; current_dim < dimension; current_dim++) {
-      (list[i])->get(current_dim, curLevel, curIndex);
+      curLevel = packedLevels[i * dimension + current_dim];
+      curIndex = packedIndices[i * dimension + current_dim];
 
       if (curLevel == 1) {
         level.set(i, current_dim, 0.0);
@@ -561,7 +822,8 @@ void HashGridStorage::getLevelIndexMaskArraysForModEval(DataMatrixSP& level, Dat
 
   for (size_t i = 0; i < list.size(); i++) {
     for (size_t current_dim = 0; current_dim < dimension; current_dim++) {
-      (list[i])->get(current_dim, curLevel, curIndex);
+      curLevel = packedLevels[i * dimension + current_dim];
+      curIndex = packedIndices[i * dimension + current_dim];
 
       if (curLevel == 1) {
         level.set(i, current_dim, 0.0);
@@ -660,9 +922,16 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
     }
   }
 
+  modificationCount++;
+  list.reserve(num);
+  map.reserve(num);
+  packedLevels.reserve(num * dimension);
+  packedIndices.reserve(num * dimension);
+
   for (size_t i = 0; i < num; i++) {
     point_pointer index = new HashGridPoint(istream, version);
     list.push_back(index);
+    appendPacked(*index);
     map[index] = i;
   }
 
@@ -9,6 +9,7 @@
 #include <sgpp/base/exception/generation_exception.hpp>
 
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPointMap.hpp>
 #include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
 
 #include <sgpp/base/grid/common/BoundingBox.hpp>
@@ -21,8 +22,6 @@
 
 #include <stdint.h>
 
-#include <unordered_map>
-
 #include <exception>
 #include <list>
 #include <memory>
@@ -38,6 +37,12 @@ class HashGridIterator;
 
 /**
  * Generic hash table based storage of grid points.
+ *
+ * Besides the grid point objects, the storage keeps packed copies of the levels and indices
+ * of all grid points as structure of arrays (8-bit levels and 32-bit indices, one row of
+ * getDimension() entries per sequence number). Lookups compare with these rows instead of
+ * dereferencing the stored grid points, and the level/index arrays for the evaluation
+ * kernels are assembled from them.
  */
 class HashGridStorage {
  public:
@@ -47,9 +52,8 @@ class HashGridStorage {
   typedef HashGridPoint* point_pointer;
   /// pointer to constant index_type
   typedef const HashGridPoint* index_const_pointer;
-  /// unordered_map of index_pointers
-  typedef std::unordered_map<point_pointer, size_t, HashGridPointPointerHashFunctor,
-                             HashGridPointPointerEqualityFunctor> grid_map;
+  /// flat hash map of index_pointers
+  typedef HashGridPointMap grid_map;
   /// iterator of grid_map
   typedef grid_map::iterator grid_map_iterator;
   /// const_iterator of grid_map
@@ -64,6 +68,11 @@ class HashGridStorage {
 
   /// iterator for grid points
   typedef HashGridIterator grid_iterator;
+  /// type of the packed levels (see getPackedLevels())
+  typedef uint8_t packed_level_type;
+
+  /// returned by insert() during deferred insertion (see beginDeferredInsertion())
+  static const size_t DEFERRED_SEQUENCE_NUMBER = static_cast<size_t>(-1);
 
   /**
    * Constructor
@@ -182,6 +191,14 @@ class HashGridStorage {
    */
   size_t getSize() const;
 
+  /**
+   * gets a counter which is incremented whenever grid points are added, removed or replaced,
+   * e.g., to detect that data cached for the grid is out of date
+   *
+   * @return number of modifications of the grid points
+   */
+  size_t getModificationCount() const;
+
   /**
    * gets the number of inner grid points
    *
@@ -222,12 +239,30 @@ class HashGridStorage {
    */
   inline HashGridPoint& getPoint(size_t seq) const { return *list[seq]; }
 
+  /**
+   * gets the packed levels of all grid points, the level of the grid point with sequence
+   * number seq in dimension d is getPackedLevels()[seq * getDimension() + d]
+   *
+   * @return pointer to getSize() * getDimension() levels
+   */
+  inline const packed_level_type* getPackedLevels() const { return packedLevels.data(); }
+
+  /**
+   * gets the packed indices of all grid points, the index of the grid point with sequence
+   * number seq in dimension d is getPackedIndices()[seq * getDimension() + d]
+   *
+   * @return pointer to getSize() * getDimension() indices
+   */
+  inline const point_type::index_type* getPackedIndices() const { return packedIndices.data(); }
+
   /**
    * insert a new index into map
+   * (during deferred insertion, see beginDeferredInsertion(), the index is only buffered)
    *
    * @param index reference to the index that should be inserted
    *
-   * @return
+   * @return sequence number of the new index, or DEFERRED_SEQUENCE_NUMBER during deferred
+   * insertion (the sequence number is not known until endDeferredInsertion() is called)
    */
   size_t insert(const point_type& index);
 
@@ -235,12 +270,73 @@ class HashGridStorage {
    * insert a new index into map including all its ancestors. Boundary points are not added
    *
    * @param index reference to the index that should be inserted
-   * @param insertedPoints containing the indices of the new points
+   * @param insertedPoints containing the indices of the new points (nothing is appended during
+   * deferred insertion, use the argument of endDeferredInsertion() instead)
    *
    * @return
    */
   void insert(point_type& index, std::vector<size_t>& insertedPoints);
 
+  /**
+   * inserts grid points given by contiguous level and index arrays (e.g., from a
+   * memory-mapped binary grid file) without inserting missing ancestors
+   *
+   * @param levels          levels of the points, levels[k * dimension + d] is the level of
+   *                        the k-th point in the d-th dimension
+   * @param indices         indices of the points (same layout as levels)
+   * @param leaves          leaf property of the points (may be nullptr, then all points
+   *                        are marked as non-leaves)
+   * @param numberOfPoints  number of points to insert
+   */
+  void insert(const point_type::level_type* levels, const point_type::index_type* indices,
+              const uint8_t* leaves, size_t numberOfPoints);
+
+  /**
+   * inserts many grid points at once. Grid points that are already contained in the storage
+   * and repeated grid points are skipped, the remaining ones are appended in the order of their
+   * first occurrence, so the sequence numbers do not depend on the number of threads.
+   * The grid points are hashed and looked up in parallel. Afterwards, the leaf property of the
+   * new grid points is recalculated (as in recalcLeafProperty()) and their hierarchical parents
+   * are marked as non-leaves, in one parallel pass over the new grid points.
+   * Missing ancestors are not inserted.
+   *
+   * @param points          grid points to insert
+   * @param insertedPoints  if not nullptr, the sequence numbers of the new grid points are
+   *                        appended to this vector
+   * @return                number of new grid points
+   */
+  size_t insertPoints(const std::vector<point_type>& points,
+                      std::vector<size_t>* insertedPoints = nullptr);
+
+  /**
+   * starts the deferred insertion of grid points: until endDeferredInsertion() is called,
+   * insert(const point_type&) does not modify the storage, but adds the grid point to a buffer
+   * of the calling OpenMP thread, and isContaining() also finds the grid points in this buffer.
+   * Hence, algorithms that only read the storage apart from inserting grid points (like the
+   * refinement) can be run in parallel. Grid points in the buffers are not accessible by find()
+   * or their sequence number, and the leaf property of contained grid points is updated only
+   * by endDeferredInsertion().
+   */
+  void beginDeferredInsertion();
+
+  /**
+   * ends the deferred insertion and inserts the buffered grid points with insertPoints(),
+   * taking the buffers in the order of the thread numbers. If the buffered grid points were
+   * created in a loop with static OpenMP scheduling, they are inserted in the order of the
+   * loop iterations.
+   *
+   * @param insertedPoints  if not nullptr, the sequence numbers of the new grid points are
+   *                        appended to this vector
+   * @return                number of new grid points
+   */
+  size_t endDeferredInsertion(std::vector<size_t>* insertedPoints = nullptr);
+
+  /**
+   * @return whether grid points are currently buffered instead of inserted
+   *         (see beginDeferredInsertion())
+   */
+  bool isInsertionDeferred() const;
+
   /**
    * updates an already stored index
    *
@@ -249,6 +345,15 @@ class HashGridStorage {
    */
   void update(point_type& index, size_t pos);
 
+  /**
+   * exchanges the grid points of this storage with those of another storage of
+   * the same dimension; bounding box, stretching and algorithmic dimensions
+   * are not exchanged
+   *
+   * @param other   other storage
+   */
+  void swapPoints(HashGridStorage& other);
+
   /**
    * This methods removes the gridpoint added last. Use with coution, only needed for
    * expanding the grid because of the shadow-storage of prewavelets. Please refer to the
@@ -523,6 +628,10 @@ class HashGridStorage {
   grid_list list;
   /// the indices of the grid points
   grid_map map;
+  /// packed levels of the grid points, one row of dimension entries per grid point
+  std::vector<packed_level_type> packedLevels;
+  /// packed indices of the grid points, one row of dimension entries per grid point
+  std::vector<point_type::index_type> packedIndices;
   /// algorithmic dimension, these are used in Up/Downs
   std::vector<size_t> algoDims;
 
@@ -534,6 +643,53 @@ class HashGridStorage {
   /// Flag to check if stretching or boundingBox used
   bool bUseStretching;
 
+  /// number of modifications of the grid points (see getModificationCount())
+  size_t modificationCount = 0;
+
+  /// whether grid points are buffered instead of inserted (see beginDeferredInsertion())
+  bool deferredInsertion = false;
+  /// buffers of the threads during deferred insertion
+  std::vector<std::unique_ptr<HashGridStorage>> deferredPoints;
+
+  /**
+   * Tests if index is in the buffer of the calling thread during deferred insertion
+   *
+   * @param index reference to index that should be tested
+   *
+   * @return true if the index is in the buffer
+   */
+  bool isContainingDeferred(HashGridPoint& index) const;
+
+  /**
+   * Appends the level and index of a grid point to the packed arrays
+   * (the grid point has to be appended to the list, too)
+   *
+   * @param index the grid point
+   */
+  void appendPacked(const HashGridPoint& index);
+
+  /**
+   * Overwrites the packed level and index of a grid point
+   *
+   * @param index the grid point
+   * @param seq   sequence number of the grid point
+   */
+  void setPacked(const HashGridPoint& index, size_t seq);
+
+  /**
+   * Rebuilds the packed arrays from the list of grid points
+   */
+  void rebuildPacked();
+
+  /**
+   * Compares a grid point with the packed level and index of a stored grid point
+   *
+   * @param index the grid point
+   * @param seq   sequence number of the stored grid point
+   * @return      whether the grid points are equal
+   */
+  bool isPackedEqual(const HashGridPoint& index, size_t seq) const;
+
   /**
    * Parses the gird's information (grid points, dimensions, bounding box) from a string stream
    *
@@ -550,12 +706,16 @@ HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index)
 void inline HashGridStorage::destroy(point_pointer index) { delete index; }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
+  modificationCount++;
   list.push_back(index);
+  appendPacked(*index);
   return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
 }
 
 HashGridStorage::grid_map_iterator inline HashGridStorage::find(point_pointer index) {
-  return map.find(index);
+  return map.find(index, [this, index](const grid_map::value_type& entry) {
+    return isPackedEqual(*index, entry.second);
+  });
 }
 
 HashGridStorage::grid_map_iterator inline HashGridStorage::begin() { return map.begin(); }
@@ -563,11 +723,20 @@ HashGridStorage::grid_map_iterator inline HashGridStorage::begin() { return map.
 HashGridStorage::grid_map_iterator inline HashGridStorage::end() { return map.end(); }
 
 bool inline HashGridStorage::isContaining(HashGridPoint& index) const {
-  return map.find(&index) != map.end();
+  grid_map_const_iterator iter =
+      map.find(&index, [this, &index](const grid_map::value_type& entry) {
+        return isPackedEqual(index, entry.second);
+      });
+  return (iter != map.end()) || (deferredInsertion && isContainingDeferred(index));
 }
 
+bool inline HashGridStorage::isInsertionDeferred() const { return deferredInsertion; }
+
 size_t inline HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
-  grid_map_const_iterator iter = map.find(&index);
+  grid_map_const_iterator iter =
+      map.find(&index, [this, &index](const grid_map::value_type& entry) {
+        return isPackedEqual(index, entry.second);
+      });
 
   if (iter != map.end()) {
     return iter->second;
@@ -576,6 +745,25 @@ size_t inline HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
   }
 }
 
+bool inline HashGridStorage::isPackedEqual(const HashGridPoint& index, size_t seq) const {
+  const packed_level_type* levels = packedLevels.data() + seq * dimension;
+  const point_type::index_type* indices = packedIndices.data() + seq * dimension;
+
+  for (size_t d = 0; d < dimension; d++) {
+    if (levels[d] != index.getLevel(d)) {
+      return false;
+    }
+  }
+
+  for (size_t d = 0; d < dimension; d++) {
+    if (indices[d] != index.getIndex(d)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 bool inline HashGridStorage::isInvalidSequenceNumber(size_t s) { return s > map.size(); }
 
 std::vector<size_t> inline HashGridStorage::getAlgorithmicDimensions() { return algoDims; }
@@ -114,13 +114,16 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearBoundary.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalLinearSP.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearStretched.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearStretchedBoundary.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalModLinear.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalModLinearSP.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalModPoly.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalPeriodic.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalPoly.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalPolyBoundary.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalPolySP.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalPrewavelet.hpp>
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalInterModLinear.hpp>
@@ -556,6 +559,22 @@ base::OperationMultipleEval* createOperationMultipleEvalNaive(base::Grid& grid,
   }
 }
 
+base::OperationMultipleEvalSP* createOperationMultipleEvalSP(base::Grid& grid,
+                                                             base::DataMatrixSP& dataset,
+                                                             bool mixedPrecision) {
+  if (grid.getType() == base::GridType::Linear) {
+    return new base::OperationMultipleEvalLinearSP(grid, dataset, mixedPrecision);
+  } else if (grid.getType() == base::GridType::ModLinear) {
+    return new base::OperationMultipleEvalModLinearSP(grid, dataset, mixedPrecision);
+  } else if (grid.getType() == base::GridType::Poly) {
+    return new base::OperationMultipleEvalPolySP(
+        grid, dynamic_cast<base::PolyGrid*>(&grid)->getDegree(), dataset, mixedPrecision);
+  } else {
+    throw base::factory_exception(
+        "createOperationMultipleEvalSP is not implemented for this grid type.");
+  }
+}
+
 base::OperationEval* createOperationEvalNaive(base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear) {
     return new base::OperationEvalLinearNaive(grid.getStorage());
@@ -17,6 +17,7 @@
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalSP.hpp>
 #include <sgpp/base/operation/hash/OperationStencilHierarchisation.hpp>
 #include <sgpp/base/operation/hash/OperationDiagonal.hpp>
 
@@ -147,6 +148,21 @@ base::OperationMultipleEval* createOperationMultipleEvalInter(base::Grid& grid,
 base::OperationMultipleEval* createOperationMultipleEvalNaive(base::Grid& grid,
                                                               base::DataMatrix& dataset);
 
+/**
+ * Factory method, returning an OperationMultipleEvalSP (single precision) for the grid at hand.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used (Linear, ModLinear or Poly)
+ * @param dataset The dataset (DataMatrixSP, one datapoint per row) that is to be evaluated for
+ * the sparse grid function
+ * @param mixedPrecision if true, intermediate sums are accumulated in double precision
+ * (data and coefficients are still stored in single precision)
+ * @return Pointer to the new OperationMultipleEvalSP object for the Grid grid
+ */
+base::OperationMultipleEvalSP* createOperationMultipleEvalSP(base::Grid& grid,
+                                                             base::DataMatrixSP& dataset,
+                                                             bool mixedPrecision = false);
+
 /**
  * Factory method, returning an OperationEval for the grid at hand.
  * In contrast to OperationEval, implementations of OperationEval
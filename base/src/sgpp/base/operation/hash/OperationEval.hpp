@@ -8,6 +8,7 @@
 
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -41,6 +42,22 @@ class OperationEval {
   virtual double eval(const DataVector& alpha,
                        const DataVector& point) = 0;
 
+  /**
+   * Evaluates the sparse grid function at a point given by a view, e.g., a row of a DataMatrix
+   * (see DataMatrix::getRowView), without requiring a DataVector for the point.
+   * The default implementation copies the point into a buffer (one per thread, so no memory
+   * is allocated for repeated calls); operations for which the point is only read override
+   * this method to evaluate without copying.
+   *
+   * @param alpha The coefficients of the sparse grid's basis functions
+   * @param point The coordinates of the evaluation point
+   */
+  virtual double eval(const DataVector& alpha, const ConstDataVectorView& point) {
+    static thread_local DataVector pointBuffer;
+    point.copyTo(pointBuffer);
+    return eval(alpha, pointBuffer);
+  }
+
   /**
    * @param      alpha  coefficient matrix (each column is a coefficient vector)
    * @param      point  evaluation point
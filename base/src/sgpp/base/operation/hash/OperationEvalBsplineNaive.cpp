@@ -18,6 +18,10 @@ double OperationEvalBsplineNaive::eval(const DataVector& alpha,
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
+  if (algorithm.isApplicable()) {
+    return algorithm(base, pointInUnitCube, alpha);
+  }
+
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
@@ -49,6 +53,11 @@ void OperationEvalBsplineNaive::eval(const DataMatrix& alpha,
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
+  if (algorithm.isApplicable()) {
+    algorithm(base, pointInUnitCube, alpha, value);
+    return;
+  }
+
   value.resize(m);
   value.setAll(0.0);
 
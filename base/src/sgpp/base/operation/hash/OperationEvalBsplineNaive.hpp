@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmEvaluationLocalSupport.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -28,7 +29,8 @@ class OperationEvalBsplineNaive : public OperationEval {
    * @param degree    B-spline degree
    */
   OperationEvalBsplineNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    algorithm(storage) {
   }
 
   /**
@@ -59,6 +61,8 @@ class OperationEvalBsplineNaive : public OperationEval {
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// hierarchical descent over the basis functions which are non-zero at the point
+  AlgorithmEvaluationLocalSupport<SBsplineBase> algorithm;
 };
 
 }  // namespace base
@@ -25,5 +25,12 @@ double OperationEvalLinear::eval(const DataVector& alpha,
   return AlgoEval(base, point, alpha);
 }
 
+double OperationEvalLinear::eval(const DataVector& alpha, const ConstDataVectorView& point) {
+  LinearBasis<unsigned int, unsigned int> base;
+  AlgorithmEvaluation<LinearBasis<unsigned int, unsigned int> > AlgoEval(storage);
+
+  return AlgoEval(base, point, alpha);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -35,6 +35,14 @@ class OperationEvalLinear : public OperationEval {
   double eval(const DataVector& alpha,
                const DataVector& point) override;
 
+  /**
+   * Evaluates the sparse grid function at a point given by a view without copying the point.
+   *
+   * @param alpha The coefficients of the sparse grid's basis functions
+   * @param point The coordinates of the evaluation point
+   */
+  double eval(const DataVector& alpha, const ConstDataVectorView& point) override;
+
  protected:
   /// reference to the grid's GridStorage object
   GridStorage& storage;
@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmEvaluationLocalSupport.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -27,7 +28,8 @@ class OperationEvalModBsplineNaive : public OperationEval {
    * @param degree    B-spline degree
    */
   OperationEvalModBsplineNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    algorithm(storage) {
   }
 
   /**
@@ -58,6 +60,8 @@ class OperationEvalModBsplineNaive : public OperationEval {
   SBsplineModifiedBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// hierarchical descent over the basis functions which are non-zero at the point
+  AlgorithmEvaluationLocalSupport<SBsplineModifiedBase> algorithm;
 };
 
 }  // namespace base
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmEvaluationLocalSupport.hpp>
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
@@ -24,7 +25,8 @@ class OperationEvalModPolyNaive : public OperationEval {
    * @param degree    polynomial degree
    */
   OperationEvalModPolyNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    algorithm(storage) {
   }
 
   ~OperationEvalModPolyNaive() override {}
@@ -50,6 +52,8 @@ class OperationEvalModPolyNaive : public OperationEval {
   SPolyModifiedBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// hierarchical descent over the basis functions which are non-zero at the point
+  AlgorithmEvaluationLocalSupport<SPolyModifiedBase> algorithm;
 };
 
 }  // namespace base
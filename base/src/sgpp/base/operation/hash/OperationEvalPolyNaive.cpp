@@ -16,6 +16,10 @@ double OperationEvalPolyNaive::eval(const DataVector& alpha, const DataVector& p
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
+  if (algorithm.isApplicable()) {
+    return algorithm(base, pointInUnitCube, alpha);
+  }
+
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
@@ -46,6 +50,11 @@ void OperationEvalPolyNaive::eval(const DataMatrix& alpha, const DataVector& poi
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
+  if (algorithm.isApplicable()) {
+    algorithm(base, pointInUnitCube, alpha, value);
+    return;
+  }
+
   value.resize(m);
   value.setAll(0.0);
 
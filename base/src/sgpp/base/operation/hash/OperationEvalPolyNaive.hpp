@@ -7,6 +7,7 @@
 #define OPERATIONEVALPOLYNAIVE_HPP_
 
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmEvaluationLocalSupport.hpp>
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
@@ -25,7 +26,8 @@ class OperationEvalPolyNaive: public OperationEval {
    * @param degree    polynomial degree
    */
   OperationEvalPolyNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    algorithm(storage) {
   }
 
   ~OperationEvalPolyNaive() override {
@@ -53,6 +55,8 @@ class OperationEvalPolyNaive: public OperationEval {
   SPolyBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// hierarchical descent over the basis functions which are non-zero at the point
+  AlgorithmEvaluationLocalSupport<SPolyBase> algorithm;
 };
 
 }  // namespace base
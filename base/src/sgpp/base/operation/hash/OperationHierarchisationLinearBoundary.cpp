@@ -24,10 +24,10 @@ void OperationHierarchisationLinearBoundary::doHierarchisation(
   // N D case
   if (this->storage.getDimension() > 1) {
     for (size_t i = 0; i < this->storage.getDimension(); i++) {
-      s.sweep1D_Boundary(node_values, node_values, i);
+      s.sweep1D_Boundary_Parallel(node_values, node_values, i);
     }
   } else {  // 1 D case
-    s.sweep1D(node_values, node_values, 0);
+    s.sweep1D_Parallel(node_values, node_values, 0);
   }
 }
 
@@ -39,10 +39,10 @@ void OperationHierarchisationLinearBoundary::doDehierarchisation(
   // N D case
   if (this->storage.getDimension() > 1) {
     for (size_t i = 0; i < this->storage.getDimension(); i++) {
-      s.sweep1D_Boundary(alpha, alpha, i);
+      s.sweep1D_Boundary_Parallel(alpha, alpha, i);
     }
   } else {  // 1 D case
-    s.sweep1D(alpha, alpha, 0);
+    s.sweep1D_Parallel(alpha, alpha, 0);
   }
 }
 
@@ -21,7 +21,7 @@ void OperationHierarchisationLinearClenshawCurtis::doHierarchisation(DataVector&
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D(node_values, node_values, i);
+    s.sweep1D_Parallel(node_values, node_values, i);
   }
 }
 
@@ -32,7 +32,7 @@ void OperationHierarchisationLinearClenshawCurtis::doDehierarchisation(DataVecto
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
     DataVector source(alpha);
-    s.sweep1D(source, alpha, i);
+    s.sweep1D_Parallel(source, alpha, i);
   }
 }
 
@@ -21,7 +21,7 @@ void OperationHierarchisationLinearClenshawCurtisBoundary::doHierarchisation(
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D_Boundary(node_values, node_values, i);
+    s.sweep1D_Boundary_Parallel(node_values, node_values, i);
   }
 }
 
@@ -32,7 +32,7 @@ void OperationHierarchisationLinearClenshawCurtisBoundary::doDehierarchisation(D
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
     DataVector source(alpha);
-    s.sweep1D_Boundary(source, alpha, i);
+    s.sweep1D_Boundary_Parallel(source, alpha, i);
   }
 }
 
@@ -20,7 +20,7 @@ void OperationHierarchisationModPoly::doHierarchisation(DataVector& node_values)
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D(node_values, node_values, i);
+    s.sweep1D_Parallel(node_values, node_values, i);
   }
 }
 
@@ -31,7 +31,7 @@ void OperationHierarchisationModPoly::doDehierarchisation(DataVector& alpha) {
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
     DataVector source(alpha);
-    s.sweep1D(source, alpha, i);
+    s.sweep1D_Parallel(source, alpha, i);
   }
 }
 
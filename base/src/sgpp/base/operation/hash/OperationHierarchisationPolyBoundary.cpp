@@ -22,7 +22,7 @@ void OperationHierarchisationPolyBoundary::doHierarchisation(
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D_Boundary(node_values, node_values, i);
+    s.sweep1D_Boundary_Parallel(node_values, node_values, i);
   }
 }
 
@@ -34,7 +34,7 @@ void OperationHierarchisationPolyBoundary::doDehierarchisation(
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
     DataVector source(alpha);
-    s.sweep1D_Boundary(source, alpha, i);
+    s.sweep1D_Boundary_Parallel(source, alpha, i);
   }
 }
 
@@ -6,6 +6,7 @@
 #ifndef OPERATIONMATRIX_HPP
 #define OPERATIONMATRIX_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -38,6 +39,27 @@ class OperationMatrix {
    * @param result DataVector into which the result of the Laplace operation is stored
    */
   virtual void mult(DataVector& alpha, DataVector& result) = 0;
+
+  /**
+   * Multiplication with several coefficient vectors at once, which are stored in the
+   * columns of a DataMatrix (one row per grid point).
+   * The default implementation multiplies the columns one after another, operators which
+   * can process all columns within one grid traversal override it.
+   *
+   * @param alpha DataMatrix that contains the ansatzfunctions' coefficients (one vector per
+   * column)
+   * @param result DataMatrix into which the results are stored (same size as alpha)
+   */
+  virtual void mult(DataMatrix& alpha, DataMatrix& result) {
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(alpha.getNrows());
+
+    for (size_t j = 0; j < alpha.getNcols(); j++) {
+      alpha.getColumn(j, alphaColumn);
+      mult(alphaColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
 };
 
 }  // namespace base
@@ -20,6 +20,8 @@ void OperationMultipleEvalBsplineClenshawCurtisNaive::mult(DataVector& alpha, Da
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+  // the 1D basis is reentrant, so data points can be processed concurrently
+#pragma omp parallel for schedule(dynamic, 16)
   for (size_t j = 0; j < m; j++) {
     for (size_t i = 0; i < n; i++) {
       const GridPoint& gp = storage[i];
@@ -52,6 +54,7 @@ void OperationMultipleEvalBsplineClenshawCurtisNaive::multTranspose(DataVector&
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+#pragma omp parallel for schedule(dynamic, 16)
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
 
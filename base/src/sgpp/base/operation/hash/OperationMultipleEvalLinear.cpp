@@ -3,7 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 
@@ -13,17 +12,15 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinear::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& result) {
-  AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
 
-  op.mult_transpose(storage, base, alpha, this->dataset, result);
+  algorithm.mult_transpose(storage, base, alpha, this->dataset, result);
 }
 
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
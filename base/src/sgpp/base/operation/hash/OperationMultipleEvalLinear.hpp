@@ -6,8 +6,10 @@
 #ifndef OPERATIONMULTIPLEEVALLINEAR_HPP
 #define OPERATIONMULTIPLEEVALLINEAR_HPP
 
+#include <sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -41,6 +43,8 @@ class OperationMultipleEvalLinear : public OperationMultipleEval {
  protected:
   /// reference to the grid's GridStorage object
   GridStorage& storage;
+  /// multi-evaluation algorithm, keeps its scratch vectors between calls
+  AlgorithmMultipleEvaluation<SLinearBase> algorithm;
 };
 
 }  // namespace base
@@ -3,8 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
-
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearBoundary.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -13,17 +11,15 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinearBoundary::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmDGEMV<SLinearBoundaryBase> op;
   LinearBoundaryBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalLinearBoundary::multTranspose(DataVector& source, DataVector& result) {
-  AlgorithmDGEMV<SLinearBoundaryBase> op;
   LinearBoundaryBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  algorithm.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalLinearBoundary::getDuration() { return 0.0; }
@@ -6,8 +6,10 @@
 #ifndef OPERATIONMULTIPLEEVALLINEARBOUNDARY_HPP
 #define OPERATIONMULTIPLEEVALLINEARBOUNDARY_HPP
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -43,6 +45,8 @@ class OperationMultipleEvalLinearBoundary : public OperationMultipleEval {
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// DGEMV algorithm, keeps its scratch vectors between calls
+  AlgorithmDGEMV<SLinearBoundaryBase> algorithm;
 };
 
 }  // namespace base
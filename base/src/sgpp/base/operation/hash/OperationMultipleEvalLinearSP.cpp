@@ -0,0 +1,33 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/OperationMultipleEvalLinearSP.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+void OperationMultipleEvalLinearSP::mult(DataVectorSP& alpha, DataVectorSP& result) {
+  LinearBasis<unsigned int, unsigned int> base;
+
+  algorithm.mult(storage, base, alpha, this->dataset, result);
+}
+
+void OperationMultipleEvalLinearSP::multTranspose(DataVectorSP& source, DataVectorSP& result) {
+  LinearBasis<unsigned int, unsigned int> base;
+
+  if (mixedPrecision) {
+    algorithm.mult_transpose<double>(storage, base, source, this->dataset, result);
+  } else {
+    algorithm.mult_transpose<float>(storage, base, source, this->dataset, result);
+  }
+}
+
+double OperationMultipleEvalLinearSP::getDuration() { return 0.0; }
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,54 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMULTIPLEEVALLINEARSP_HPP
+#define OPERATIONMULTIPLEEVALLINEARSP_HPP
+
+#include <sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalSP.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * This class implements OperationMultipleEvalSP for grids with linear basis ansatzfunctions
+ */
+class OperationMultipleEvalLinearSP : public OperationMultipleEvalSP {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid grid
+   * @param dataset Dataset
+   * @param mixedPrecision accumulate intermediate sums in double precision
+   */
+  OperationMultipleEvalLinearSP(Grid& grid, DataMatrixSP& dataset, bool mixedPrecision = false)
+      : OperationMultipleEvalSP(grid, dataset, mixedPrecision), storage(grid.getStorage()) {}
+
+  /**
+   * Destructor
+   */
+  ~OperationMultipleEvalLinearSP() override {}
+
+  void mult(DataVectorSP& alpha, DataVectorSP& result) override;
+  void multTranspose(DataVectorSP& source, DataVectorSP& result) override;
+
+  double getDuration() override;
+
+ protected:
+  /// reference to the grid's GridStorage object
+  GridStorage& storage;
+  /// multi-evaluation algorithm, keeps its scratch vectors between calls
+  AlgorithmMultipleEvaluation<SLinearBase> algorithm;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONMULTIPLEEVALLINEARSP_HPP */
@@ -3,7 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearStretched.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearStretchedBasis.hpp>
 
@@ -13,17 +12,15 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinearStretched::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmDGEMV<SLinearStretchedBase> op;
   LinearStretchedBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalLinearStretched::multTranspose(DataVector& source, DataVector& result) {
-  AlgorithmDGEMV<SLinearStretchedBase> op;
   LinearStretchedBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  algorithm.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalLinearStretched::getDuration() { return 0.0; }
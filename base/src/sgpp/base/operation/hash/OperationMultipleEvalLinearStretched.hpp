@@ -6,8 +6,10 @@
 #ifndef OPERATIONMULTIPLEEVALLINEARSTRETCHED_HPP
 #define OPERATIONMULTIPLEEVALLINEARSTRETCHED_HPP
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearStretchedBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -42,6 +44,8 @@ class OperationMultipleEvalLinearStretched : public OperationMultipleEval {
  protected:
   /// reference to the grid's GridStorage object
   GridStorage& storage;
+  /// DGEMV algorithm, keeps its scratch vectors between calls
+  AlgorithmDGEMV<SLinearStretchedBase> algorithm;
 };
 
 }  // namespace base
@@ -3,8 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
-
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearStretchedBoundary.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -13,18 +11,16 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinearStretchedBoundary::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmDGEMV<SLinearStretchedBoundaryBase> op;
   LinearStretchedBoundaryBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalLinearStretchedBoundary::multTranspose(DataVector& source,
                                                                  DataVector& result) {
-  AlgorithmDGEMV<SLinearStretchedBoundaryBase> op;
   LinearStretchedBoundaryBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  algorithm.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalLinearStretchedBoundary::getDuration() { return 0.0; }
@@ -6,8 +6,10 @@
 #ifndef OPERATIONMULTIPLEEVALLINEARSTRETCHEDBOUNDARY_HPP
 #define OPERATIONMULTIPLEEVALLINEARSTRETCHEDBOUNDARY_HPP
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearStretchedBoundaryBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -44,6 +46,8 @@ class OperationMultipleEvalLinearStretchedBoundary : public OperationMultipleEva
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// DGEMV algorithm, keeps its scratch vectors between calls
+  AlgorithmDGEMV<SLinearStretchedBoundaryBase> algorithm;
 };
 
 }  // namespace base
@@ -21,6 +21,8 @@ void OperationMultipleEvalModBsplineClenshawCurtisNaive::mult(DataVector& alpha,
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+  // the 1D basis is reentrant, so data points can be processed concurrently
+#pragma omp parallel for schedule(dynamic, 16)
   for (size_t j = 0; j < m; j++) {
     for (size_t i = 0; i < n; i++) {
       const GridPoint& gp = storage[i];
@@ -53,6 +55,7 @@ void OperationMultipleEvalModBsplineClenshawCurtisNaive::multTranspose(DataVecto
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+#pragma omp parallel for schedule(dynamic, 16)
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
 
@@ -3,8 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
-
 #include <sgpp/base/operation/hash/OperationMultipleEvalModLinear.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
 
@@ -14,17 +12,15 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalModLinear::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalModLinear::multTranspose(DataVector& source, DataVector& result) {
-  AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  algorithm.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalModLinear::getDuration() { return 0.0; }
@@ -6,8 +6,10 @@
 #ifndef OPERATIONMULTIPLEEVALMODLINEAR_HPP
 #define OPERATIONMULTIPLEEVALMODLINEAR_HPP
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -42,6 +44,8 @@ class OperationMultipleEvalModLinear : public OperationMultipleEval {
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// DGEMV algorithm, keeps its scratch vectors between calls
+  AlgorithmDGEMV<SLinearModifiedBase> algorithm;
 };
 
 }  // namespace base
@@ -3,8 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
-
 #include <sgpp/base/operation/hash/OperationMultipleEvalModPoly.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -13,15 +11,11 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalModPoly::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmDGEMV<SPolyModifiedBase> op;
-
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalModPoly::multTranspose(DataVector& source, DataVector& result) {
-  AlgorithmDGEMV<SPolyModifiedBase> op;
-
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  algorithm.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalModPoly::getDuration() { return 0.0; }
@@ -6,6 +6,7 @@
 #ifndef OPERATIONMULTIPLEEVALMODPOLY_HPP
 #define OPERATIONMULTIPLEEVALMODPOLY_HPP
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyModifiedBasis.hpp>
@@ -44,6 +45,8 @@ class OperationMultipleEvalModPoly : public OperationMultipleEval {
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// DGEMV algorithm, keeps its scratch vectors between calls
+  AlgorithmDGEMV<SPolyModifiedBase> algorithm;
   /// Mod Poly Basis object
   SPolyModifiedBase base;
 };
@@ -3,8 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
-
 #include <sgpp/base/operation/hash/OperationMultipleEvalPeriodic.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearPeriodicBasis.hpp>
 
@@ -14,17 +12,15 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalPeriodic::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmDGEMV<SLinearPeriodicBasis> op;
   LinearPeriodicBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalPeriodic::multTranspose(DataVector& source, DataVector& result) {
-  AlgorithmDGEMV<SLinearPeriodicBasis> op;
   LinearPeriodicBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  algorithm.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalPeriodic::getDuration() { return 0.0; }
@@ -6,8 +6,10 @@
 #ifndef OPERATIONMULTIPLEEVALPERIODIC_HPP
 #define OPERATIONMULTIPLEEVALPERIODIC_HPP
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearPeriodicBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -43,6 +45,8 @@ class OperationMultipleEvalPeriodic : public OperationMultipleEval {
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// DGEMV algorithm, keeps its scratch vectors between calls
+  AlgorithmDGEMV<SLinearPeriodicBasis> algorithm;
 };
 
 }  // namespace base
@@ -3,8 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
-
 #include <sgpp/base/operation/hash/OperationMultipleEvalPoly.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
 
@@ -14,15 +12,11 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalPoly::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmDGEMV<SPolyBase> op;
-
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalPoly::multTranspose(DataVector& source, DataVector& result) {
-  AlgorithmDGEMV<SPolyBase> op;
-
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  algorithm.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalPoly::getDuration() { return 0.0; }
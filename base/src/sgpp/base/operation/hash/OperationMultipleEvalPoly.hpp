@@ -6,8 +6,10 @@
 #ifndef OPERATIONMULTIPLEEVALPOLY_HPP
 #define OPERATIONMULTIPLEEVALPOLY_HPP
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyModifiedBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -43,6 +45,8 @@ class OperationMultipleEvalPoly : public OperationMultipleEval {
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// DGEMV algorithm, keeps its scratch vectors between calls
+  AlgorithmDGEMV<SPolyBase> algorithm;
   /// Poly Basis object
   SPolyBase base;
 };
@@ -3,23 +3,17 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
-
 #include <sgpp/base/operation/hash/OperationMultipleEvalPolyBoundary.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalPolyBoundary::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmDGEMV<SPolyBoundaryBase> op;
-
-  op.mult(storage, base, alpha, this->dataset, result);
+  algorithm.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalPolyBoundary::multTranspose(DataVector& source, DataVector& result) {
-  AlgorithmDGEMV<SPolyBoundaryBase> op;
-
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  algorithm.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalPolyBoundary::getDuration() { return 0.0; }
@@ -6,6 +6,7 @@
 #ifndef OPERATIONMULTIPLEEVALPOLYBOUNDARY_HPP
 #define OPERATIONMULTIPLEEVALPOLYBOUNDARY_HPP
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyBoundaryBasis.hpp>
@@ -43,6 +44,8 @@ class OperationMultipleEvalPolyBoundary : public OperationMultipleEval {
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// DGEMV algorithm, keeps its scratch vectors between calls
+  AlgorithmDGEMV<SPolyBoundaryBase> algorithm;
   /// Poly Basis object
   SPolyBoundaryBase base;
 };
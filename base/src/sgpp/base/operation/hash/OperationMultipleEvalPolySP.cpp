@@ -0,0 +1,29 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/OperationMultipleEvalPolySP.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+void OperationMultipleEvalPolySP::mult(DataVectorSP& alpha, DataVectorSP& result) {
+  algorithm.mult(storage, base, alpha, this->dataset, result);
+}
+
+void OperationMultipleEvalPolySP::multTranspose(DataVectorSP& source, DataVectorSP& result) {
+  if (mixedPrecision) {
+    algorithm.mult_transpose<double>(storage, base, source, this->dataset, result);
+  } else {
+    algorithm.mult_transpose<float>(storage, base, source, this->dataset, result);
+  }
+}
+
+double OperationMultipleEvalPolySP::getDuration() { return 0.0; }
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,60 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMULTIPLEEVALPOLYSP_HPP
+#define OPERATIONMULTIPLEEVALPOLYSP_HPP
+
+#include <sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalSP.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * This class implements OperationMultipleEvalSP for grids with polynomial basis ansatzfunctions
+ */
+class OperationMultipleEvalPolySP : public OperationMultipleEvalSP {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid grid
+   * @param degree the polynom's max. degree
+   * @param dataset Dataset
+   * @param mixedPrecision accumulate intermediate sums in double precision
+   */
+  OperationMultipleEvalPolySP(Grid& grid, size_t degree, DataMatrixSP& dataset,
+                              bool mixedPrecision = false)
+      : OperationMultipleEvalSP(grid, dataset, mixedPrecision),
+        storage(grid.getStorage()),
+        base(degree) {}
+
+  /**
+   * Destructor
+   */
+  ~OperationMultipleEvalPolySP() override {}
+
+  void mult(DataVectorSP& alpha, DataVectorSP& result) override;
+  void multTranspose(DataVectorSP& source, DataVectorSP& result) override;
+
+  double getDuration() override;
+
+ protected:
+  /// reference to the grid's GridStorage object
+  GridStorage& storage;
+  /// multi-evaluation algorithm, keeps its scratch vectors between calls
+  AlgorithmMultipleEvaluation<SPolyBase> algorithm;
+  /// Poly Basis object
+  SPolyBase base;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONMULTIPLEEVALPOLYSP_HPP */
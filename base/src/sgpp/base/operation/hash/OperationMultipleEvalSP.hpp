@@ -0,0 +1,85 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMULTIPLEEVALSP_HPP
+#define OPERATIONMULTIPLEEVALSP_HPP
+
+#include <sgpp/base/datatypes/DataMatrixSP.hpp>
+#include <sgpp/base/datatypes/DataVectorSP.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * @brief Interface for multiplication with Matrices @f$B@f$ and @f$B^T@f$
+ * in single precision.
+ *
+ * This is the single precision counterpart of OperationMultipleEval. The dataset,
+ * the coefficients and the results are stored in single precision, which halves
+ * the memory traffic. In mixed precision mode, intermediate sums are accumulated
+ * in double precision, otherwise in single precision.
+ */
+class OperationMultipleEvalSP {
+ protected:
+  Grid& grid;
+  DataMatrixSP& dataset;
+  /// whether intermediate sums are accumulated in double precision
+  bool mixedPrecision;
+
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid the sparse grid used for this operation
+   * @param dataset data set that should be evaluated on the sparse grid
+   * @param mixedPrecision accumulate intermediate sums in double precision
+   */
+  OperationMultipleEvalSP(Grid& grid, DataMatrixSP& dataset, bool mixedPrecision = false)
+      : grid(grid), dataset(dataset), mixedPrecision(mixedPrecision) {}
+
+  /**
+   * Destructor
+   */
+  virtual ~OperationMultipleEvalSP() {}
+
+  /**
+   * Multiplication of @f$B^T@f$ with vector @f$\alpha@f$
+   *
+   * @param alpha vector, to which @f$B@f$ is applied. Typically the coefficient vector
+   * @param result the result vector of the matrix vector multiplication
+   */
+  virtual void mult(DataVectorSP& alpha, DataVectorSP& result) = 0;
+
+  /**
+   * Multiplication of @f$B@f$ with vector @f$\alpha@f$
+   *
+   * @param source vector, to which @f$B^T@f$ is applied. Typically the coefficient vector
+   * @param result the result vector of the matrix vector multiplication
+   */
+  virtual void multTranspose(DataVectorSP& source, DataVectorSP& result) = 0;
+
+  /**
+   * Evaluate multiple datapoints with the specified grid
+   *
+   * @param alpha surplus vector of the grid
+   * @param result result of the evaluations
+   */
+  void eval(DataVectorSP& alpha, DataVectorSP& result) { this->mult(alpha, result); }
+
+  /**
+   * @return whether intermediate sums are accumulated in double precision
+   */
+  bool isMixedPrecision() const { return mixedPrecision; }
+
+  virtual double getDuration() = 0;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONMULTIPLEEVALSP_HPP */
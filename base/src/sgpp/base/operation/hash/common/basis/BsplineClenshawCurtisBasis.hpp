@@ -8,6 +8,7 @@
 
 #include <sgpp/base/operation/hash/common/basis/Basis.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineKnotBuffer.hpp>
 #include <sgpp/base/tools/ClenshawCurtisTable.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 
@@ -16,15 +17,15 @@
 #include <algorithm>
 #include <cmath>
 #include <vector>
-#ifdef _OPENMP
-#include <omp.h>
-#endif
 
 namespace sgpp {
 namespace base {
 
 /**
  * B-spline basis on Clenshaw-Curtis grids.
+ *
+ * The knots are constructed in per-call buffers (see BsplineKnotBuffer),
+ * so evaluation is reentrant and thread-safe without locking.
  */
 template <class LT, class IT>
 class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
@@ -42,8 +43,10 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
    */
   explicit BsplineClenshawCurtisBasis(size_t degree)
       : bsplineBasis(BsplineBasis<LT, IT>(degree)),
-        xi(std::vector<double>(degree + 2, 0.0)),
-        clenshawCurtisTable(ClenshawCurtisTable::getInstance()) {}
+        clenshawCurtisTable(ClenshawCurtisTable::getInstance()) {
+    GaussLegendreQuadRule1D::getInstance().getLevelPointsAndWeightsNormalized(
+        (bsplineBasis.getDegree() + 1) / 2, coordinates, weights);
+  }
 
   /**
    * Destructor.
@@ -54,10 +57,11 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of non-uniform B-spline
    *              with knots \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSpline(double x, size_t p, size_t k) const {
+  inline double nonUniformBSpline(double x, size_t p, size_t k, const double* xi) const {
     if (p == 0) {
       // characteristic function of [xi[k], xi[k+1])
       return (((x >= xi[k]) && (x < xi[k + 1])) ? 1.0 : 0.0);
@@ -66,9 +70,9 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
       return 0.0;
     } else {
       // Cox-de-Boor recursion
-      return (x - xi[k]) / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k) +
+      return (x - xi[k]) / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k, xi) +
              (1.0 - (x - xi[k + 1]) / (xi[k + p + 1] - xi[k + 1])) *
-                 nonUniformBSpline(x, p - 1, k + 1);
+                 nonUniformBSpline(x, p - 1, k + 1, xi);
     }
   }
 
@@ -76,10 +80,11 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of derivative of non-uniform B-spline
    *              with knots \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSplineDx(double x, size_t p, size_t k) const {
+  inline double nonUniformBSplineDx(double x, size_t p, size_t k, const double* xi) const {
     if (p == 0) {
       return 0.0;
     } else if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -87,8 +92,8 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
     } else {
       const double pDbl = static_cast<double>(p);
 
-      return pDbl / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k) -
-             pDbl / (xi[k + p + 1] - xi[k + 1]) * nonUniformBSpline(x, p - 1, k + 1);
+      return pDbl / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k, xi) -
+             pDbl / (xi[k + p + 1] - xi[k + 1]) * nonUniformBSpline(x, p - 1, k + 1, xi);
     }
   }
 
@@ -96,10 +101,11 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of 2nd derivative of non-uniform B-spline
    *              with knots \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSplineDxDx(double x, size_t p, size_t k) const {
+  inline double nonUniformBSplineDxDx(double x, size_t p, size_t k, const double* xi) const {
     if (p <= 1) {
       return 0.0;
     } else if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -112,9 +118,9 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
       const double alphaKp1Pm1 = (pDbl - 1.0) / (xi[k + p] - xi[k + 1]);
       const double alphaKp2Pm1 = (pDbl - 1.0) / (xi[k + p + 1] - xi[k + 2]);
 
-      return alphaKP * alphaKPm1 * nonUniformBSpline(x, p - 2, k) -
-             (alphaKP + alphaKp1P) * alphaKp1Pm1 * nonUniformBSpline(x, p - 2, k + 1) +
-             alphaKp1P * alphaKp2Pm1 * nonUniformBSpline(x, p - 2, k + 2);
+      return alphaKP * alphaKPm1 * nonUniformBSpline(x, p - 2, k, xi) -
+             (alphaKP + alphaKp1P) * alphaKp1Pm1 * nonUniformBSpline(x, p - 2, k + 1, xi) +
+             alphaKp1P * alphaKp2Pm1 * nonUniformBSpline(x, p - 2, k + 2, xi);
     }
   }
 
@@ -131,8 +137,9 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
    *
    * @param l     level of basis function
    * @param i     index of basis function
+   * @param xi    output buffer of size p+2 for the knots
    */
-  inline void constructKnots(LT l, IT i) {
+  inline void constructKnots(LT l, IT i, double* xi) const {
     const IT hInv = static_cast<IT>(1) << l;
     const size_t& p = bsplineBasis.getDegree();
 
@@ -194,13 +201,10 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
           x - static_cast<double>(i) + static_cast<double>(bsplineBasis.getDegree() + 1) / 2.0,
           bsplineBasis.getDegree());
     } else {
-      double res = 0.0;
-#pragma omp critical
-      {
-        constructKnots(l, i);
-        res = nonUniformBSpline(x, bsplineBasis.getDegree(), 0);
-      }
-      return res;
+      BsplineKnotBuffer knots(bsplineBasis.getDegree() + 2);
+      double* xi = knots.data();
+      constructKnots(l, i, xi);
+      return nonUniformBSpline(x, bsplineBasis.getDegree(), 0, xi);
     }
   }
 
@@ -217,13 +221,10 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
           x - static_cast<double>(i) + static_cast<double>(bsplineBasis.getDegree() + 1) / 2.0,
           bsplineBasis.getDegree());
     } else {
-      double res = 0.0;
-#pragma omp critical
-      {
-        constructKnots(l, i);
-        res = nonUniformBSplineDx(x, bsplineBasis.getDegree(), 0);
-      }
-      return res;
+      BsplineKnotBuffer knots(bsplineBasis.getDegree() + 2);
+      double* xi = knots.data();
+      constructKnots(l, i, xi);
+      return nonUniformBSplineDx(x, bsplineBasis.getDegree(), 0, xi);
     }
   }
 
@@ -240,13 +241,10 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
           x - static_cast<double>(i) + static_cast<double>(bsplineBasis.getDegree() + 1) / 2.0,
           bsplineBasis.getDegree());
     } else {
-      double res = 0.0;
-#pragma omp critical
-      {
-        constructKnots(l, i);
-        res = nonUniformBSplineDxDx(x, bsplineBasis.getDegree(), 0);
-      }
-      return res;
+      BsplineKnotBuffer knots(bsplineBasis.getDegree() + 2);
+      double* xi = knots.data();
+      constructKnots(l, i, xi);
+      return nonUniformBSplineDxDx(x, bsplineBasis.getDegree(), 0, xi);
     }
   }
 
@@ -266,33 +264,24 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
     }
 
     double res = 0.0;
-
-#pragma omp critical
-    {
-      const IT hInv = static_cast<IT>(1) << l;
-      size_t degree = bsplineBasis.getDegree();
-      size_t erster_abschnitt = std::max(0, -static_cast<int>(i - (degree + 1) / 2));
-      size_t letzter_abschnitt = std::min(degree, hInv + (degree + 1) / 2 - i - 1);
-      size_t quadLevel = (degree + 1) / 2;
-      if (!integrationInitialized) {
-        sgpp::base::GaussLegendreQuadRule1D gauss;
-        gauss.getLevelPointsAndWeightsNormalized(quadLevel, coordinates, weights);
-        integrationInitialized = true;
-      }
-      constructKnots(l, i);
-      for (size_t j = erster_abschnitt; j <= letzter_abschnitt; j++) {
-        double left = std::max(0.0, xi[j]);
-        double right = std::min(1.0, xi[j + 1]);
-        // std::cout << "Left: " << left << std::endl;
-        // std::cout << "Right: " << right << std::endl;
-        double h = right - left;
-        double temp_res = 0.0;
-        for (size_t c = 0; c < quadLevel; c++) {
-          double x = (h * coordinates[c]) + left;
-          temp_res += weights[c] * nonUniformBSpline(x, degree, 0);
-        }
-        res += h * temp_res;
+    const IT hInv = static_cast<IT>(1) << l;
+    size_t degree = bsplineBasis.getDegree();
+    size_t erster_abschnitt = std::max(0, -static_cast<int>(i - (degree + 1) / 2));
+    size_t letzter_abschnitt = std::min(degree, hInv + (degree + 1) / 2 - i - 1);
+    size_t quadLevel = (degree + 1) / 2;
+    BsplineKnotBuffer knots(degree + 2);
+    double* xi = knots.data();
+    constructKnots(l, i, xi);
+    for (size_t j = erster_abschnitt; j <= letzter_abschnitt; j++) {
+      double left = std::max(0.0, xi[j]);
+      double right = std::min(1.0, xi[j + 1]);
+      double h = right - left;
+      double temp_res = 0.0;
+      for (size_t c = 0; c < quadLevel; c++) {
+        double x = (h * coordinates[c]) + left;
+        temp_res += weights[c] * nonUniformBSpline(x, degree, 0, xi);
       }
+      res += h * temp_res;
     }
     return res;
   }
@@ -300,13 +289,12 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
  protected:
   /// B-spline basis for B-spline evaluation
   BsplineBasis<LT, IT> bsplineBasis;
-  /// temporary helper vector of fixed size p+2 containing B-spline knots
-  std::vector<double> xi;
   /// reference to the Clenshaw-Curtis cache table
   ClenshawCurtisTable& clenshawCurtisTable;
+  /// Gauss-Legendre points for the integration of a single knot span
   DataVector coordinates;
+  /// Gauss-Legendre weights for the integration of a single knot span
   DataVector weights;
-  bool integrationInitialized = false;
 };
 
 // default type-def (unsigned int for level and index)
@@ -0,0 +1,62 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BSPLINE_KNOT_BUFFER_HPP
+#define BSPLINE_KNOT_BUFFER_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Per-call storage for the knots of a single non-uniform B-spline.
+ * For the usual (small) degrees, the knots are kept on the stack, so
+ * evaluating bases like BsplineClenshawCurtisBasis requires neither
+ * shared state nor heap allocations and is therefore reentrant.
+ * Only for very large degrees, the buffer falls back to the heap.
+ */
+class BsplineKnotBuffer {
+ public:
+  /// maximal number of knots that are stored on the stack
+  static const size_t MAX_STACK_KNOTS = 16;
+
+  /**
+   * Constructor.
+   *
+   * @param size  number of knots (usually B-spline degree + 2)
+   */
+  explicit BsplineKnotBuffer(size_t size)
+      : heapKnots((size > MAX_STACK_KNOTS) ? size : 0) {
+    knots = (size > MAX_STACK_KNOTS) ? heapKnots.data() : stackKnots;
+  }
+
+  /**
+   * Copying is disabled as knots may point into the object itself.
+   */
+  BsplineKnotBuffer(const BsplineKnotBuffer&) = delete;
+  BsplineKnotBuffer& operator=(const BsplineKnotBuffer&) = delete;
+
+  /**
+   * @return  pointer to the knots
+   */
+  inline double* data() { return knots; }
+
+ protected:
+  /// stack storage for small degrees
+  double stackKnots[MAX_STACK_KNOTS];
+  /// heap storage for large degrees (empty otherwise)
+  std::vector<double> heapKnots;
+  /// pointer to the storage actually used
+  double* knots;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* BSPLINE_KNOT_BUFFER_HPP */
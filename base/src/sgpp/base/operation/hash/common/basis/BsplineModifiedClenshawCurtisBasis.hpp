@@ -8,6 +8,7 @@
 
 #include <sgpp/base/operation/hash/common/basis/Basis.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineKnotBuffer.hpp>
 #include <sgpp/base/tools/ClenshawCurtisTable.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/globaldef.hpp>
@@ -15,15 +16,16 @@
 #include <cmath>
 #include <vector>
 #include <algorithm>
-#ifdef _OPENMP
-#include <omp.h>
-#endif
 
 namespace sgpp {
 namespace base {
 
 /**
  * B-spline basis on Clenshaw-Curtis grids.
+ *
+ * The knots of the non-uniform B-splines are constructed in per-call buffers
+ * (see BsplineKnotBuffer), so all evaluation functions are reentrant and
+ * may be called concurrently from multiple threads without locking.
  */
 template <class LT, class IT>
 class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
@@ -41,26 +43,21 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    */
   explicit BsplineModifiedClenshawCurtisBasis(size_t degree)
       : degree(degree),
-        xi(std::vector<double>(degree + 2, 0.0)),
         clenshawCurtisTable(ClenshawCurtisTable::getInstance()) {
     if (degree < 1) {
       this->degree = 1;
     } else if (degree % 2 == 0) {
       this->degree = degree - 1;
     }
-#ifdef _OPENMP
-    omp_init_nest_lock(&xiLock);
-#endif
+
+    GaussLegendreQuadRule1D::getInstance().getLevelPointsAndWeightsNormalized(
+        (this->degree + 1) / 2, coordinates, weights);
   }
 
   /**
    * Destructor.
    */
-  ~BsplineModifiedClenshawCurtisBasis() override {
-#ifdef _OPENMP
-    omp_destroy_nest_lock(&xiLock);
-#endif
-  }
+  ~BsplineModifiedClenshawCurtisBasis() override {}
 
   /**
    * @param l     level of the grid point
@@ -95,22 +92,17 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
     }
 
     const IT hInv = static_cast<IT>(1) << l;
-    double res = 0.0;
-#ifdef _OPENMP
-    omp_set_nest_lock(&xiLock);
-#endif
+
     if (i == 1) {
-      res = modifiedBSpline(l, hInv, x, degree);
+      return modifiedBSpline(l, hInv, x, degree);
     } else if (i == hInv - 1) {
-      res = modifiedBSpline(l, hInv, 1.0 - x, degree);
+      return modifiedBSpline(l, hInv, 1.0 - x, degree);
     } else {
-      constructKnots(l, i, hInv);
-      res = nonUniformBSpline(x, degree, 0);
+      BsplineKnotBuffer knots(degree + 2);
+      double* xi = knots.data();
+      constructKnots(l, i, hInv, xi);
+      return nonUniformBSpline(x, degree, 0, xi);
     }
-#ifdef _OPENMP
-    omp_unset_nest_lock(&xiLock);
-#endif
-    return res;
   }
 
   /**
@@ -126,23 +118,17 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
     }
 
     const IT hInv = static_cast<IT>(1) << l;
-    double res = 0.0;
 
-#ifdef _OPENMP
-    omp_set_nest_lock(&xiLock);
-#endif
     if (i == 1) {
-      res = modifiedBSplineDx(l, hInv, x, degree);
+      return modifiedBSplineDx(l, hInv, x, degree);
     } else if (i == hInv - 1) {
-      res = -modifiedBSplineDx(l, hInv, 1.0 - x, degree);
+      return -modifiedBSplineDx(l, hInv, 1.0 - x, degree);
     } else {
-      constructKnots(l, i, hInv);
-      res = nonUniformBSplineDx(x, degree, 0);
+      BsplineKnotBuffer knots(degree + 2);
+      double* xi = knots.data();
+      constructKnots(l, i, hInv, xi);
+      return nonUniformBSplineDx(x, degree, 0, xi);
     }
-#ifdef _OPENMP
-    omp_unset_nest_lock(&xiLock);
-#endif
-    return res;
   }
 
   /**
@@ -158,23 +144,17 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
     }
 
     const IT hInv = static_cast<IT>(1) << l;
-    double res = 0.0;
 
-#ifdef _OPENMP
-    omp_set_nest_lock(&xiLock);
-#endif
     if (i == 1) {
-      res = modifiedBSplineDxDx(l, hInv, x, degree);
+      return modifiedBSplineDxDx(l, hInv, x, degree);
     } else if (i == hInv - 1) {
-      res = modifiedBSplineDxDx(l, hInv, 1.0 - x, degree);
+      return modifiedBSplineDxDx(l, hInv, 1.0 - x, degree);
     } else {
-      constructKnots(l, i, hInv);
-      res = nonUniformBSplineDxDx(x, degree, 0);
+      BsplineKnotBuffer knots(degree + 2);
+      double* xi = knots.data();
+      constructKnots(l, i, hInv, xi);
+      return nonUniformBSplineDxDx(x, degree, 0, xi);
     }
-#ifdef _OPENMP
-    omp_unset_nest_lock(&xiLock);
-#endif
-    return res;
   }
 
   /**
@@ -196,20 +176,10 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
     size_t erster_abschnitt = std::max(0, -static_cast<int>(i - (degree + 1) / 2));
     size_t letzter_abschnitt = std::min(degree, hInv + (degree + 1) / 2 - i - 1);
     size_t quadLevel = (degree + 1) / 2;
-#ifdef _OPENMP
-    omp_set_nest_lock(&xiLock);
-#endif
-    if (!integrationInitialized) {
-      sgpp::base::GaussLegendreQuadRule1D gauss;
-      gauss.getLevelPointsAndWeightsNormalized(quadLevel, coordinates, weights);
-      integrationInitialized = true;
-    }
-    constructKnots(l, i, hInv);
+    BsplineKnotBuffer knots(degree + 2);
+    double* xi = knots.data();
+    constructKnots(l, i, hInv, xi);
     for (size_t j = erster_abschnitt; j <= letzter_abschnitt; j++) {
-      // function eval changes the knots if i == 1 or i == hInv - 1; we have to reconstruct them
-      if (i == 1 || i == hInv - 1) {
-        constructKnots(l, i, hInv);
-      }
       double left = std::max(0.0, xi[j]);
       double right = std::min(1.0, xi[j + 1]);
       double h = right - left;
@@ -220,26 +190,18 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
       }
       res += h * temp_res;
     }
-#ifdef _OPENMP
-    omp_unset_nest_lock(&xiLock);
-#endif
     return res;
   }
 
  protected:
   /// degree of the B-spline
   size_t degree;
-  /// temporary helper vector of fixed size p+2 containing B-spline knots
-  std::vector<double> xi;
   /// reference to the Clenshaw-Curtis cache table
   ClenshawCurtisTable& clenshawCurtisTable;
-
-#ifdef _OPENMP
-  omp_nest_lock_t xiLock;
-#endif
+  /// Gauss-Legendre points for the integration of a single knot span
   DataVector coordinates;
+  /// Gauss-Legendre weights for the integration of a single knot span
   DataVector weights;
-  bool integrationInitialized = false;
 
   /**
    * @param l     level of the grid point
@@ -286,8 +248,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param l     level of basis function
    * @param i     index of basis function
    * @param hInv  2^l
+   * @param xi    output buffer of size p+2 for the knots
    */
-  inline void constructKnots(LT l, IT i, IT hInv) {
+  inline void constructKnots(LT l, IT i, IT hInv, double* xi) const {
     const IT degreePlusOneHalved = static_cast<IT>(degree + 1) / 2;
 
     for (IT k = 0; k < degree + 2; k++) {
@@ -306,8 +269,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param l     level of basis function
    * @param ni    negative index -i of basis function
    * @param hInv  2^l
+   * @param xi    output buffer of size p+2 for the knots
    */
-  inline void constructKnotsNegativeIndex(LT l, IT ni, IT hInv) {
+  inline void constructKnotsNegativeIndex(LT l, IT ni, IT hInv, double* xi) const {
     const IT degreePlusOneHalved = static_cast<IT>(degree + 1) / 2;
 
     for (IT k = 0; k < degree + 2; k++) {
@@ -323,10 +287,11 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of non-uniform B-spline with knots
    *              \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSpline(double x, size_t p, size_t k) const {
+  inline double nonUniformBSpline(double x, size_t p, size_t k, const double* xi) const {
     /*if (p == 0) {
      // characteristic function of [xi[k], xi[k+1])
      return (((x >= xi[k]) && (x < xi[k + 1])) ? 1.0 : 0.0);
@@ -336,9 +301,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
      } else {
      // Cox-de-Boor recursion
      return (x - xi[k]) / (xi[k + p] - xi[k])
-     * nonUniformBSpline(x, p - 1, k)
+     * nonUniformBSpline(x, p - 1, k, xi)
      + (xi[k + p + 1] - x) / (xi[k + p + 1] - xi[k + 1])
-     * nonUniformBSpline(x, p - 1, k + 1);
+     * nonUniformBSpline(x, p - 1, k + 1, xi);
      }*/
 
     if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -925,9 +890,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
        }*/
 
       default:
-        return (x - xi[k]) / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k) +
+        return (x - xi[k]) / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k, xi) +
                (xi[k + p + 1] - x) / (xi[k + p + 1] - xi[k + 1]) *
-                   nonUniformBSpline(x, p - 1, k + 1);
+                   nonUniformBSpline(x, p - 1, k + 1, xi);
     }
   }
 
@@ -935,10 +900,11 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of derivative of non-uniform B-spline with knots
    *              \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSplineDx(double x, size_t p, size_t k) const {
+  inline double nonUniformBSplineDx(double x, size_t p, size_t k, const double* xi) const {
     /*if (p == 0) {
      return 0.0;
      } else if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -946,9 +912,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
      } else {
      const double pDbl = static_cast<double>(p);
 
-     return pDbl / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k)
+     return pDbl / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k, xi)
      - pDbl / (xi[k + p + 1] - xi[k + 1])
-     * nonUniformBSpline(x, p - 1, k + 1);
+     * nonUniformBSpline(x, p - 1, k + 1, xi);
      }*/
 
     if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -3101,8 +3067,8 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
       default:
         const double pDbl = static_cast<double>(p);
 
-        return pDbl / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k) -
-               pDbl / (xi[k + p + 1] - xi[k + 1]) * nonUniformBSpline(x, p - 1, k + 1);
+        return pDbl / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k, xi) -
+               pDbl / (xi[k + p + 1] - xi[k + 1]) * nonUniformBSpline(x, p - 1, k + 1, xi);
     }
   }
 
@@ -3110,10 +3076,11 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of 2nd derivative of non-uniform B-spline
    *              with knots \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSplineDxDx(double x, size_t p, size_t k) const {
+  inline double nonUniformBSplineDxDx(double x, size_t p, size_t k, const double* xi) const {
     /*if (p <= 1) {
      return 0.0;
      } else if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -3127,11 +3094,11 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
      const double alphaKp2Pm1 = (pDbl - 1.0) /
      (xi[k + p + 1] - xi[k + 2]);
 
-     return alphaKP * alphaKPm1 * nonUniformBSpline(x, p - 2, k)
+     return alphaKP * alphaKPm1 * nonUniformBSpline(x, p - 2, k, xi)
      - (alphaKP + alphaKp1P) * alphaKp1Pm1
-     * nonUniformBSpline(x, p - 2, k + 1)
+     * nonUniformBSpline(x, p - 2, k + 1, xi)
      + alphaKp1P * alphaKp2Pm1 *
-     nonUniformBSpline(x, p - 2, k + 2);
+     nonUniformBSpline(x, p - 2, k + 2, xi);
      }*/
 
     if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -7464,9 +7431,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
         const double alphaKp1Pm1 = (pDbl - 1.0) / (xi[k + p] - xi[k + 1]);
         const double alphaKp2Pm1 = (pDbl - 1.0) / (xi[k + p + 1] - xi[k + 2]);
 
-        return alphaKP * alphaKPm1 * nonUniformBSpline(x, p - 2, k) -
-               (alphaKP + alphaKp1P) * alphaKp1Pm1 * nonUniformBSpline(x, p - 2, k + 1) +
-               alphaKp1P * alphaKp2Pm1 * nonUniformBSpline(x, p - 2, k + 2);
+        return alphaKP * alphaKPm1 * nonUniformBSpline(x, p - 2, k, xi) -
+               (alphaKP + alphaKp1P) * alphaKp1Pm1 * nonUniformBSpline(x, p - 2, k + 1, xi) +
+               alphaKp1P * alphaKp2Pm1 * nonUniformBSpline(x, p - 2, k + 2, xi);
     }
   }
 
@@ -7478,18 +7445,20 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @return      value of modified
    *              Clenshaw-Curtis B-spline (e.g. index == 1)
    */
-  inline double modifiedBSpline(LT l, IT hInv, double x, size_t p) {
+  inline double modifiedBSpline(LT l, IT hInv, double x, size_t p) const {
+    BsplineKnotBuffer knots(degree + 2);
+    double* xi = knots.data();
     double y = 0.0;
-    constructKnots(l, 1, hInv);
-    y += 1.0 * nonUniformBSpline(x, degree, 0);
-    constructKnots(l, 0, hInv);
-    y += 2.0 * nonUniformBSpline(x, degree, 0);
+    constructKnots(l, 1, hInv, xi);
+    y += 1.0 * nonUniformBSpline(x, degree, 0, xi);
+    constructKnots(l, 0, hInv, xi);
+    y += 2.0 * nonUniformBSpline(x, degree, 0, xi);
 
     // the upper summation bound is defined to be ceil((p + 1) / 2.0),
     // which is the same as (p + 2) / 2 written in C
     for (IT k = 2; k <= (p + 2) / 2; k++) {
-      constructKnotsNegativeIndex(l, k - 1, hInv);
-      y += static_cast<double>(k + 1) * nonUniformBSpline(x, degree, 0);
+      constructKnotsNegativeIndex(l, k - 1, hInv, xi);
+      y += static_cast<double>(k + 1) * nonUniformBSpline(x, degree, 0, xi);
     }
 
     return y;
@@ -7503,18 +7472,20 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @return      value of derivative of modified
    *              Clenshaw-Curtis B-spline (e.g. index == 1)
    */
-  inline double modifiedBSplineDx(LT l, IT hInv, double x, size_t p) {
+  inline double modifiedBSplineDx(LT l, IT hInv, double x, size_t p) const {
+    BsplineKnotBuffer knots(degree + 2);
+    double* xi = knots.data();
     double y = 0.0;
-    constructKnots(l, 1, hInv);
-    y += 1.0 * nonUniformBSplineDx(x, degree, 0);
-    constructKnots(l, 0, hInv);
-    y += 2.0 * nonUniformBSplineDx(x, degree, 0);
+    constructKnots(l, 1, hInv, xi);
+    y += 1.0 * nonUniformBSplineDx(x, degree, 0, xi);
+    constructKnots(l, 0, hInv, xi);
+    y += 2.0 * nonUniformBSplineDx(x, degree, 0, xi);
 
     // the upper summation bound is defined to be ceil((p + 1) / 2.0),
     // which is the same as (p + 2) / 2 written in C
     for (IT k = 2; k <= (p + 2) / 2; k++) {
-      constructKnotsNegativeIndex(l, k - 1, hInv);
-      y += static_cast<double>(k + 1) * nonUniformBSplineDx(x, degree, 0);
+      constructKnotsNegativeIndex(l, k - 1, hInv, xi);
+      y += static_cast<double>(k + 1) * nonUniformBSplineDx(x, degree, 0, xi);
     }
 
     return y;
@@ -7528,18 +7499,20 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @return      value of 2nd derivative of modified
    *              Clenshaw-Curtis B-spline (e.g. index == 1)
    */
-  inline double modifiedBSplineDxDx(LT l, IT hInv, double x, size_t p) {
+  inline double modifiedBSplineDxDx(LT l, IT hInv, double x, size_t p) const {
+    BsplineKnotBuffer knots(degree + 2);
+    double* xi = knots.data();
     double y = 0.0;
-    constructKnots(l, 1, hInv);
-    y += 1.0 * nonUniformBSplineDxDx(x, degree, 0);
-    constructKnots(l, 0, hInv);
-    y += 2.0 * nonUniformBSplineDxDx(x, degree, 0);
+    constructKnots(l, 1, hInv, xi);
+    y += 1.0 * nonUniformBSplineDxDx(x, degree, 0, xi);
+    constructKnots(l, 0, hInv, xi);
+    y += 2.0 * nonUniformBSplineDxDx(x, degree, 0, xi);
 
     // the upper summation bound is defined to be ceil((p + 1) / 2.0),
     // which is the same as (p + 2) / 2 written in C
     for (IT k = 2; k <= (p + 2) / 2; k++) {
-      constructKnotsNegativeIndex(l, k - 1, hInv);
-      y += static_cast<double>(k + 1) * nonUniformBSplineDxDx(x, degree, 0);
+      constructKnotsNegativeIndex(l, k - 1, hInv, xi);
+      y += static_cast<double>(k + 1) * nonUniformBSplineDxDx(x, degree, 0, xi);
     }
 
     return y;
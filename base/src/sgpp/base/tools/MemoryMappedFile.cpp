@@ -0,0 +1,85 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <fstream>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sgpp {
+namespace base {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+    : data(nullptr), size(0), buffer(), isMapped(false) {
+#ifndef _WIN32
+  const int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw file_exception("MemoryMappedFile: could not open file");
+  }
+
+  struct stat fileStatus;
+
+  if (fstat(fd, &fileStatus) != 0) {
+    close(fd);
+    throw file_exception("MemoryMappedFile: could not determine file size");
+  }
+
+  size = static_cast<size_t>(fileStatus.st_size);
+
+  if (size > 0) {
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (mapping != MAP_FAILED) {
+      data = static_cast<const char*>(mapping);
+      isMapped = true;
+    }
+  }
+
+  close(fd);
+
+  if (isMapped || (size == 0)) {
+    return;
+  }
+#endif
+
+  // fallback: read the whole file into an (8-byte aligned) buffer
+  std::ifstream file(filename, std::ios::in | std::ios::binary | std::ios::ate);
+
+  if (!file) {
+    throw file_exception("MemoryMappedFile: could not open file");
+  }
+
+  size = static_cast<size_t>(file.tellg());
+  buffer.resize((size + sizeof(double) - 1) / sizeof(double));
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(size));
+
+  if (!file) {
+    throw file_exception("MemoryMappedFile: could not read file");
+  }
+
+  data = reinterpret_cast<const char*>(buffer.data());
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+#ifndef _WIN32
+  if (isMapped) {
+    munmap(const_cast<char*>(data), size);
+  }
+#endif
+}
+
+}  // namespace base
+}  // namespace sgpp
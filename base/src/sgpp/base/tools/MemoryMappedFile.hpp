@@ -0,0 +1,67 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MEMORYMAPPEDFILE_HPP
+#define MEMORYMAPPEDFILE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only view of a whole file in memory.
+ * On POSIX systems, the file is memory-mapped, i.e., only the pages that are
+ * actually accessed are read from disk and the page cache is shared between processes.
+ * On other systems, the file is read into a buffer.
+ * In both cases, the data is aligned to at least 8 bytes.
+ */
+class MemoryMappedFile {
+ public:
+  /**
+   * Constructor, maps the file.
+   * Throws a file_exception if the file cannot be opened or mapped.
+   *
+   * @param filename  name of the file
+   */
+  explicit MemoryMappedFile(const std::string& filename);
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @return pointer to the contents of the file
+   */
+  inline const char* getData() const { return data; }
+
+  /**
+   * @return size of the file in bytes
+   */
+  inline size_t getSize() const { return size; }
+
+ protected:
+  /// pointer to the contents of the file
+  const char* data;
+  /// size of the file in bytes
+  size_t size;
+  /// buffer if the file could not be mapped
+  std::vector<double> buffer;
+  /// whether data points to a mapping (and not to buffer)
+  bool isMapped;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* MEMORYMAPPEDFILE_HPP */
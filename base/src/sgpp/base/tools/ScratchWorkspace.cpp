@@ -0,0 +1,41 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/ScratchWorkspace.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+ScratchWorkspace::ScratchWorkspace() : vectors(), numberOfAllocations(0) {}
+
+DataVector& ScratchWorkspace::getVector(size_t slot, size_t size) {
+  if (slot >= vectors.size()) {
+    vectors.resize(slot + 1);
+  }
+
+  if (vectors[slot] == nullptr) {
+    vectors[slot].reset(new DataVector(size));
+    numberOfAllocations++;
+  } else {
+    DataVector& vector = *vectors[slot];
+
+    if (size > vector.capacity()) {
+      numberOfAllocations++;
+    }
+
+    vector.resize(size);
+  }
+
+  return *vectors[slot];
+}
+
+void ScratchWorkspace::clear() { vectors.clear(); }
+
+size_t ScratchWorkspace::getNumberOfAllocations() const { return numberOfAllocations; }
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,70 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SCRATCHWORKSPACE_HPP
+#define SCRATCHWORKSPACE_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Pool of temporary vectors that are kept between calls.
+ *
+ * Operations that are called repeatedly (e.g., the system matrix in every iteration
+ * of an iterative solver) can acquire their temporary vectors from a workspace
+ * instead of allocating them on every call. Each vector is identified by a slot
+ * number; its memory is only reallocated if a larger size is requested than ever before.
+ *
+ * The workspace is not thread-safe, i.e., each thread needs its own workspace
+ * (or the slots have to be acquired outside of parallel regions).
+ */
+class ScratchWorkspace {
+ public:
+  /**
+   * Constructor, creates an empty workspace.
+   */
+  ScratchWorkspace();
+
+  /**
+   * Returns the vector of the given slot, resized to the given size.
+   * The contents of the vector are unspecified (they are left over from the
+   * last use of the slot), so callers have to overwrite or reset them.
+   * References to vectors of other slots stay valid.
+   *
+   * @param slot  slot number
+   * @param size  requested size of the vector
+   * @return      vector of the slot
+   */
+  DataVector& getVector(size_t slot, size_t size);
+
+  /**
+   * Frees the memory of all slots.
+   */
+  void clear();
+
+  /**
+   * @return number of (re)allocations performed by this workspace so far
+   */
+  size_t getNumberOfAllocations() const;
+
+ protected:
+  /// vectors of the slots (indirection, such that references stay valid)
+  std::vector<std::unique_ptr<DataVector>> vectors;
+  /// number of (re)allocations performed so far
+  size_t numberOfAllocations;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* SCRATCHWORKSPACE_HPP */
@@ -98,4 +98,35 @@ BOOST_AUTO_TEST_CASE(testFreeRefineSubspaceIsotropic) {
   delete hash_refinement;
 }
 
+BOOST_AUTO_TEST_CASE(testFreeRefineInteractingSubspaces) {
+  // 1D grid with the points (1,1) and (2,1), i.e., the point (2,3) of the subspace of level 2
+  // is missing, but created by refining the subspace of level 1
+  HashGridStorage storage(1);
+  HashGridPoint point(1);
+  point.set(0, 1, 1);
+  storage.insert(point);
+  point.set(0, 2, 1);
+  storage.insert(point);
+  storage.recalcLeafProperty();
+
+  DataVector data_vector(storage.getSize(), 1.0);
+
+  SurplusRefinementFunctor functor(data_vector, 2);
+  HashRefinement* hash_refinement = new HashRefinement();
+
+  SubspaceRefinement subspace_refinement(hash_refinement);
+
+  subspace_refinement.free_refine(storage, functor);
+
+  // both points of level 2 have been refined
+  BOOST_CHECK_EQUAL(storage.getSize(), 7);
+
+  for (HashGridPoint::index_type i = 1; i < 8; i += 2) {
+    point.set(0, 3, i);
+    BOOST_CHECK(storage.isContaining(point));
+  }
+
+  delete hash_refinement;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
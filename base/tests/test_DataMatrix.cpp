@@ -8,6 +8,7 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -421,4 +422,63 @@ BOOST_AUTO_TEST_CASE(resizeToSubMatrixTests) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(viewTests) {
+  size_t rows = 6;
+  size_t cols = 4;
+
+  DataMatrix m(rows, cols);
+
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < cols; ++j) {
+      m(i, j) = static_cast<double>(i * cols + j);
+    }
+  }
+
+  // row views are contiguous and share the data of the matrix
+  sgpp::base::DataVectorView row = m.getRowView(2);
+  BOOST_CHECK_EQUAL(row.getSize(), cols);
+  BOOST_CHECK(row.isContiguous());
+  BOOST_CHECK_EQUAL(row.getPointer(), m.getPointer() + 2 * cols);
+  row.set(1, -1.0);
+  BOOST_CHECK_EQUAL(m(2, 1), -1.0);
+
+  // column views are strided
+  const DataMatrix& cm = m;
+  sgpp::base::ConstDataVectorView col = cm.getColumnView(3);
+  BOOST_CHECK_EQUAL(col.getSize(), rows);
+  BOOST_CHECK_EQUAL(col.getStride(), cols);
+
+  for (size_t i = 0; i < rows; ++i) {
+    BOOST_CHECK_EQUAL(col[i], m(i, 3));
+  }
+
+  DataVector colCopy;
+  col.copyTo(colCopy);
+  DataVector colReference(rows);
+  m.getColumn(3, colReference);
+  BOOST_CHECK(colCopy == colReference);
+
+  // sub-matrix views
+  sgpp::base::ConstDataMatrixView sub = m.getView().getSubMatrix(1, 1, 3, 2);
+  BOOST_CHECK_EQUAL(sub.getNrows(), 3);
+  BOOST_CHECK_EQUAL(sub.getNcols(), 2);
+
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 2; ++j) {
+      BOOST_CHECK_EQUAL(sub(i, j), m(i + 1, j + 1));
+    }
+
+    BOOST_CHECK_EQUAL(sub.getRow(i)[1], m(i + 1, 2));
+  }
+
+  BOOST_CHECK_EQUAL(sub.getColumn(1).get(2), m(3, 2));
+
+  // views of vectors
+  DataVector v(cols, 2.0);
+  sgpp::base::ConstDataVectorView vv(v);
+  BOOST_CHECK_EQUAL(vv.dotProduct(cm.getRowView(0)), 2.0 * (0.0 + 1.0 + 2.0 + 3.0));
+  BOOST_CHECK_THROW(m.getRowView(rows), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(m.getColumnView(cols), sgpp::base::data_exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
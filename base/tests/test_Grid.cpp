@@ -10,8 +10,21 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using sgpp::base::BoundingBox;
+using sgpp::base::BoundingBox1D;
+using sgpp::base::DataVector;
 using sgpp::base::Grid;
 
 BOOST_AUTO_TEST_SUITE(test_Grid)
@@ -30,4 +43,103 @@ BOOST_AUTO_TEST_CASE(test_clone) {
   delete newGrid;
 }
 
+BOOST_AUTO_TEST_CASE(test_serializeBinary) {
+  const size_t dim = 3;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(dim));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(dim, 2));
+  grids.emplace_back(Grid::createModBsplineGrid(dim, 3));
+  grids.emplace_back(Grid::createPolyBoundaryGrid(dim, 2, 1));
+
+  // non-trivial bounding box for the first grid
+  BoundingBox boundingBox(dim);
+  boundingBox.setBoundary(1, BoundingBox1D(-1.0, 2.5));
+  grids[0]->setBoundingBox(boundingBox);
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(3);
+    // mark some points as leaves to check the leaf property
+    grid->getStorage().getPoint(1).setLeaf(true);
+
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = static_cast<double>(i) - 0.25;
+    }
+
+    std::ostringstream ostr;
+    grid->serializeBinary(ostr, &alpha);
+    const std::string data = ostr.str();
+
+    DataVector newAlpha;
+    std::unique_ptr<Grid> newGrid(Grid::unserializeBinary(data.data(), data.size(), &newAlpha));
+
+    // the text serialization must be identical (type, bounding box, parameters, points)
+    BOOST_CHECK_EQUAL(newGrid->serialize(), grid->serialize());
+    BOOST_CHECK_EQUAL(newGrid->getStorage().getPoint(1).isLeaf(), true);
+    BOOST_REQUIRE_EQUAL(newAlpha.getSize(), alpha.getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      BOOST_CHECK_EQUAL(newAlpha[i], alpha[i]);
+    }
+
+    // lookup of points in the new grid
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_EQUAL(newGrid->getStorage().getSequenceNumber(grid->getStorage().getPoint(i)),
+                        i);
+    }
+  }
+
+  // without coefficients, via a memory-mapped file
+  const std::string filename = "test_serializeBinary.grid";
+  grids[2]->serializeBinary(filename);
+  std::unique_ptr<Grid> newGrid(Grid::unserializeBinary(filename));
+  BOOST_CHECK_EQUAL(newGrid->serialize(), grids[2]->serialize());
+
+  DataVector alpha;
+  BOOST_CHECK_THROW(Grid::unserializeBinary(filename, alpha), sgpp::base::file_exception);
+  std::remove(filename.c_str());
+
+  // text format is not accepted
+  const std::string text = grids[0]->serialize();
+  BOOST_CHECK_THROW(Grid::unserializeBinary(text.data(), text.size()),
+                    sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_unserializeBinaryCorruptedHeader) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  DataVector alpha(grid->getSize(), 1.0);
+  std::ostringstream ostr;
+  grid->serializeBinary(ostr, &alpha);
+  const std::string data = ostr.str();
+
+  // patches one 64-bit header entry (dimension at 16, number of points at 24, number of
+  // coefficients at 32, description length at 40) and tries to read the grid
+  auto unserializePatched = [&data](size_t offset, uint64_t value) {
+    std::vector<uint64_t> buffer((data.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    std::memcpy(buffer.data(), data.data(), data.size());
+    buffer[offset / sizeof(uint64_t)] = value;
+    DataVector newAlpha;
+    delete Grid::unserializeBinary(reinterpret_cast<const char*>(buffer.data()), data.size(),
+                                   &newAlpha);
+  };
+
+  for (size_t offset : {16, 24, 32, 40}) {
+    // sizes whose products or sums overflow
+    BOOST_CHECK_THROW(unserializePatched(offset, UINT64_MAX), sgpp::base::file_exception);
+    BOOST_CHECK_THROW(unserializePatched(offset, UINT64_MAX / 4 + 1),
+                      sgpp::base::file_exception);
+    BOOST_CHECK_THROW(unserializePatched(offset, uint64_t{1} << 62),
+                      sgpp::base::file_exception);
+    // sizes that exceed the data
+    BOOST_CHECK_THROW(unserializePatched(offset, data.size()), sgpp::base::file_exception);
+  }
+
+  // truncated data
+  for (size_t size : {size_t{0}, size_t{16}, size_t{48}, data.size() / 2, data.size() - 1}) {
+    BOOST_CHECK_THROW(Grid::unserializeBinary(data.data(), size), sgpp::base::file_exception);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
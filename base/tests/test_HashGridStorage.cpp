@@ -14,11 +14,18 @@
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinementBoundaries.hpp>
 
+#include <omp.h>
+
+#include <list>
+#include <memory>
 #include <string>
+#include <vector>
 
+using sgpp::base::AbstractRefinement;
 using sgpp::base::DataVector;
 using sgpp::base::HashGenerator;
 using sgpp::base::HashGridPoint;
+using sgpp::base::HashGridPointMap;
 using sgpp::base::HashGridStorage;
 using sgpp::base::HashRefinement;
 using sgpp::base::HashRefinementBoundaries;
@@ -193,6 +200,232 @@ BOOST_AUTO_TEST_CASE(testSeq) {
   BOOST_CHECK(s.isInvalidSequenceNumber(seq));
 }
 
+BOOST_AUTO_TEST_CASE(testPointMap) {
+  // points (l, i) with l = 1, ..., 10 and odd i in a 2D grid
+  std::vector<std::unique_ptr<HashGridPoint>> points;
+
+  for (HashGridPoint::level_type l = 1; l <= 10; l++) {
+    for (HashGridPoint::index_type i = 1; i < (1u << l); i += 2) {
+      points.emplace_back(new HashGridPoint(2));
+      points.back()->set(0, l, i);
+      points.back()->set(1, 11 - l, 1);
+    }
+  }
+
+  HashGridPointMap map;
+
+  for (size_t k = 0; k < points.size(); k++) {
+    map[points[k].get()] = k;
+  }
+
+  BOOST_CHECK_EQUAL(map.size(), points.size());
+
+  // lookup by value, not by pointer
+  HashGridPoint query(2);
+
+  for (size_t k = 0; k < points.size(); k++) {
+    query = *points[k];
+    HashGridPointMap::iterator it = map.find(&query);
+    BOOST_REQUIRE(it != map.end());
+    BOOST_CHECK_EQUAL(it->first, points[k].get());
+    BOOST_CHECK_EQUAL(it->second, k);
+  }
+
+  // erase every third point (backward-shift deletion must keep all other entries reachable)
+  for (size_t k = 0; k < points.size(); k += 3) {
+    BOOST_CHECK_EQUAL(map.erase(points[k].get()), 1U);
+    BOOST_CHECK_EQUAL(map.erase(points[k].get()), 0U);
+  }
+
+  size_t numberOfIterated = 0;
+
+  for (HashGridPointMap::const_iterator it = map.begin(); it != map.end(); ++it) {
+    BOOST_CHECK_NE(it->second % 3, 0U);
+    numberOfIterated++;
+  }
+
+  BOOST_CHECK_EQUAL(numberOfIterated, map.size());
+
+  for (size_t k = 0; k < points.size(); k++) {
+    BOOST_CHECK_EQUAL(map.count(points[k].get()), (k % 3 == 0) ? 0U : 1U);
+  }
+
+  map.clear();
+  BOOST_CHECK(map.empty());
+  BOOST_CHECK(map.find(points[1].get()) == map.end());
+}
+
+BOOST_AUTO_TEST_CASE(testDeletePoints) {
+  HashGridStorage s(2);
+  HashGenerator g;
+
+  g.regular(s, 4);
+
+  const size_t size = s.getSize();
+  std::vector<std::unique_ptr<HashGridPoint>> points;
+
+  for (size_t k = 0; k < size; k++) {
+    points.emplace_back(new HashGridPoint(s[k]));
+  }
+
+  std::list<size_t> removePoints;
+
+  for (size_t k = 1; k < size; k += 2) {
+    removePoints.push_back(k);
+  }
+
+  std::vector<size_t> remainingPoints = s.deletePoints(removePoints);
+
+  BOOST_CHECK_EQUAL(s.getSize(), size - removePoints.size());
+  BOOST_CHECK_EQUAL(remainingPoints.size(), s.getSize());
+
+  for (size_t k = 0; k < size; k++) {
+    if (k % 2 == 1) {
+      BOOST_CHECK(!s.isContaining(*points[k]));
+    } else {
+      BOOST_CHECK_EQUAL(s.getSequenceNumber(*points[k]), k / 2);
+      BOOST_CHECK_EQUAL(remainingPoints[k / 2], k);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testInsertPoints) {
+  HashGridStorage s(2);
+  HashGenerator g;
+
+  g.regular(s, 2);
+
+  const size_t size = s.getSize();
+  HashGridPoint p(2);
+  std::vector<HashGridPoint> points;
+
+  // new child of (2, 1) x (1, 1)
+  p.set(0, 3, 1);
+  p.set(1, 1, 1);
+  points.push_back(p);
+  // already contained
+  p.set(0, 1, 1);
+  points.push_back(p);
+  // repeated
+  p.set(0, 3, 1);
+  points.push_back(p);
+  // new child of (2, 3) x (1, 1)
+  p.set(0, 3, 5);
+  points.push_back(p);
+
+  std::vector<size_t> insertedPoints;
+  BOOST_CHECK_EQUAL(s.insertPoints(points, &insertedPoints), 2U);
+  BOOST_CHECK_EQUAL(s.getSize(), size + 2);
+  BOOST_REQUIRE_EQUAL(insertedPoints.size(), 2U);
+  BOOST_CHECK_EQUAL(insertedPoints[0], size);
+  BOOST_CHECK_EQUAL(insertedPoints[1], size + 1);
+  BOOST_CHECK(s[size].equals(points[0]));
+  BOOST_CHECK(s[size + 1].equals(points[3]));
+
+  // leaf property of the new points and their parents
+  BOOST_CHECK(s[size].isLeaf());
+  BOOST_CHECK(s[size + 1].isLeaf());
+  p.set(0, 2, 1);
+  BOOST_CHECK(!s.getPoint(s.getSequenceNumber(p)).isLeaf());
+  p.set(0, 2, 3);
+  BOOST_CHECK(!s.getPoint(s.getSequenceNumber(p)).isLeaf());
+}
+
+BOOST_AUTO_TEST_CASE(testDeferredInsertion) {
+  HashGridStorage s(1);
+  HashGridPoint p(1);
+
+  p.set(0, 1, 1);
+  s.insert(p);
+
+  s.beginDeferredInsertion();
+  BOOST_CHECK(s.isInsertionDeferred());
+  p.set(0, 2, 1);
+  BOOST_CHECK_EQUAL(s.insert(p), HashGridStorage::DEFERRED_SEQUENCE_NUMBER);
+
+  // buffered, but not yet inserted
+  BOOST_CHECK(s.isContaining(p));
+  BOOST_CHECK_EQUAL(s.getSize(), 1U);
+
+  BOOST_CHECK_EQUAL(s.endDeferredInsertion(), 1U);
+  BOOST_CHECK(!s.isInsertionDeferred());
+  BOOST_CHECK_EQUAL(s.getSize(), 2U);
+  BOOST_CHECK_EQUAL(s.getSequenceNumber(p), 1U);
+  BOOST_CHECK(!s[0].isLeaf());
+  BOOST_CHECK(s[1].isLeaf());
+}
+
+/**
+ * Checks that the packed levels and indices of the storage match its grid points.
+ */
+void checkPackedLevelsAndIndices(HashGridStorage& s) {
+  const size_t dim = s.getDimension();
+  const HashGridStorage::packed_level_type* levels = s.getPackedLevels();
+  const HashGridPoint::index_type* indices = s.getPackedIndices();
+
+  for (size_t k = 0; k < s.getSize(); k++) {
+    for (size_t d = 0; d < dim; d++) {
+      BOOST_CHECK_EQUAL(static_cast<size_t>(levels[k * dim + d]), s[k].getLevel(d));
+      BOOST_CHECK_EQUAL(indices[k * dim + d], s[k].getIndex(d));
+    }
+
+    BOOST_CHECK_EQUAL(s.getSequenceNumber(s[k]), k);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPackedLevelsAndIndices) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  g.regular(s, 4);
+  checkPackedLevelsAndIndices(s);
+  BOOST_CHECK_EQUAL(s.getMaxLevel(), 4U);
+
+  // update
+  HashGridPoint p(3);
+  p.set(0, 5, 3);
+  p.set(1, 1, 1);
+  p.set(2, 1, 1);
+  HashGridPoint old(s[2]);
+  s.update(p, 2);
+  checkPackedLevelsAndIndices(s);
+  BOOST_CHECK(!s.isContaining(old));
+  BOOST_CHECK_EQUAL(s.getMaxLevel(), 5U);
+
+  // deletePoints and deleteLast
+  std::list<size_t> removePoints = {0, 3, 7};
+  s.deletePoints(removePoints);
+  checkPackedLevelsAndIndices(s);
+  s.deleteLast();
+  checkPackedLevelsAndIndices(s);
+
+  // insertPoints
+  std::vector<HashGridPoint> points(1, old);
+  BOOST_CHECK_EQUAL(s.insertPoints(points), 1U);
+  checkPackedLevelsAndIndices(s);
+
+  // swapPoints
+  HashGridStorage other(3);
+  g.regular(other, 2);
+  const size_t size = s.getSize();
+  s.swapPoints(other);
+  checkPackedLevelsAndIndices(s);
+  checkPackedLevelsAndIndices(other);
+  BOOST_CHECK_EQUAL(other.getSize(), size);
+
+  // copy, serialization and clear
+  HashGridStorage copy(other);
+  checkPackedLevelsAndIndices(copy);
+  std::string serialized = other.serialize();
+  HashGridStorage unserialized(serialized);
+  checkPackedLevelsAndIndices(unserialized);
+  BOOST_CHECK_EQUAL(unserialized.getMaxLevel(), 5U);
+  other.clear();
+  BOOST_CHECK_EQUAL(other.getMaxLevel(), 0U);
+  g.regular(other, 3);
+  checkPackedLevelsAndIndices(other);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -564,6 +797,24 @@ BOOST_AUTO_TEST_CASE(testRegular3DWithT) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/**
+ * Refinement that refines the grid points one after another and inserts new grid points
+ * immediately (as before the batch insertion was introduced).
+ */
+template <class Refinement>
+class SequentialRefinement : public Refinement {
+ protected:
+  void refineGridpointsCollection(
+      sgpp::base::GridStorage& storage, sgpp::base::RefinementFunctor& functor,
+      AbstractRefinement::refinement_container_type& collection) override {
+    for (AbstractRefinement::refinement_pair_type& pair : collection) {
+      if (pair.second >= functor.getRefinementThreshold()) {
+        this->refineGridpoint(storage, pair.first->getSeq());
+      }
+    }
+  }
+};
+
 BOOST_AUTO_TEST_SUITE(TestHashRefinement)
 
 BOOST_AUTO_TEST_CASE(testFreeRefine) {
@@ -630,6 +881,72 @@ BOOST_AUTO_TEST_CASE(testFreeRefineTruncatedBoundaries2) {
   BOOST_CHECK_EQUAL(s.getSize(), 21U);
 }
 
+BOOST_AUTO_TEST_CASE(testParallelRefinement) {
+  // compare with refining the grid points one after another
+  auto surpluses = [](size_t size) {
+    DataVector alpha(size);
+
+    for (size_t k = 0; k < size; k++) {
+      alpha[k] = static_cast<double>((k * 13) % 11);
+    }
+
+    return alpha;
+  };
+
+  auto refine = [&surpluses](HashGridStorage& s, AbstractRefinement& r, int numThreads) {
+    const int maxThreads = omp_get_max_threads();
+    omp_set_num_threads(numThreads);
+
+    for (size_t step = 0; step < 3; step++) {
+      DataVector alpha = surpluses(s.getSize());
+      SurplusRefinementFunctor f(alpha, 15);
+      r.free_refine(s, f);
+    }
+
+    omp_set_num_threads(maxThreads);
+  };
+
+  for (bool boundary : {false, true}) {
+    HashGenerator g;
+    HashGridStorage reference(3);
+    std::unique_ptr<AbstractRefinement> sequentialRefinement;
+
+    if (boundary) {
+      g.regularWithBoundaries(reference, 2, 1);
+      sequentialRefinement.reset(new SequentialRefinement<HashRefinementBoundaries>());
+    } else {
+      g.regular(reference, 2);
+      sequentialRefinement.reset(new SequentialRefinement<HashRefinement>());
+    }
+
+    refine(reference, *sequentialRefinement, 1);
+
+    for (int numThreads : {1, 2, 3}) {
+      HashGridStorage s(3);
+      std::unique_ptr<AbstractRefinement> r;
+
+      if (boundary) {
+        g.regularWithBoundaries(s, 2, 1);
+        r.reset(new HashRefinementBoundaries());
+      } else {
+        g.regular(s, 2);
+        r.reset(new HashRefinement());
+      }
+
+      refine(s, *r, numThreads);
+      BOOST_REQUIRE_EQUAL(s.getSize(), reference.getSize());
+
+      for (size_t k = 0; k < s.getSize(); k++) {
+        BOOST_CHECK(s[k].equals(reference[k]));
+
+        if (!boundary) {
+          BOOST_CHECK_EQUAL(s[k].isLeaf(), reference[k].isLeaf());
+        }
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testSurplusFunctor) {
   HashGridStorage s(2);
   DataVector d(1);
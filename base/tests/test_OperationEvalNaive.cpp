@@ -18,8 +18,10 @@
 #include <sgpp/base/operation/hash/common/basis/PolyClenshawCurtisBasis.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <memory>
 #include <vector>
 #include <random>
 
@@ -425,3 +427,105 @@ BOOST_AUTO_TEST_CASE(TestOperationEvalNaive) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalNaiveLocalSupport) {
+  // the evaluation of B-spline and polynomial grids descends hierarchically
+  // over the non-zero basis functions, compare with evaluating all basis functions
+  const size_t d = 4;
+  const size_t l = 4;
+  const size_t m = 2;
+  const size_t N = 50;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  for (size_t p : {1, 3, 5}) {
+    // polynomial bases need a degree of at least two
+    const size_t polyDegree = (p < 2) ? 2 : p;
+    std::vector<std::unique_ptr<Grid>> grids;
+    grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+    grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p)));
+    grids.push_back(std::unique_ptr<Grid>(Grid::createPolyGrid(d, polyDegree)));
+    grids.push_back(std::unique_ptr<Grid>(Grid::createModPolyGrid(d, polyDegree)));
+
+    std::vector<std::unique_ptr<SBasis>> bases;
+    bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineBase(p)));
+    bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineModifiedBase(p)));
+    bases.push_back(std::unique_ptr<SBasis>(new SPolyBase(polyDegree)));
+    bases.push_back(std::unique_ptr<SBasis>(new SPolyModifiedBase(polyDegree)));
+
+    for (size_t k = 0; k < grids.size(); k++) {
+      Grid& grid = *grids[k];
+      SBasis& basis = *bases[k];
+      std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(grid));
+
+      // run 0: adaptive grid (descent),
+      // run 1: grid with a point without hierarchical parents (fallback),
+      //        with the same number of points as in run 0
+      for (size_t run = 0; run < 2; run++) {
+        if (run == 0) {
+          grid.getGenerator().regular(l);
+          DataVector refinementAlpha(grid.getSize(), 0.0);
+          refinementAlpha[grid.getSize() / 3] = 1.0;
+          sgpp::base::SurplusRefinementFunctor functor(refinementAlpha, 1);
+          grid.getGenerator().refine(functor);
+        } else {
+          GridPoint orphan(d);
+
+          for (size_t t = 0; t < d; t++) {
+            orphan.set(t, 3, 5);
+          }
+
+          grid.getStorage().deleteLast();
+          grid.getStorage().insert(orphan);
+        }
+
+        const size_t n = grid.getSize();
+        DataMatrix alpha(n, m);
+        DataVector alphaVector(n);
+
+        for (size_t i = 0; i < n; i++) {
+          for (size_t q = 0; q < m; q++) {
+            alpha(i, q) = normalDistribution(generator);
+          }
+
+          alphaVector[i] = alpha(i, 0);
+        }
+
+        DataVector x(d);
+        DataVector fx(m);
+        DataVector fx2(m);
+
+        for (size_t r = 0; r < N; r++) {
+          for (size_t t = 0; t < d; t++) {
+            x[t] = uniformDistribution(generator);
+          }
+
+          fx.setAll(0.0);
+
+          for (size_t i = 0; i < n; i++) {
+            GridPoint& gp = grid.getStorage().getPoint(i);
+            double val = 1.0;
+
+            for (size_t t = 0; t < d; t++) {
+              val *= basisEval(basis, gp.getLevel(t), gp.getIndex(t), x[t]);
+            }
+
+            for (size_t q = 0; q < m; q++) {
+              fx[q] += alpha(i, q) * val;
+            }
+          }
+
+          BOOST_CHECK_SMALL(fx[0] - opEval->eval(alphaVector, x), 1e-10);
+          opEval->eval(alpha, x, fx2);
+
+          for (size_t q = 0; q < m; q++) {
+            BOOST_CHECK_SMALL(fx[q] - fx2[q], 1e-10);
+          }
+        }
+      }
+    }
+  }
+}
@@ -7,17 +7,28 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixSP.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorSP.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <memory>
+#include <vector>
+
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
+using sgpp::base::DataMatrixSP;
 using sgpp::base::DataVector;
+using sgpp::base::DataVectorSP;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
+using sgpp::base::OperationEval;
 using sgpp::base::OperationMultipleEval;
+using sgpp::base::OperationMultipleEvalSP;
+using sgpp::base::SurplusRefinementFunctor;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
 
@@ -78,4 +89,206 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBsplineClenshawCurtisNaive) {
+  // the naive multi-evaluations of the Clenshaw-Curtis B-spline grids run
+  // in parallel; compare them with a sequential point-wise evaluation
+  const size_t dim = 3;
+  const size_t degree = 3;
+  const size_t numberDataPoints = 100;
+  std::unique_ptr<Grid> grids[] = {
+      std::unique_ptr<Grid>(Grid::createBsplineClenshawCurtisGrid(dim, degree)),
+      std::unique_ptr<Grid>(Grid::createModBsplineClenshawCurtisGrid(dim, degree))};
+
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = static_cast<double>((7 * i + 13 * t) % numberDataPoints) /
+                      static_cast<double>(numberDataPoints);
+    }
+  }
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(4);
+    const size_t N = grid->getSize();
+    DataVector alpha(N);
+
+    for (size_t i = 0; i < N; i++) {
+      alpha[i] = static_cast<double>(i % 7) - 3.0;
+    }
+
+    DataVector result(numberDataPoints);
+    std::unique_ptr<OperationMultipleEval>(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset))
+        ->mult(alpha, result);
+
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+    DataVector point(dim);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      dataset.getRow(i, point);
+      BOOST_CHECK_SMALL(result[i] - opEval->eval(alpha, point), 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMultTranspose) {
+  // the transposed evaluation reuses its per-thread scratch vectors between calls;
+  // compare repeated calls (also after the grid has grown) with B^T computed column-wise
+  // (the linear grid uses AlgorithmMultipleEvaluation, the other grids AlgorithmDGEMV)
+  const size_t dim = 2;
+  const size_t numberDataPoints = 50;
+  std::unique_ptr<Grid> grids[] = {std::unique_ptr<Grid>(Grid::createLinearGrid(dim)),
+                                   std::unique_ptr<Grid>(Grid::createModLinearGrid(dim)),
+                                   std::unique_ptr<Grid>(Grid::createLinearBoundaryGrid(dim)),
+                                   std::unique_ptr<Grid>(Grid::createPolyGrid(dim, 3))};
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector source(numberDataPoints);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = static_cast<double>((7 * i + 13 * t) % numberDataPoints) /
+                      static_cast<double>(numberDataPoints);
+    }
+
+    source[i] = static_cast<double>(i % 5) - 2.0;
+  }
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(3);
+    std::unique_ptr<OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+    for (size_t run = 0; run < 3; run++) {
+      if (run == 2) {
+        DataVector refinementIndicator(grid->getSize(), 1.0);
+        SurplusRefinementFunctor functor(refinementIndicator, 5);
+        grid->getGenerator().refine(functor);
+      }
+
+      const size_t N = grid->getSize();
+      DataVector result(N);
+      op->multTranspose(source, result);
+
+      DataVector unitVector(N, 0.0);
+      DataVector column(numberDataPoints);
+
+      for (size_t i = 0; i < N; i++) {
+        unitVector[i] = 1.0;
+        op->mult(unitVector, column);
+        unitVector[i] = 0.0;
+        BOOST_CHECK_SMALL(result[i] - column.dotProduct(source), 1e-12);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalSP) {
+  // compare the single and mixed precision multi-evaluations with the double precision ones
+  const size_t dim = 3;
+  const size_t numberDataPoints = 200;
+  std::unique_ptr<Grid> grids[] = {std::unique_ptr<Grid>(Grid::createLinearGrid(dim)),
+                                   std::unique_ptr<Grid>(Grid::createModLinearGrid(dim)),
+                                   std::unique_ptr<Grid>(Grid::createPolyGrid(dim, 3))};
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataMatrixSP datasetSP(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      // exactly representable in single precision
+      datasetSP.set(i, t, static_cast<float>((7 * i + 13 * t) % 256) / 256.0f);
+      dataset(i, t) = static_cast<double>(datasetSP.get(i, t));
+    }
+  }
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(4);
+    const size_t N = grid->getSize();
+    DataVector alpha(N);
+    DataVectorSP alphaSP(N);
+    DataVector source(numberDataPoints);
+    DataVectorSP sourceSP(numberDataPoints);
+
+    for (size_t i = 0; i < N; i++) {
+      alpha[i] = static_cast<double>(i % 7) - 3.0;
+      alphaSP[i] = static_cast<float>(alpha[i]);
+    }
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      source[i] = static_cast<double>(i % 5) - 2.0;
+      sourceSP[i] = static_cast<float>(source[i]);
+    }
+
+    std::unique_ptr<OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    DataVector result(numberDataPoints);
+    DataVector resultTransposed(N);
+    op->mult(alpha, result);
+    op->multTranspose(source, resultTransposed);
+
+    for (bool mixedPrecision : {false, true}) {
+      std::unique_ptr<OperationMultipleEvalSP> opSP(
+          sgpp::op_factory::createOperationMultipleEvalSP(*grid, datasetSP, mixedPrecision));
+      BOOST_CHECK_EQUAL(opSP->isMixedPrecision(), mixedPrecision);
+      DataVectorSP resultSP(numberDataPoints);
+      DataVectorSP resultTransposedSP(N);
+      opSP->mult(alphaSP, resultSP);
+      opSP->multTranspose(sourceSP, resultTransposedSP);
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        BOOST_CHECK_SMALL(static_cast<double>(resultSP[i]) - result[i], 1e-4);
+      }
+
+      for (size_t i = 0; i < N; i++) {
+        BOOST_CHECK_SMALL(static_cast<double>(resultTransposedSP[i]) - resultTransposed[i],
+                          mixedPrecision ? 1e-5 : 1e-3);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationEvalView) {
+  const size_t dim = 3;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModLinearGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(dim, 3)));
+
+  DataMatrix points(5, dim);
+
+  for (size_t i = 0; i < points.getNrows(); i++) {
+    for (size_t t = 0; t < dim; t++) {
+      points(i, t) = 0.05 + 0.9 * static_cast<double>((7 * i + 3 * t) % 11) / 10.0;
+    }
+  }
+
+  DataMatrix pointsTransposed(points);
+  pointsTransposed.transpose();
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(3);
+    DataVector alpha(grid->getSize());
+
+    for (size_t k = 0; k < alpha.getSize(); k++) {
+      alpha[k] = 1.0 + static_cast<double>(k % 5);
+    }
+
+    std::unique_ptr<OperationEval> opEval(
+        (grid->getType() == sgpp::base::GridType::Bspline)
+            ? sgpp::op_factory::createOperationEvalNaive(*grid)
+            : sgpp::op_factory::createOperationEval(*grid));
+    DataVector point(dim);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      points.getRow(i, point);
+      const double reference = opEval->eval(alpha, point);
+      // contiguous view of a row and strided view of a column
+      BOOST_CHECK_EQUAL(opEval->eval(alpha, points.getRowView(i)), reference);
+      BOOST_CHECK_EQUAL(opEval->eval(alpha, pointsTransposed.getColumnView(i)), reference);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
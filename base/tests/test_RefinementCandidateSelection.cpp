@@ -0,0 +1,233 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusCoarseningFunctor.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashCoarsening.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashRefinementBoundaries.hpp>
+#include <sgpp/base/grid/generation/refinement_strategy/SubspaceRefinement.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using sgpp::base::AbstractRefinement;
+using sgpp::base::DataVector;
+using sgpp::base::GridPoint;
+using sgpp::base::GridStorage;
+using sgpp::base::HashCoarsening;
+using sgpp::base::HashGenerator;
+using sgpp::base::HashGridStorage;
+using sgpp::base::HashRefinement;
+using sgpp::base::HashRefinementBoundaries;
+using sgpp::base::RefinementFunctor;
+using sgpp::base::SubspaceRefinement;
+using sgpp::base::SurplusCoarseningFunctor;
+using sgpp::base::SurplusRefinementFunctor;
+
+namespace {
+
+/**
+ * Sequential candidate selection as it was done before the indicators were computed in parallel:
+ * loop over the storage, add the indicators of each refinable grid point to the collection.
+ */
+template <class Refinement>
+class SequentialSelection : public Refinement {
+ public:
+  using Refinement::Refinement;
+
+  void collect(GridStorage& storage, RefinementFunctor& functor,
+               AbstractRefinement::refinement_container_type& collection) {
+    this->collectRefinablePoints(storage, functor, collection);
+  }
+
+  void collectSequential(GridStorage& storage, RefinementFunctor& functor,
+                         AbstractRefinement::refinement_container_type& collection) {
+    GridPoint point;
+
+    for (GridStorage::grid_map_iterator iter = storage.begin(); iter != storage.end(); iter++) {
+      point = *(iter->first);
+
+      if (this->hasMissingChild(storage, point)) {
+        this->addElementToCollection(iter, this->getIndicator(storage, iter, functor),
+                                     functor.getRefinementsNum(), collection);
+      }
+    }
+  }
+};
+
+/**
+ * Surpluses with many equal absolute values, so the order of the selection matters.
+ */
+DataVector createSurpluses(size_t size) {
+  DataVector alpha(size);
+
+  for (size_t i = 0; i < size; i++) {
+    alpha[i] = static_cast<double>((i * 7) % 5) - 2.0;
+  }
+
+  return alpha;
+}
+
+void checkEqualCollections(const AbstractRefinement::refinement_container_type& collection,
+                           const AbstractRefinement::refinement_container_type& reference) {
+  BOOST_REQUIRE_EQUAL(collection.size(), reference.size());
+
+  for (size_t i = 0; i < collection.size(); i++) {
+    BOOST_CHECK_EQUAL(collection[i].first->getSeq(), reference[i].first->getSeq());
+    BOOST_CHECK_EQUAL(collection[i].second, reference[i].second);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestRefinementCandidateSelection)
+
+BOOST_AUTO_TEST_CASE(testHashRefinement) {
+  const int maxThreads = omp_get_max_threads();
+  HashGridStorage storage(3);
+  HashGenerator().regular(storage, 5);
+  DataVector alpha = createSurpluses(storage.getSize());
+  SurplusRefinementFunctor functor(alpha, 20);
+  SequentialSelection<HashRefinement> refinement;
+
+  AbstractRefinement::refinement_container_type reference;
+  refinement.collectSequential(storage, functor, reference);
+  BOOST_CHECK_EQUAL(reference.size(), 20);
+
+  for (int threads : {1, 2, 3}) {
+    omp_set_num_threads(threads);
+    AbstractRefinement::refinement_container_type collection;
+    refinement.collect(storage, functor, collection);
+    checkEqualCollections(collection, reference);
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
+BOOST_AUTO_TEST_CASE(testHashRefinementBoundaries) {
+  const int maxThreads = omp_get_max_threads();
+  HashGridStorage storage(3);
+  HashGenerator().regularWithBoundaries(storage, 4, 1);
+  DataVector alpha = createSurpluses(storage.getSize());
+  SurplusRefinementFunctor functor(alpha, 25);
+  SequentialSelection<HashRefinementBoundaries> refinement;
+
+  AbstractRefinement::refinement_container_type reference;
+  refinement.collectSequential(storage, functor, reference);
+  BOOST_CHECK_EQUAL(reference.size(), 25);
+
+  for (int threads : {1, 2, 3}) {
+    omp_set_num_threads(threads);
+    AbstractRefinement::refinement_container_type collection;
+    refinement.collect(storage, functor, collection);
+    checkEqualCollections(collection, reference);
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
+BOOST_AUTO_TEST_CASE(testSubspaceRefinement) {
+  const int maxThreads = omp_get_max_threads();
+  HashGridStorage storage(3);
+  HashGenerator().regular(storage, 5);
+  DataVector alpha = createSurpluses(storage.getSize());
+  const size_t refinementsNum = 4;
+  SurplusRefinementFunctor functor(alpha, refinementsNum);
+  HashRefinement hashRefinement;
+  SequentialSelection<SubspaceRefinement> refinement(&hashRefinement);
+
+  // previous implementation: add to the collection grid point by grid point,
+  // then keep the subspaces with the largest sums
+  AbstractRefinement::refinement_container_type reference;
+  refinement.collectSequential(storage, functor, reference);
+  BOOST_REQUIRE_GT(reference.size(), refinementsNum);
+  std::nth_element(reference.begin(), reference.begin() + refinementsNum, reference.end(),
+                   AbstractRefinement::compare_pairs);
+  reference.resize(refinementsNum);
+
+  for (int threads : {1, 2, 3}) {
+    omp_set_num_threads(threads);
+    AbstractRefinement::refinement_container_type collection;
+    refinement.collect(storage, functor, collection);
+    checkEqualCollections(collection, reference);
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
+BOOST_AUTO_TEST_CASE(testHashCoarsening) {
+  const int maxThreads = omp_get_max_threads();
+  HashGridStorage referenceStorage(3);
+  HashGenerator().regular(referenceStorage, 5);
+  DataVector alpha = createSurpluses(referenceStorage.getSize());
+  const size_t removementsNum = 30;
+  SurplusCoarseningFunctor functor(alpha, removementsNum, 1.5);
+
+  // previous implementation: array of candidates, the first one with the maximal value is
+  // replaced by smaller values
+  std::vector<std::pair<size_t, double>> candidates(removementsNum,
+                                                    std::make_pair(0, functor.start()));
+  size_t maxIndex = 0;
+
+  for (size_t z = 0; z < referenceStorage.getSize(); z++) {
+    if (referenceStorage.getPoint(z).isLeaf()) {
+      const double value = functor(referenceStorage, z);
+
+      if (value < candidates[maxIndex].second) {
+        candidates[maxIndex] = std::make_pair(z, value);
+        maxIndex = 0;
+
+        for (size_t i = 1; i < removementsNum; i++) {
+          if (candidates[i].second > candidates[maxIndex].second) {
+            maxIndex = i;
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<size_t> referenceSeq;
+
+  for (const std::pair<size_t, double>& candidate : candidates) {
+    if ((candidate.second < functor.start()) &&
+        (candidate.second <= functor.getCoarseningThreshold())) {
+      referenceSeq.push_back(candidate.first);
+    }
+  }
+
+  BOOST_CHECK_EQUAL(referenceSeq.size(), removementsNum);
+
+  for (int threads : {1, 2, 3}) {
+    omp_set_num_threads(threads);
+    HashGridStorage storage(3);
+    HashGenerator().regular(storage, 5);
+    DataVector alphaCopy(alpha);
+    SurplusCoarseningFunctor functorCopy(alphaCopy, removementsNum, 1.5);
+    std::vector<size_t> removedSeq;
+    HashCoarsening().free_coarsen(storage, functorCopy, alphaCopy, nullptr, &removedSeq);
+
+    BOOST_REQUIRE_EQUAL(removedSeq.size(), referenceSeq.size());
+
+    for (size_t i = 0; i < referenceSeq.size(); i++) {
+      BOOST_CHECK_EQUAL(removedSeq[i], referenceSeq[i]);
+    }
+
+    BOOST_CHECK_EQUAL(storage.getSize(), referenceStorage.getSize() - removedSeq.size());
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/ScratchWorkspace.hpp>
+
+using sgpp::base::DataVector;
+using sgpp::base::ScratchWorkspace;
+
+BOOST_AUTO_TEST_SUITE(TestScratchWorkspace)
+
+BOOST_AUTO_TEST_CASE(testReuse) {
+  ScratchWorkspace workspace;
+  BOOST_CHECK_EQUAL(workspace.getNumberOfAllocations(), 0);
+
+  DataVector& a = workspace.getVector(0, 100);
+  DataVector& b = workspace.getVector(3, 50);
+  BOOST_CHECK_EQUAL(a.getSize(), 100);
+  BOOST_CHECK_EQUAL(b.getSize(), 50);
+  BOOST_CHECK_EQUAL(workspace.getNumberOfAllocations(), 2);
+
+  a.setAll(1.0);
+  const double* data = a.getPointer();
+
+  // acquiring other slots must not invalidate references
+  for (size_t slot = 4; slot < 20; slot++) {
+    workspace.getVector(slot, 1);
+  }
+
+  BOOST_CHECK_EQUAL(a[99], 1.0);
+  BOOST_CHECK_EQUAL(workspace.getNumberOfAllocations(), 18);
+
+  // shrinking and growing up to the old size reuses the memory
+  for (size_t run = 0; run < 10; run++) {
+    DataVector& c = workspace.getVector(0, (run % 2 == 0) ? 10 : 100);
+    BOOST_CHECK(&c == &a);
+    BOOST_CHECK(c.getPointer() == data);
+  }
+
+  BOOST_CHECK_EQUAL(workspace.getNumberOfAllocations(), 18);
+
+  // growing beyond the capacity reallocates
+  BOOST_CHECK_EQUAL(workspace.getVector(0, 1000).getSize(), 1000);
+  BOOST_CHECK_EQUAL(workspace.getNumberOfAllocations(), 19);
+
+  workspace.clear();
+  BOOST_CHECK_EQUAL(workspace.getVector(0, 10).getSize(), 10);
+  BOOST_CHECK_EQUAL(workspace.getNumberOfAllocations(), 20);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
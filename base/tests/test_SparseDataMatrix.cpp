@@ -0,0 +1,84 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/SparseDataMatrix.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::SparseDataMatrix;
+using sgpp::base::data_exception;
+
+BOOST_AUTO_TEST_SUITE(TestSparseDataMatrix)
+
+BOOST_AUTO_TEST_CASE(testAccessAndMult) {
+  // 3 x 4 matrix
+  // [1 0 2 0]
+  // [0 0 0 0]
+  // [0 3 0 4]
+  SparseDataMatrix m(3, 4, {0, 2, 2, 4}, {0, 2, 1, 3}, {1.0, 2.0, 3.0, 4.0});
+
+  BOOST_CHECK_EQUAL(m.getNrows(), 3);
+  BOOST_CHECK_EQUAL(m.getNcols(), 4);
+  BOOST_CHECK_EQUAL(m.getNnz(), 4);
+  BOOST_CHECK_EQUAL(m.get(0, 2), 2.0);
+  BOOST_CHECK_EQUAL(m.get(0, 1), 0.0);
+  BOOST_CHECK_EQUAL(m.get(1, 3), 0.0);
+  BOOST_CHECK_EQUAL(m.get(2, 3), 4.0);
+  BOOST_CHECK_THROW(m.get(3, 0), data_exception);
+
+  DataVector x(4);
+  x[0] = 1.0;
+  x[1] = 2.0;
+  x[2] = 3.0;
+  x[3] = 4.0;
+  DataVector result(3);
+  m.mult(x, result);
+  BOOST_CHECK_EQUAL(result[0], 7.0);
+  BOOST_CHECK_EQUAL(result[1], 0.0);
+  BOOST_CHECK_EQUAL(result[2], 22.0);
+
+  DataVector wrongSize(3);
+  BOOST_CHECK_THROW(m.mult(wrongSize, result), data_exception);
+
+  DataMatrix dense;
+  m.toDense(dense);
+  BOOST_CHECK_EQUAL(dense.getNrows(), 3);
+  BOOST_CHECK_EQUAL(dense.getNcols(), 4);
+
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 4; j++) {
+      BOOST_CHECK_EQUAL(dense.get(i, j), m.get(i, j));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testInvalidArrays) {
+  SparseDataMatrix m;
+  BOOST_CHECK_EQUAL(m.getNrows(), 0);
+  BOOST_CHECK_EQUAL(m.getNnz(), 0);
+
+  // wrong number of row pointers
+  BOOST_CHECK_THROW(m.assign(2, 2, {0, 1}, {0}, {1.0}), data_exception);
+  // column index out of range
+  BOOST_CHECK_THROW(m.assign(2, 2, {0, 1, 1}, {2}, {1.0}), data_exception);
+  // unsorted column indices
+  BOOST_CHECK_THROW(m.assign(1, 2, {0, 2}, {1, 0}, {1.0, 2.0}), data_exception);
+  // the matrix is unchanged after a failed assignment
+  BOOST_CHECK_EQUAL(m.getNrows(), 0);
+
+  m.assign(2, 2, {0, 1, 2}, {1, 0}, {1.0, 2.0});
+  BOOST_CHECK_EQUAL(m.get(0, 1), 1.0);
+  BOOST_CHECK_EQUAL(m.get(1, 0), 2.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
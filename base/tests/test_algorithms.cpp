@@ -7,6 +7,12 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/algorithm/sweep.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/HierarchisationLinear.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/HierarchisationLinearBoundary.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/HierarchisationModLinear.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/HierarchisationPoly.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearClenshawCurtisBoundaryBasis.hpp>
@@ -15,6 +21,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -22,13 +29,20 @@
 
 using sgpp::base::DataVector;
 using sgpp::base::BoundingBox1D;
+using sgpp::base::Grid;
 using sgpp::base::GridPoint;
 using sgpp::base::GridStorage;
+using sgpp::base::HierarchisationLinear;
+using sgpp::base::HierarchisationLinearBoundary;
+using sgpp::base::HierarchisationModLinear;
+using sgpp::base::HierarchisationPoly;
 using sgpp::base::index_t;
 using sgpp::base::level_t;
 using sgpp::base::SBasis;
+using sgpp::base::SPolyBase;
 using sgpp::base::Stretching;
 using sgpp::base::Stretching1D;
+using sgpp::base::sweep;
 
 void basisTest(SBasis& basis, const std::vector<level_t>& levels,
                const std::vector<index_t>& indices, const std::vector<double>& points,
@@ -497,4 +511,62 @@ BOOST_AUTO_TEST_CASE(TestGetAffectedBasisFunctionsStretched) {
   BOOST_CHECK_CLOSE(x[0].second, 1.0384615384615385, 1e-5);
 }
 
+/**
+ * Checks that the parallel sweep of the functor yields exactly the same results as the
+ * sequential one (in all dimensions of the grid).
+ */
+template <class FUNC>
+void checkSweepParallel(FUNC& func, GridStorage& storage, bool boundary) {
+  DataVector sequential(storage.getSize());
+
+  for (size_t i = 0; i < sequential.getSize(); i++) {
+    sequential[i] = static_cast<double>((i * 37) % 101) / 101.0;
+  }
+
+  DataVector parallel(sequential);
+  sweep<FUNC> s(func, storage);
+
+  for (size_t t = 0; t < storage.getDimension(); t++) {
+    if (boundary) {
+      s.sweep1D_Boundary(sequential, sequential, t);
+      s.sweep1D_Boundary_Parallel(parallel, parallel, t);
+    } else {
+      s.sweep1D(sequential, sequential, t);
+      s.sweep1D_Parallel(parallel, parallel, t);
+    }
+  }
+
+  for (size_t i = 0; i < sequential.getSize(); i++) {
+    BOOST_CHECK_EQUAL(sequential[i], parallel[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSweepParallel) {
+  // the parallel sweeps have to yield exactly the same results as the sequential ones
+  const size_t dim = 4;
+  const size_t level = 6;
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  HierarchisationLinear funcLinear(grid->getStorage());
+  checkSweepParallel(funcLinear, grid->getStorage(), false);
+
+  std::unique_ptr<Grid> boundaryGrid(Grid::createLinearBoundaryGrid(dim, 0));
+  boundaryGrid->getGenerator().regular(level);
+  HierarchisationLinearBoundary funcLinearBoundary(boundaryGrid->getStorage());
+  checkSweepParallel(funcLinearBoundary, boundaryGrid->getStorage(), true);
+
+  std::unique_ptr<Grid> modLinearGrid(Grid::createModLinearGrid(dim));
+  modLinearGrid->getGenerator().regular(level);
+  HierarchisationModLinear funcModLinear(modLinearGrid->getStorage());
+  checkSweepParallel(funcModLinear, modLinearGrid->getStorage(), false);
+
+  const size_t degree = 3;
+  std::unique_ptr<Grid> polyGrid(Grid::createPolyGrid(dim, degree));
+  polyGrid->getGenerator().regular(level);
+  SPolyBase polyBase(degree);
+  HierarchisationPoly funcPoly(polyGrid->getStorage(), &polyBase);
+  checkSweepParallel(funcPoly, polyGrid->getStorage(), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/combigrid/grid/distribution/LejaPointDistribution.hpp>
+#include <sgpp/combigrid/grid/growth/LinearGrowthStrategy.hpp>
+#include <sgpp/combigrid/grid/hierarchy/NestedPointHierarchy.hpp>
+#include <sgpp/combigrid/grid/ordering/IdentityPointOrdering.hpp>
+#include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/operation/multidim/AveragingLevelManager.hpp>
+#include <sgpp/combigrid/operation/multidim/CombigridEvaluator.hpp>
+#include <sgpp/combigrid/operation/multidim/fullgrid/FullGridCallbackEvaluator.hpp>
+#include <sgpp/combigrid/operation/onedim/PolynomialInterpolationEvaluator.hpp>
+#include <sgpp/combigrid/storage/tree/CombigridTreeStorage.hpp>
+#include <sgpp/combigrid/utils/Stopwatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using sgpp::combigrid::AbstractLinearEvaluator;
+using sgpp::combigrid::AbstractPointHierarchy;
+using sgpp::combigrid::CombigridTreeStorage;
+using sgpp::combigrid::FloatScalarVector;
+
+/**
+ * Cheap model function.
+ */
+double cheapFunction(sgpp::base::DataVector const &x) {
+  double prod = 1.0;
+
+  for (size_t t = 0; t < x.getSize(); ++t) {
+    prod *= std::exp(-x[t] * x[t]);
+  }
+
+  return prod;
+}
+
+/**
+ * Expensive model function (the same function, evaluated many times).
+ */
+double expensiveFunction(sgpp::base::DataVector const &x) {
+  double result = 0.0;
+
+  for (size_t k = 0; k < 2000; ++k) {
+    result += cheapFunction(x);
+  }
+
+  return result / 2000.0;
+}
+
+/**
+ * Precomputes the function values of a regular combination technique in parallel and prints the
+ * throughput.
+ */
+void measure(const std::string &name,
+             std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies,
+             std::shared_ptr<CombigridTreeStorage> storage, size_t maxLevelSum,
+             size_t numThreads) {
+  const size_t numDimensions = pointHierarchies.size();
+  std::vector<std::shared_ptr<AbstractLinearEvaluator<FloatScalarVector>>> evaluators(
+      numDimensions, std::make_shared<sgpp::combigrid::PolynomialInterpolationEvaluator>());
+  auto fullGridEval =
+      std::make_shared<sgpp::combigrid::FullGridCallbackEvaluator<FloatScalarVector>>(
+          storage, evaluators, pointHierarchies);
+  auto combiGridEval = std::make_shared<sgpp::combigrid::CombigridEvaluator<FloatScalarVector>>(
+      numDimensions, fullGridEval);
+  auto levelManager = std::make_shared<sgpp::combigrid::AveragingLevelManager>(combiGridEval);
+
+  fullGridEval->setParameters(
+      std::vector<FloatScalarVector>(numDimensions, FloatScalarVector(0.3)));
+
+  sgpp::combigrid::Stopwatch stopwatch;
+  levelManager->addRegularLevelsParallel(maxLevelSum, numThreads);
+  double time = stopwatch.elapsedSeconds();
+
+  std::cout << "  " << name << ": " << storage->getNumEntries() << " points in " << time
+            << "s (" << static_cast<double>(storage->getNumEntries()) / time << " points/s)\n";
+}
+
+/**
+ * Adds levels adaptively in parallel and prints the throughput.
+ */
+void measureAdaptive(sgpp::combigrid::MultiFunction func, size_t numDimensions,
+                     size_t maxNumPoints, size_t numThreads) {
+  auto op = sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+      numDimensions, func);
+  op->setParameters(sgpp::base::DataVector(numDimensions, 0.3));
+
+  sgpp::combigrid::Stopwatch stopwatch;
+  op->getLevelManager()->addLevelsAdaptiveParallel(maxNumPoints, numThreads);
+  double time = stopwatch.elapsedSeconds();
+
+  std::cout << "  " << numThreads << " thread(s): " << op->numGridPoints() << " points in " << time
+            << "s (" << static_cast<double>(op->numGridPoints()) / time << " points/s)\n";
+}
+
+/**
+ * Compares one task per grid point with batched tasks (ThreadPool, FullGridCallbackEvaluator)
+ * for a cheap and an expensive model function and measures the scaling of the adaptive
+ * parallel level addition.
+ */
+int main() {
+  const size_t numDimensions = 4;
+  const size_t numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+  for (bool expensive : {false, true}) {
+    auto func = expensive ? expensiveFunction : cheapFunction;
+    const size_t maxLevelSum = expensive ? 8 : 12;
+    sgpp::combigrid::MultiBatchFunction batchFunc([func](sgpp::base::DataMatrix const &points) {
+      sgpp::base::DataVector values(points.getNrows());
+      sgpp::base::DataVector point(points.getNcols());
+
+      for (size_t i = 0; i < points.getNrows(); ++i) {
+        points.getRow(i, point);
+        values[i] = func(point);
+      }
+
+      return values;
+    });
+
+    std::cout << (expensive ? "expensive" : "cheap") << " function, " << numThreads
+              << " threads:\n";
+
+    for (size_t batchSize : {0, 16, 256}) {
+      std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies(
+          numDimensions,
+          std::make_shared<sgpp::combigrid::NestedPointHierarchy>(
+              std::make_shared<sgpp::combigrid::LejaPointDistribution>(),
+              std::make_shared<sgpp::combigrid::IdentityPointOrdering>(
+                  std::make_shared<sgpp::combigrid::LinearGrowthStrategy>(2), false)));
+
+      if (batchSize == 0) {
+        measure("one task per point     ", pointHierarchies,
+                std::make_shared<CombigridTreeStorage>(pointHierarchies,
+                                                       sgpp::combigrid::MultiFunction(func)),
+                maxLevelSum, numThreads);
+      } else {
+        measure("batches of " + std::to_string(batchSize) + " points" +
+                    std::string(batchSize < 100 ? " " : "") + " ",
+                pointHierarchies,
+                std::make_shared<CombigridTreeStorage>(pointHierarchies, true, batchFunc,
+                                                       batchSize),
+                maxLevelSum, numThreads);
+      }
+    }
+  }
+
+  std::cout << "adaptive level addition, expensive function:\n";
+
+  for (size_t threads = 1; threads <= numThreads; threads *= 2) {
+    measureAdaptive(sgpp::combigrid::MultiFunction(expensiveFunction), numDimensions, 2000,
+                    threads);
+  }
+
+  return 0;
+}
@@ -6,6 +6,7 @@
 #ifndef COMBIGRID_SRC_SGPP_COMBIGRID_GENERALFUNCTION_HPP_
 #define COMBIGRID_SRC_SGPP_COMBIGRID_GENERALFUNCTION_HPP_
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/globaldef.hpp>
 
@@ -99,6 +100,11 @@ class GeneralFunction1 {
 };
 
 typedef GeneralFunction<double, base::DataVector const &> MultiFunction;
+/**
+ * Function evaluated at several points at once, the points are the rows of the matrix and the
+ * function values are returned in a vector.
+ */
+typedef GeneralFunction<base::DataVector, base::DataMatrix const &> MultiBatchFunction;
 typedef GeneralFunction<double, double> SingleFunction;
 
 } /* namespace combigrid */
@@ -14,6 +14,9 @@
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -49,7 +52,10 @@ class FullGridCallbackEvaluator : public AbstractFullGridEvaluationStrategy<V> {
 
   /**
    * @return a vector of tasks which can be precomputed in parallel to make the (serialized)
-   * execution of eval() faster
+   * execution of eval() faster. If the storage supports concurrent evaluation (see
+   * AbstractCombigridStorage::supportsConcurrentEvaluation()), each task evaluates a chunk of at
+   * most AbstractCombigridStorage::getMaxBatchSize() points without locking the mutex, otherwise
+   * each task evaluates a single point.
    * @param level the level which one wants to compute
    * @param callback This callback is called (with already locked mutex) from inside one of the
    * returned tasks when all tasks for the given level are completed and the level can be added.
@@ -82,6 +88,52 @@ class FullGridCallbackEvaluator : public AbstractFullGridEvaluationStrategy<V> {
 
     if (computationTasks.empty()) {
       callback();
+    } else if (this->storage->supportsConcurrentEvaluation()) {
+      // The points are computed now (the caller holds the mutex). The tasks evaluate chunks of
+      // points without locking and write to disjoint entries of a buffer that is shared by the
+      // tasks of this level. Only the task completing the level locks the mutex (once) to store
+      // all values and to call the callback, so the workers do not serialize on the storage.
+      size_t numPoints = multiIndices.size();
+      size_t batchSize = std::max(this->storage->getMaxBatchSize(), static_cast<size_t>(1));
+      size_t numBatches = (numPoints + batchSize - 1) / batchSize;
+      auto points =
+          std::make_shared<base::DataMatrix>(this->storage->getPoints(level, multiIndices));
+      auto values = std::make_shared<base::DataVector>(numPoints);
+      auto indices = std::make_shared<std::vector<MultiIndex>>(std::move(multiIndices));
+      auto counter = std::make_shared<std::atomic<size_t>>(numBatches);
+
+      for (size_t b = 0; b < numBatches; ++b) {
+        size_t begin = b * batchSize;
+        size_t end = std::min(begin + batchSize, numPoints);
+
+        tasks.push_back(ThreadPool::Task(
+            [points, values, indices, counter, callback, this, level, begin, end]() {
+              size_t numDimensions = points->getNcols();
+              base::DataMatrix batch(end - begin, numDimensions);
+
+              for (size_t i = begin; i < end; ++i) {
+                for (size_t d = 0; d < numDimensions; ++d) {
+                  batch(i - begin, d) = points->get(i, d);
+                }
+              }
+
+              base::DataVector results = this->storage->evaluate(batch);
+
+              for (size_t i = begin; i < end; ++i) {
+                (*values)[i] = results[i - begin];
+              }
+
+              // the atomic decrement makes the entries written by the other tasks visible
+              if (--(*counter) == 0) {
+                CGLOG_SURROUND(PtrGuard guard(this->mutexPtr));
+                for (size_t i = 0; i < indices->size(); ++i) {
+                  this->storage->set(level, (*indices)[i], (*values)[i]);
+                }
+                callback();
+                CGLOG("leave guard(this->mutexPtr) in FGEval");
+              }
+            }));
+      }
     } else {
       // make it a pointer so that it does not get deleted before all tasks are completed
       auto counter = std::make_shared<size_t>(computationTasks.size());
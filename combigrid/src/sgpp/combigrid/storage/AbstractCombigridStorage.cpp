@@ -5,10 +5,29 @@
 
 #include "AbstractCombigridStorage.hpp"
 
+#include <sgpp/base/exception/application_exception.hpp>
+
+#include <vector>
+
 namespace sgpp {
 namespace combigrid {
 
 AbstractCombigridStorage::~AbstractCombigridStorage() {}
 
+bool AbstractCombigridStorage::supportsConcurrentEvaluation() const { return false; }
+
+size_t AbstractCombigridStorage::getMaxBatchSize() const { return 1; }
+
+base::DataMatrix AbstractCombigridStorage::getPoints(MultiIndex const &level,
+                                                     std::vector<MultiIndex> const &indices) {
+  throw sgpp::base::application_exception(
+      "AbstractCombigridStorage::getPoints: the storage does not support concurrent evaluation");
+}
+
+base::DataVector AbstractCombigridStorage::evaluate(base::DataMatrix const &points) {
+  throw sgpp::base::application_exception(
+      "AbstractCombigridStorage::evaluate: the storage does not support concurrent evaluation");
+}
+
 } /* namespace combigrid */
 } /* namespace sgpp*/
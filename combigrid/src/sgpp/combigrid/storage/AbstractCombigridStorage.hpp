@@ -6,6 +6,8 @@
 #ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_ABSTRACTCOMBIGRIDSTORAGE_HPP_
 #define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_ABSTRACTCOMBIGRIDSTORAGE_HPP_
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/combigrid/common/MultiIndexIterator.hpp>
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
@@ -65,8 +67,46 @@ class AbstractCombigridStorage {
    */
   virtual void set(MultiIndex const &level, MultiIndex const &index, double value) = 0;
 
+  /**
+   * @return Returns the value at the given level-index pair, computing and storing it if it has
+   * not been stored yet. Stored values are not synchronized: in parallel level addition (see
+   * LevelManager::addLevelsAdaptiveParallel) they are read and written only while the mutex
+   * (see setMutex()) is locked, since the evaluation of a level runs in the callback of its tasks.
+   */
   virtual double get(MultiIndex const &level, MultiIndex const &index) = 0;
 
+  /**
+   * @return Returns true if getPoints() and evaluate() are available. Parallel evaluators (see
+   * FullGridCallbackEvaluator::getLevelTasks) then compute the grid points of a level while
+   * holding the mutex, evaluate the function without holding it and store the values of the
+   * level at once, so that worker threads do not serialize on accesses to the storage.
+   */
+  virtual bool supportsConcurrentEvaluation() const;
+
+  /**
+   * @return Returns the maximal number of points that should be passed to evaluate() at once.
+   */
+  virtual size_t getMaxBatchSize() const;
+
+  /**
+   * Computes the coordinates of grid points. Only available if supportsConcurrentEvaluation()
+   * returns true. The mutex (see setMutex()) is locked while the points are computed.
+   * @param level Level of the grid points
+   * @param indices Indices of the grid points
+   * @return Returns a matrix containing the coordinates of the i-th grid point in the i-th row
+   */
+  virtual base::DataMatrix getPoints(MultiIndex const &level,
+                                     std::vector<MultiIndex> const &indices);
+
+  /**
+   * Evaluates the function of the storage without storing the values (use set() for this) and
+   * without accessing the storage, so it may be called concurrently without locking the mutex.
+   * Only available if supportsConcurrentEvaluation() returns true.
+   * @param points Matrix containing one point per row, e.g., computed by getPoints()
+   * @return Returns the function values at the points
+   */
+  virtual base::DataVector evaluate(base::DataMatrix const &points);
+
   /**
    * Sets a mutex that is locked for critical operations. If the mutex is nullptr, nothing is
    * locked.
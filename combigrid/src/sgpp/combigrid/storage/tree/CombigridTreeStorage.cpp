@@ -9,6 +9,7 @@
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <mutex>
 #include <string>
@@ -23,6 +24,8 @@ class CombigridTreeStorageImpl {
       std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
       MultiFunction p_func, bool exploitNesting)
       : func(p_func),
+        batchFunc(),
+        maxBatchSize(1),
         pointHierarchies(p_pointHierarchies),
         mutexPtr(nullptr),
         exploitNesting(exploitNesting) {
@@ -32,6 +35,28 @@ class CombigridTreeStorageImpl {
     setFunctions();
   }
 
+  CombigridTreeStorageImpl(
+      std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
+      MultiBatchFunction p_batchFunc, size_t maxBatchSize, bool exploitNesting)
+      : func(),
+        batchFunc(p_batchFunc.getStdFunction()),
+        maxBatchSize(std::max(maxBatchSize, static_cast<size_t>(1))),
+        pointHierarchies(p_pointHierarchies),
+        mutexPtr(nullptr),
+        exploitNesting(exploitNesting) {
+    // single points are evaluated as batches of size one
+    auto batch = batchFunc;
+    func = [batch](base::DataVector const &coordinates) -> double {
+      base::DataMatrix points(1, coordinates.getSize());
+      points.setRow(0, coordinates);
+      return batch(points)[0];
+    };
+    storage = std::make_shared<TreeStorage<std::shared_ptr<TreeStorage<double>>>>(
+        p_pointHierarchies.size(),
+        [](MultiIndex const &level) { return std::shared_ptr<TreeStorage<double>>(nullptr); });
+    setFunctions();
+  }
+
   /**
    * Sets the computation functions for the storage and the storages it contains
    */
@@ -71,6 +96,8 @@ class CombigridTreeStorageImpl {
   }
 
   std::function<double(base::DataVector const &)> func;
+  std::function<base::DataVector(base::DataMatrix const &)> batchFunc;
+  size_t maxBatchSize;
   std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies;
   std::shared_ptr<TreeStorage<std::shared_ptr<TreeStorage<double>>>> storage;
   std::shared_ptr<std::recursive_mutex> mutexPtr;
@@ -89,6 +116,13 @@ CombigridTreeStorage::CombigridTreeStorage(
   impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, exploitNesting);
 }
 
+CombigridTreeStorage::CombigridTreeStorage(
+    std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
+    bool exploitNesting, MultiBatchFunction p_batchFunc, size_t maxBatchSize) {
+  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_batchFunc, maxBatchSize,
+                                                    exploitNesting);
+}
+
 CombigridTreeStorage::~CombigridTreeStorage() {}
 
 std::shared_ptr<AbstractMultiStorageIterator<double>> CombigridTreeStorage::getGuidedIterator(
@@ -198,6 +232,52 @@ double CombigridTreeStorage::get(MultiIndex const &level, MultiIndex const &inde
   return impl->storage->get(reducedLevel)->get(index);
 }
 
+bool CombigridTreeStorage::supportsConcurrentEvaluation() const { return true; }
+
+size_t CombigridTreeStorage::getMaxBatchSize() const { return impl->maxBatchSize; }
+
+base::DataMatrix CombigridTreeStorage::getPoints(MultiIndex const &level,
+                                                 std::vector<MultiIndex> const &indices) {
+  MultiIndex reducedLevel = level;
+  size_t numDimensions = impl->pointHierarchies.size();
+  for (size_t d = 0; d < numDimensions; ++d) {
+    if (impl->pointHierarchies[d]->isNested() && impl->exploitNesting) {
+      reducedLevel[d] = 0;
+    }
+  }
+
+  base::DataMatrix points(indices.size(), numDimensions);
+
+  // the point hierarchies compute their points lazily
+  CGLOG_SURROUND(PtrGuard guard(impl->mutexPtr));
+
+  for (size_t i = 0; i < indices.size(); ++i) {
+    for (size_t d = 0; d < numDimensions; ++d) {
+      points(i, d) = impl->pointHierarchies[d]->getPoint(reducedLevel[d], indices[i][d]);
+    }
+  }
+
+  CGLOG("leave guard(impl->mutexPtr) in getPoints");
+
+  return points;
+}
+
+base::DataVector CombigridTreeStorage::evaluate(base::DataMatrix const &points) {
+  if (impl->batchFunc) {
+    return impl->batchFunc(points);
+  }
+
+  base::DataVector values(points.getNrows());
+  base::DataVector point(points.getNcols());
+
+  for (size_t i = 0; i < points.getNrows(); ++i) {
+    points.getRow(i, point);
+    values[i] = impl->func(point);
+  }
+
+  return values;
+}
+
 void CombigridTreeStorage::setMutex(std::shared_ptr<std::recursive_mutex> mutexPtr) {
   impl->mutexPtr = mutexPtr;
 }
@@ -51,6 +51,20 @@ class CombigridTreeStorage : public AbstractCombigridStorage {
       std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
       bool exploitNesting = true,
       MultiFunction p_func = MultiFunction(constantFunction<base::DataVector const &, double>()));
+
+  /**
+   * @param p_pointHierarchies Point hierarchies generating the points at which the function should
+   * be evaluated.
+   * @param exploitNesting If this is set to true, identical grid points on different levels can
+   * have different values. This is e.g. relevant for PDE solving.
+   * @param p_batchFunc Function generating the values that are stored in the storage, evaluated
+   * at several points at once. Parallel evaluators (see FullGridCallbackEvaluator::getLevelTasks)
+   * pass the points of a level in chunks to this function instead of creating a task per point.
+   * @param maxBatchSize Maximal number of points per call of p_batchFunc.
+   */
+  CombigridTreeStorage(
+      std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
+      bool exploitNesting, MultiBatchFunction p_batchFunc, size_t maxBatchSize = 256);
   virtual ~CombigridTreeStorage();
 
   virtual std::shared_ptr<AbstractMultiStorageIterator<double>> getGuidedIterator(
@@ -70,6 +84,11 @@ class CombigridTreeStorage : public AbstractCombigridStorage {
 
   virtual void set(MultiIndex const &level, MultiIndex const &index, double value);
   double get(MultiIndex const &level, MultiIndex const &index) override;
+  bool supportsConcurrentEvaluation() const override;
+  size_t getMaxBatchSize() const override;
+  base::DataMatrix getPoints(MultiIndex const &level,
+                             std::vector<MultiIndex> const &indices) override;
+  base::DataVector evaluate(base::DataMatrix const &points) override;
   virtual void setMutex(std::shared_ptr<std::recursive_mutex> mutexPtr);
 };
 }  // namespace combigrid
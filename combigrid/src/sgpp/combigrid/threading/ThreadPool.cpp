@@ -6,103 +6,174 @@
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 
-#include <chrono>
+#include <algorithm>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+// pool and queue index of the calling thread, if it is a thread of a pool
+thread_local ThreadPool* currentPool = nullptr;
+thread_local size_t currentWorker = 0;
+
+}  // namespace
+
 ThreadPool::IdleCallback ThreadPool::terminateWhenIdle((ThreadPool::doTerminateWhenIdle));
 
 ThreadPool::ThreadPool(size_t numThreads)
     : numThreads(numThreads),
       threads(),
-      tasks(),
-      poolMutex(),
+      queues(),
+      numQueuedTasks(0),
+      nextQueue(0),
       terminateFlag(false),
       useIdleCallback(false),
-      idleCallback() {}
+      idleCallback() {
+  for (size_t i = 0; i < std::max(numThreads, static_cast<size_t>(1)); ++i) {
+    queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+  }
+}
 
 ThreadPool::ThreadPool(size_t numThreads, IdleCallback idleCallback)
     : numThreads(numThreads),
       threads(),
-      tasks(),
-      poolMutex(),
+      queues(),
+      numQueuedTasks(0),
+      nextQueue(0),
       terminateFlag(false),
       useIdleCallback(true),
-      idleCallback(idleCallback) {}
+      idleCallback(idleCallback) {
+  for (size_t i = 0; i < std::max(numThreads, static_cast<size_t>(1)); ++i) {
+    queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+  }
+}
 
 ThreadPool::~ThreadPool() {
   triggerTermination();
   join();
 }
 
+size_t ThreadPool::getTargetQueue() {
+  if (currentPool == this) {
+    return currentWorker;
+  }
+
+  return nextQueue++ % queues.size();
+}
+
 void ThreadPool::addTask(const Task& task) {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  tasks.push_back(task);
+  WorkerQueue& queue = *queues[getTargetQueue()];
+  numQueuedTasks += 1;
+  std::lock_guard<std::mutex> guard(queue.mutex);
+  queue.tasks.push_back(task);
 }
 
 void ThreadPool::addTasks(const std::vector<Task>& newTasks) {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  tasks.insert(tasks.end(), newTasks.begin(), newTasks.end());
+  if (newTasks.empty()) {
+    return;
+  }
+
+  numQueuedTasks += newTasks.size();
+
+  if (currentPool == this) {
+    WorkerQueue& queue = *queues[currentWorker];
+    std::lock_guard<std::mutex> guard(queue.mutex);
+    queue.tasks.insert(queue.tasks.end(), newTasks.begin(), newTasks.end());
+    return;
+  }
+
+  // distribute contiguous blocks of tasks among the queues
+  const size_t numQueues = std::min(queues.size(), newTasks.size());
+  const size_t firstQueue = nextQueue.fetch_add(numQueues);
+
+  for (size_t k = 0; k < numQueues; ++k) {
+    WorkerQueue& queue = *queues[(firstQueue + k) % queues.size()];
+    std::lock_guard<std::mutex> guard(queue.mutex);
+    queue.tasks.insert(queue.tasks.end(), newTasks.begin() + (k * newTasks.size()) / numQueues,
+                       newTasks.begin() + ((k + 1) * newTasks.size()) / numQueues);
+  }
 }
 
-void ThreadPool::start() {
-  for (size_t i = 0; i < numThreads; ++i) {
-    threads.push_back(std::make_shared<std::thread>([this]() {
-      while (true) {
-        Task nextTask;
-
-        // wait for terminate or next task
-        while (true) {
-          {
-            CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(this->poolMutex));
-            if (this->terminateFlag) {
-              return;
-            }
-            if (!this->tasks.empty()) {
-              nextTask = tasks.front();
-              tasks.pop_front();
-              break;
-            } else if (!useIdleCallback) {
-              return;
-            }
-            CGLOG("leave outer guard(this->poolMutex)");
-          }
-
-          // no tasks, so acquire tasks
-
-          if (useIdleCallback) {
-            CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> idleLock(idleMutex));
-
-            {
-              CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(this->poolMutex));
-              if (this->terminateFlag || !this->tasks.empty()) {
-                CGLOG("leave inner guard(this->poolMutex)");
-                continue;
-              }
-              CGLOG("leave inner guard(this->poolMutex)");
-            }
-
-            idleCallback(*this);
-            CGLOG("leave idleLock(idleMutex)");
-          } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
-          }
-        }
-
-        // execute next task
-        nextTask();
+bool ThreadPool::takeTask(size_t worker, Task& task) {
+  if (numQueuedTasks == 0) {
+    return false;
+  }
+
+  {
+    // most recently added task of the own queue
+    WorkerQueue& queue = *queues[worker];
+    std::lock_guard<std::mutex> guard(queue.mutex);
+
+    if (!queue.tasks.empty()) {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+      numQueuedTasks -= 1;
+      return true;
+    }
+  }
+
+  // steal the oldest task of another queue
+  for (size_t k = 1; k < queues.size(); ++k) {
+    WorkerQueue& queue = *queues[(worker + k) % queues.size()];
+    std::lock_guard<std::mutex> guard(queue.mutex);
+
+    if (!queue.tasks.empty()) {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+      numQueuedTasks -= 1;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ThreadPool::run(size_t worker) {
+  currentPool = this;
+  currentWorker = worker;
+
+  while (true) {
+    Task nextTask;
+
+    // wait for terminate or next task
+    while (true) {
+      if (terminateFlag) {
+        return;
+      }
+
+      if (takeTask(worker, nextTask)) {
+        break;
+      } else if (!useIdleCallback) {
+        return;
       }
-    }));
+
+      // no tasks, so acquire tasks
+      CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> idleLock(idleMutex));
+
+      if (terminateFlag || (numQueuedTasks > 0)) {
+        CGLOG("leave idleLock(idleMutex)");
+        continue;
+      }
+
+      idleCallback(*this);
+      CGLOG("leave idleLock(idleMutex)");
+    }
+
+    // execute next task
+    nextTask();
   }
 }
 
-void ThreadPool::triggerTermination() {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  terminateFlag = true;
+void ThreadPool::start() {
+  for (size_t i = 0; i < numThreads; ++i) {
+    threads.push_back(std::make_shared<std::thread>([this, i]() { this->run(i); }));
+  }
 }
 
+void ThreadPool::triggerTermination() { terminateFlag = true; }
+
 void ThreadPool::join() {
   for (auto thread_ptr : threads) {
     thread_ptr->join();
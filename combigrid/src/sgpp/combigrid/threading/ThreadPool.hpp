@@ -9,6 +9,7 @@
 #include <sgpp/combigrid/GeneralFunction.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <atomic>
 #include <deque>
 #include <functional>
 #include <memory>
@@ -22,6 +23,11 @@ namespace combigrid {
 /**
  * This implements a thread-pool with a pre-specified number of threads that process a list of
  * tasks.
+ * Every thread has its own task queue, from which it takes the most recently added task. Tasks
+ * added by a task or an idle callback running on a thread are added to the queue of that thread,
+ * other tasks are distributed among the queues. Threads whose queue is empty steal the oldest
+ * task of another queue. Therefore, there is no global lock when adding or taking tasks, only
+ * the queue involved is locked.
  */
 class ThreadPool {
  public:
@@ -31,15 +37,47 @@ class ThreadPool {
   typedef GeneralFunction<void, ThreadPool &> IdleCallback;
 
  private:
+  /**
+   * Task queue of a single thread.
+   */
+  struct WorkerQueue {
+    std::deque<Task> tasks;
+    std::mutex mutex;
+  };
+
   size_t numThreads;
   std::vector<std::shared_ptr<std::thread>> threads;
-  std::deque<Task> tasks;
-  std::recursive_mutex poolMutex;
+  std::vector<std::unique_ptr<WorkerQueue>> queues;
+  // upper bound for the number of tasks in all queues (incremented before adding a task,
+  // decremented after taking a task)
+  std::atomic<size_t> numQueuedTasks;
+  // queue that receives the next tasks added from outside the pool (round robin)
+  std::atomic<size_t> nextQueue;
   std::recursive_mutex idleMutex;
-  bool terminateFlag;
+  std::atomic<bool> terminateFlag;
   bool useIdleCallback;
   IdleCallback idleCallback;
 
+  /**
+   * @return the index of the queue of the calling thread if it belongs to this pool, otherwise
+   * the index of the queue that receives the next tasks added from outside
+   */
+  size_t getTargetQueue();
+
+  /**
+   * Takes a task from the queue of the given thread or steals one from another queue.
+   * @param worker index of the thread
+   * @param task the task that was taken (if any)
+   * @return whether a task was taken
+   */
+  bool takeTask(size_t worker, Task &task);
+
+  /**
+   * Main loop of a thread.
+   * @param worker index of the thread
+   */
+  void run(size_t worker);
+
  public:
   /**
    * Creates a ThreadPool that processes available tasks. When no more tasks are available, the
@@ -36,6 +36,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <memory>
@@ -142,6 +143,63 @@ BOOST_AUTO_TEST_CASE(testLevelManagerParallel) {
   //           << "\n";
 }
 
+BOOST_AUTO_TEST_CASE(testLevelManagerParallelBatched) {
+  // precomputing levels with a batch function has to give the same result as evaluating the
+  // function point by point
+  size_t numDimensions = 3;
+  size_t maxLevelSum = 4;
+  std::vector<FloatScalarVector> parameters(numDimensions, FloatScalarVector(0.378934));
+
+  std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies(
+      numDimensions, std::make_shared<NestedPointHierarchy>(
+                         std::make_shared<LejaPointDistribution>(),
+                         std::make_shared<IdentityPointOrdering>(
+                             std::make_shared<LinearGrowthStrategy>(2), false)));
+  std::vector<std::shared_ptr<AbstractLinearEvaluator<FloatScalarVector>>> evaluators(
+      numDimensions, std::make_shared<PolynomialInterpolationEvaluator>());
+
+  std::atomic<size_t> numBatches(0);
+  std::atomic<size_t> numBatchPoints(0);
+  sgpp::combigrid::MultiBatchFunction batchFunc(
+      [&numBatches, &numBatchPoints](sgpp::base::DataMatrix const &points) {
+        numBatches += 1;
+        numBatchPoints += points.getNrows();
+        DataVector values(points.getNrows());
+        DataVector point(points.getNcols());
+
+        for (size_t i = 0; i < points.getNrows(); ++i) {
+          points.getRow(i, point);
+          values[i] = testFunction2(point);
+        }
+
+        return values;
+      });
+
+  std::vector<std::shared_ptr<CombigridTreeStorage>> storages{
+      std::make_shared<CombigridTreeStorage>(pointHierarchies, MultiFunction(testFunction2)),
+      std::make_shared<CombigridTreeStorage>(pointHierarchies, true, batchFunc, 8)};
+  std::vector<double> results;
+
+  for (auto &storage : storages) {
+    auto fullGridEval =
+        std::make_shared<sgpp::combigrid::FullGridCallbackEvaluator<FloatScalarVector>>(
+            storage, evaluators, pointHierarchies);
+    auto combiGridEval =
+        std::make_shared<CombigridEvaluator<FloatScalarVector>>(numDimensions, fullGridEval);
+    auto levelManager = std::make_shared<AveragingLevelManager>(combiGridEval);
+
+    fullGridEval->setParameters(parameters);
+    levelManager->addRegularLevelsParallel(maxLevelSum, 4);
+    results.push_back(combiGridEval->getValue().getValue());
+  }
+
+  BOOST_CHECK_CLOSE(results[0], results[1], 1e-10);
+  BOOST_CHECK_EQUAL(storages[0]->getNumEntries(), storages[1]->getNumEntries());
+  // every point is evaluated once, in batches of at most 8 points
+  BOOST_CHECK_EQUAL(numBatchPoints.load(), storages[1]->getNumEntries());
+  BOOST_CHECK_LT(numBatches.load(), numBatchPoints.load());
+}
+
 BOOST_AUTO_TEST_CASE(testLevelManagerAdaptive) {
   size_t numDims = 6;
   sgpp::combigrid::Genz model;
@@ -161,6 +219,30 @@ BOOST_AUTO_TEST_CASE(testLevelManagerAdaptive) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testLevelManagerAdaptiveParallel) {
+  // the values computed concurrently by the worker threads have to give the same result as a
+  // sequential computation on the same levels
+  size_t numDims = 4;
+  sgpp::combigrid::MultiFunction func(testFunction2);
+  DataVector parameters(numDims, 0.378934);
+
+  auto op = sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+      numDims, func);
+  op->setParameters(parameters);
+  op->getLevelManager()->addLevelsAdaptiveParallel(1000, 4);
+  BOOST_CHECK_EQUAL(op->getUpperPointBound(), op->numGridPoints());
+
+  auto sequentialOp =
+      sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(numDims,
+                                                                                         func);
+  sequentialOp->setParameters(parameters);
+  sequentialOp->getLevelManager()->addLevelsFromStructure(
+      op->getLevelManager()->getLevelStructure());
+
+  BOOST_CHECK_EQUAL(op->numGridPoints(), sequentialOp->numGridPoints());
+  BOOST_CHECK_CLOSE(op->getResult(), sequentialOp->getResult(), 1e-10);
+}
+
 #ifdef USE_DAKOTA
 
 BOOST_AUTO_TEST_CASE(testLevelManagerStats) {
@@ -14,6 +14,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <memory>
@@ -83,3 +84,25 @@ BOOST_AUTO_TEST_CASE(testThreadingWithCallback) {
 
   checkCorrectness();
 }
+
+BOOST_AUTO_TEST_CASE(testThreadingNestedTasks) {
+  // tasks that add tasks, which are processed by the adding thread or stolen by others
+  auto tp = std::make_shared<ThreadPool>(4);
+  std::atomic<size_t> numExecuted(0);
+  const size_t numOuterTasks = 8;
+  const size_t numInnerTasks = 100;
+
+  for (size_t i = 0; i < numOuterTasks; ++i) {
+    tp->addTask(ThreadPool::Task([&tp, &numExecuted, numInnerTasks]() {
+      std::vector<ThreadPool::Task> innerTasks(
+          numInnerTasks, ThreadPool::Task([&numExecuted]() { ++numExecuted; }));
+      tp->addTasks(innerTasks);
+      ++numExecuted;
+    }));
+  }
+
+  tp->start();
+  tp->join();
+
+  BOOST_CHECK_EQUAL(numExecuted.load(), numOuterTasks * (numInnerTasks + 1));
+}
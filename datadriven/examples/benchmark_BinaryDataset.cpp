@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ * Compares the time needed to open a dataset and to read the first batch of samples for
+ * ARFF files and binary dataset files.
+ */
+int main() {
+  const size_t numberInstances = 200000;
+  const size_t dimension = 10;
+  const size_t batchSize = 1000;
+  const std::string arffPath = "benchmark_BinaryDataset.arff";
+  const std::string binaryPath = "benchmark_BinaryDataset.bin";
+
+  // create random dataset
+  sgpp::datadriven::Dataset dataset(numberInstances, dimension);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    for (size_t t = 0; t < dimension; t++) {
+      dataset.getData().set(i, t, distribution(generator));
+    }
+
+    dataset.getTargets()[i] = (distribution(generator) < 0.5) ? -1.0 : 1.0;
+  }
+
+  {
+    std::ofstream arffFile(arffPath);
+    arffFile << "@RELATION \"benchmark\"\n\n";
+
+    for (size_t t = 0; t < dimension; t++) {
+      arffFile << "@ATTRIBUTE x" << t << " NUMERIC\n";
+    }
+
+    arffFile << "@ATTRIBUTE class NUMERIC\n\n@DATA\n";
+    arffFile.precision(17);
+
+    for (size_t i = 0; i < numberInstances; i++) {
+      for (size_t t = 0; t < dimension; t++) {
+        arffFile << dataset.getData().get(i, t) << ",";
+      }
+
+      arffFile << dataset.getTargets()[i] << "\n";
+    }
+  }
+
+  sgpp::datadriven::BinaryDatasetTools::writeBinary(dataset, binaryPath);
+
+  std::cout << numberInstances << " samples with dimension " << dimension << ":\n";
+
+  {
+    auto start = std::chrono::steady_clock::now();
+    sgpp::datadriven::ArffFileSampleProvider sampleProvider;
+    sampleProvider.readFile(arffPath, true);
+    std::unique_ptr<sgpp::datadriven::Dataset> batch(sampleProvider.getNextSamples(batchSize));
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    std::cout << "  ARFF:   " << time.count() << "s\n";
+  }
+
+  {
+    auto start = std::chrono::steady_clock::now();
+    sgpp::datadriven::BinaryFileSampleProvider sampleProvider;
+    sampleProvider.readFile(binaryPath, true);
+    std::unique_ptr<sgpp::datadriven::Dataset> batch(sampleProvider.getNextSamples(batchSize));
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    std::cout << "  binary: " << time.count() << "s\n";
+  }
+
+  std::remove(arffPath.c_str());
+  std::remove(binaryPath.c_str());
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+
+namespace {
+/// number of calls of operator new since program start
+std::atomic<size_t> numberOfAllocations(0);
+}  // namespace
+
+// count all heap allocations (replaces the aligned operator new of SG++,
+// so keep the same 64 byte alignment)
+void* operator new(size_t size) {
+  numberOfAllocations++;
+  void* p;
+
+  if (posix_memalign(&p, 64, (size == 0) ? 1 : size) != 0) {
+    throw std::bad_alloc();
+  }
+
+  return p;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+
+void operator delete(void* p) noexcept { free(p); }
+
+void operator delete[](void* p) noexcept { free(p); }
+
+/**
+ * Counts the heap allocations of CG solves of a least squares regression system
+ * (DMSystemMatrix with identity regularization) for different numbers of iterations.
+ * As the system matrix, the multi-evaluation and the solver keep their temporary
+ * vectors in workspaces, the number of allocations per iteration should be
+ * (almost) independent of the number of iterations.
+ */
+int main() {
+  const size_t dim = 5;
+  const size_t level = 5;
+  const size_t numberDataPoints = 5000;
+  const double lambda = 1e-4;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+  sgpp::base::DataVector classes(numberDataPoints);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    double value = 1.0;
+
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = distribution(generator);
+      value *= std::sin(M_PI * dataset(i, t));
+    }
+
+    classes[i] = value;
+  }
+
+  std::shared_ptr<sgpp::base::OperationMatrix> C(
+      sgpp::op_factory::createOperationIdentity(*grid));
+  sgpp::datadriven::DMSystemMatrix systemMatrix(*grid, dataset, C, lambda);
+  sgpp::base::DataVector b(grid->getSize());
+  systemMatrix.generateb(classes, b);
+
+  std::cout << "CG allocation benchmark (least squares regression, linear grid):\n";
+  std::cout << "dim = " << dim << ", level = " << level << ", grid points = " << grid->getSize()
+            << ", data points = " << numberDataPoints << "\n\n";
+
+  const size_t iterations[] = {10, 20, 40};
+
+  for (size_t maxIterations : iterations) {
+    sgpp::solver::ConjugateGradients cg(maxIterations, 1e-20);
+    sgpp::base::DataVector alpha(grid->getSize(), 0.0);
+
+    const size_t allocationsBefore = numberOfAllocations;
+    auto begin = std::chrono::high_resolution_clock::now();
+    cg.solve(systemMatrix, alpha, b, false, false, -1.0);
+    auto end = std::chrono::high_resolution_clock::now();
+    const size_t allocations = numberOfAllocations - allocationsBefore;
+
+    std::cout << "iterations = " << cg.getNumberIterations() << ": " << allocations
+              << " allocations (" << static_cast<double>(allocations) /
+                                         static_cast<double>(cg.getNumberIterations())
+              << " per iteration), "
+              << std::chrono::duration<double>(end - begin).count() << "s" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,193 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatParallelDecomposition.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::DBMatParallelDecomposition;
+
+/**
+ * Measures the runtime of a function in seconds.
+ */
+template <class F>
+double measure(F f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Maximum absolute difference of the entries of two matrices of the same size.
+ */
+double maxDifference(const DataMatrix& a, const DataMatrix& b) {
+  double result = 0.0;
+
+  for (size_t i = 0; i < a.getSize(); i++) {
+    result = std::max(result, std::abs(a[i] - b[i]));
+  }
+
+  return result;
+}
+
+/**
+ * Compares the Cholesky modifications of the on/off learning when a refinement/coarsening step
+ * is applied as one batch (blocked rank-k update / appending all rows at once) with applying
+ * them one grid point at a time (one pass over the factor per point, as in
+ * DBMatOfflineChol::choleskyAddPoint and DBMatDMSChol::choleskyUpdate).
+ */
+int main() {
+  const size_t dim = 5;
+  const size_t level = 5;
+  const size_t refinementsPerCycle = 60;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 1e-4;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.type_ = sgpp::datadriven::DensityEstimationType::Decomposition;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+  densityEstimationConfig.parallelDecomposition_ = true;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+
+  sgpp::datadriven::DBMatOfflineChol offline;
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  std::cout << "refinement (d = " << dim << ", level " << level << ")" << std::endl;
+
+  for (size_t cycle = 0; cycle < 3; cycle++) {
+    const size_t oldSize = grid->getSize();
+    DataVector alpha(oldSize);
+
+    for (size_t i = 0; i < oldSize; i++) {
+      alpha[i] = distribution(generator);
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, refinementsPerCycle);
+    grid->getGenerator().refine(functor);
+    const size_t newSize = grid->getSize();
+    const size_t newPoints = newSize - oldSize;
+
+    // rows of the extended system matrix (not timed)
+    sgpp::datadriven::DBMatOfflineChol reference;
+    reference.buildMatrix(grid.get(), regularizationConfig);
+    const DataMatrix& system = reference.getLhsMatrix_ONLY_FOR_TESTING();
+    DataMatrix newRows(newPoints, newSize);
+
+    for (size_t m = 0; m < newPoints; m++) {
+      for (size_t j = 0; j < newSize; j++) {
+        newRows.set(m, j, system.get(oldSize + m, j));
+      }
+    }
+
+    DataMatrix factor(offline.getDecomposedMatrix());
+    factor.resizeQuadratic(newSize);
+
+    // one row at a time
+    DataMatrix single(factor);
+    const double timeSingle = measure([&]() {
+      for (size_t m = 0; m < newPoints; m++) {
+        DataMatrix row(1, oldSize + m + 1);
+        std::copy(newRows.getPointer() + m * newSize,
+                  newRows.getPointer() + m * newSize + oldSize + m + 1, row.getPointer());
+        DBMatParallelDecomposition::choleskyAppendRows(single, oldSize + m, row);
+      }
+    });
+
+    // batch
+    const double timeBatch = measure(
+        [&]() { DBMatParallelDecomposition::choleskyAppendRows(factor, oldSize, newRows); });
+
+    // whole modification step of the offline object (including the assembly of the new rows)
+    const double timeModification = measure([&]() {
+      offline.choleskyModification(*grid, densityEstimationConfig, newPoints,
+                                   std::list<size_t>(), regularizationConfig.lambda_);
+    });
+
+    std::cout << "  cycle " << cycle << ": N = " << oldSize << " -> " << newSize << " (+"
+              << newPoints << ")\n"
+              << "    one point at a time:    " << timeSingle << "s\n"
+              << "    batch:                  " << timeBatch << "s (speedup "
+              << timeSingle / timeBatch << ")\n"
+              << "    choleskyModification:   " << timeModification << "s\n"
+              << "    max. difference:        "
+              << std::max(maxDifference(single, factor),
+                          maxDifference(factor, offline.getDecomposedMatrix()))
+              << std::endl;
+  }
+
+  // coarsening: rank-k update with k removed grid points
+  std::cout << "coarsening (rank-k updates)" << std::endl;
+  const size_t n = offline.getDecomposedMatrix().getNrows();
+
+  for (size_t k : {16, 64, 256}) {
+    DataMatrix updates(n, k);
+
+    for (size_t i = 0; i < updates.getSize(); i++) {
+      updates[i] = distribution(generator);
+    }
+
+    DataMatrix single(offline.getDecomposedMatrix());
+    DataMatrix update(n, 1);
+    const double timeSingle = measure([&]() {
+      for (size_t m = 0; m < k; m++) {
+        for (size_t i = 0; i < n; i++) {
+          update[i] = updates.get(i, m);
+        }
+
+        DBMatParallelDecomposition::choleskyUpdate(single, update);
+      }
+    });
+
+    DataMatrix batch(offline.getDecomposedMatrix());
+    const double timeBatch =
+        measure([&]() { DBMatParallelDecomposition::choleskyUpdate(batch, updates); });
+
+    std::cout << "  N = " << n << ", k = " << k << "\n"
+              << "    one update at a time:   " << timeSingle << "s\n"
+              << "    batch:                  " << timeBatch << "s (speedup "
+              << timeSingle / timeBatch << ")\n";
+
+#ifdef USE_GSL
+    DataMatrix gsl(offline.getDecomposedMatrix());
+    DataVector column(n);
+    sgpp::datadriven::DBMatDMSChol cholsolver;
+    const double timeGsl = measure([&]() {
+      for (size_t m = 0; m < k; m++) {
+        updates.getColumn(m, column);
+        cholsolver.choleskyUpdate(gsl, column, false);
+      }
+    });
+    std::cout << "    GSL rank one updates:   " << timeGsl << "s\n";
+#endif /* USE_GSL */
+
+    std::cout << "    max. difference:        " << maxDifference(single, batch) << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatParallelDecomposition.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+
+#ifdef USE_GSL
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_vector.h>
+#endif /* USE_GSL */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::DBMatParallelDecomposition;
+
+/**
+ * Measures the runtime of a function in seconds.
+ */
+template <class F>
+double measure(F f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Compares the blocked, parallel decompositions used by the offline objects (Chol, LU, OrthoAdapt)
+ * with their unblocked variants (block size = matrix size) and, if available, with GSL. The
+ * matrices are the system matrices of regular linear grids with identity regularization.
+ */
+int main() {
+  const size_t dim = 4;
+
+  for (size_t level : {5, 6}) {
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(level);
+
+    sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+    regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+    regularizationConfig.lambda_ = 1e-4;
+
+    sgpp::datadriven::DBMatOfflineChol offline;
+    offline.buildMatrix(grid.get(), regularizationConfig);
+    const DataMatrix matrix = offline.getLhsMatrix_ONLY_FOR_TESTING();
+    const size_t n = matrix.getNrows();
+
+    std::cout << "d = " << dim << ", level " << level << ", N = " << n << std::endl;
+
+    // Cholesky
+    DataMatrix work(matrix);
+    std::cout << "  Cholesky (blocked):    "
+              << measure([&]() { DBMatParallelDecomposition::cholesky(work); }) << "s\n";
+    work = matrix;
+    std::cout << "  Cholesky (unblocked):  "
+              << measure([&]() { DBMatParallelDecomposition::cholesky(work, n); }) << "s\n";
+#ifdef USE_GSL
+    work = matrix;
+    std::cout << "  Cholesky (GSL):        " << measure([&]() {
+      gsl_matrix_view m = gsl_matrix_view_array(work.getPointer(), n, n);
+      gsl_linalg_cholesky_decomp(&m.matrix);
+    }) << "s\n";
+#endif /* USE_GSL */
+
+    // LU
+    std::vector<size_t> permutation;
+    work = matrix;
+    std::cout << "  LU (blocked):          "
+              << measure([&]() { DBMatParallelDecomposition::lu(work, permutation); }) << "s\n";
+    work = matrix;
+    std::cout << "  LU (unblocked):        "
+              << measure([&]() { DBMatParallelDecomposition::lu(work, permutation, n); }) << "s\n";
+#ifdef USE_GSL
+    work = matrix;
+    std::cout << "  LU (GSL):              " << measure([&]() {
+      gsl_matrix_view m = gsl_matrix_view_array(work.getPointer(), n, n);
+      gsl_permutation* p = gsl_permutation_alloc(n);
+      int signum;
+      gsl_linalg_LU_decomp(&m.matrix, p, &signum);
+      gsl_permutation_free(p);
+    }) << "s\n";
+#endif /* USE_GSL */
+
+    // tridiagonalization
+    DataMatrix q;
+    DataVector diag;
+    DataVector subdiag;
+    work = matrix;
+    std::cout << "  tridiagonalization:    " << measure([&]() {
+      DBMatParallelDecomposition::tridiagonalize(work, q, diag, subdiag);
+    }) << "s\n";
+#ifdef USE_GSL
+    work = matrix;
+    q.resizeZero(n, n);
+    diag.resizeZero(n);
+    subdiag.resizeZero(n - 1);
+    std::cout << "  tridiagonalization (GSL): " << measure([&]() {
+      gsl_vector* tau = gsl_vector_alloc(n - 1);
+      gsl_matrix_view m = gsl_matrix_view_array(work.getPointer(), n, n);
+      gsl_matrix_view qView = gsl_matrix_view_array(q.getPointer(), n, n);
+      gsl_vector_view diagView = gsl_vector_view_array(diag.getPointer(), n);
+      gsl_vector_view subdiagView = gsl_vector_view_array(subdiag.getPointer(), n - 1);
+      gsl_linalg_symmtd_decomp(&m.matrix, tau);
+      gsl_linalg_symmtd_unpack(&m.matrix, tau, &qView.matrix, &diagView.vector,
+                               &subdiagView.vector);
+      gsl_vector_free(tau);
+    }) << "s\n";
+#endif /* USE_GSL */
+    std::cout << std::flush;
+  }
+
+  return 0;
+}
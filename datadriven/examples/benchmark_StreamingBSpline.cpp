@@ -0,0 +1,122 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ * Measures the time of mult and multTranspose of an operation.
+ */
+void measure(const std::string& name, sgpp::base::OperationMultipleEval& op,
+             sgpp::base::DataVector& alpha, sgpp::base::DataVector& source,
+             sgpp::base::DataVector& result, sgpp::base::DataVector& resultTranspose) {
+  auto begin = std::chrono::high_resolution_clock::now();
+  op.mult(alpha, result);
+  auto end = std::chrono::high_resolution_clock::now();
+  const double multTime = std::chrono::duration<double>(end - begin).count();
+
+  begin = std::chrono::high_resolution_clock::now();
+  op.multTranspose(source, resultTranspose);
+  end = std::chrono::high_resolution_clock::now();
+  const double multTransposeTime = std::chrono::duration<double>(end - begin).count();
+
+  std::cout << "  " << name << ": mult " << multTime << "s, multTranspose " << multTransposeTime
+            << "s\n";
+}
+
+/**
+ * Compares the naive and the streaming multi-evaluation
+ * (OperationMultipleEvalType::STREAMING) on B-spline grids.
+ */
+int main() {
+  const size_t dim = 5;
+  const size_t level = 5;
+  const size_t degree = 3;
+  const size_t numberDataPoints = 20000;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = distribution(generator);
+    }
+  }
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t k = 0; k < 3; k++) {
+    std::unique_ptr<sgpp::base::Grid> grid;
+
+    if (k == 0) {
+      grid.reset(sgpp::base::Grid::createBsplineGrid(dim, degree));
+    } else if (k == 1) {
+      grid.reset(sgpp::base::Grid::createModBsplineGrid(dim, degree));
+    } else {
+      grid.reset(sgpp::base::Grid::createBsplineBoundaryGrid(dim, degree));
+    }
+
+    grid->getGenerator().regular((k == 2) ? level - 1 : level);
+
+    sgpp::base::DataVector alpha(grid->getSize());
+    sgpp::base::DataVector source(numberDataPoints);
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = distribution(generator);
+    }
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      source[i] = distribution(generator);
+    }
+
+    std::cout << grid->getTypeAsString() << ": dim = " << dim << ", degree = " << degree
+              << ", grid points = " << grid->getSize() << ", data points = " << numberDataPoints
+              << "\n";
+
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opNaive(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opStreaming(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+
+    sgpp::base::DataVector resultNaive(numberDataPoints);
+    sgpp::base::DataVector resultTransposeNaive(grid->getSize());
+    sgpp::base::DataVector resultStreaming(numberDataPoints);
+    sgpp::base::DataVector resultTransposeStreaming(grid->getSize());
+
+    measure("naive    ", *opNaive, alpha, source, resultNaive, resultTransposeNaive);
+    measure("streaming", *opStreaming, alpha, source, resultStreaming, resultTransposeStreaming);
+
+    double maxError = 0.0;
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      maxError = std::max(maxError, std::abs(resultNaive[i] - resultStreaming[i]));
+    }
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      maxError =
+          std::max(maxError, std::abs(resultTransposeNaive[i] - resultTransposeStreaming[i]));
+    }
+
+    std::cout << "  maximal difference = " << maxError << std::endl;
+  }
+
+  return 0;
+}
@@ -6,6 +6,8 @@
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 
 #include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
+#include <sgpp/base/grid/type/BsplineGrid.hpp>
 
 #include <sgpp/base/grid/type/ModBsplineGrid.hpp>
 #include <sgpp/base/grid/type/ModPolyGrid.hpp>
@@ -89,6 +91,7 @@
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
 
 #ifdef __AVX__
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
@@ -129,6 +132,47 @@
 namespace sgpp {
 namespace op_factory {
 
+namespace {
+
+/**
+ * Checks whether the precision of a multi-evaluation configuration is supported for
+ * datasets stored in double (DataMatrix) or single (DataMatrixSP) precision.
+ * DOUBLE is only supported for double precision datasets, SINGLE and MIXED only for
+ * single precision datasets.
+ *
+ * @param precision precision of the configuration
+ * @param singlePrecisionDataset whether the dataset is stored in single precision
+ * @return whether the results are accumulated in double precision
+ */
+bool accumulatesInDoublePrecision(datadriven::OperationMultipleEvalPrecision precision,
+                                  bool singlePrecisionDataset) {
+  switch (precision) {
+    case datadriven::OperationMultipleEvalPrecision::DOUBLE:
+      if (singlePrecisionDataset) {
+        throw base::factory_exception(
+            "OperationMultipleEval: double precision is not supported for single precision "
+            "datasets, use OperationMultipleEvalPrecision::MIXED instead.");
+      }
+
+      return true;
+
+    case datadriven::OperationMultipleEvalPrecision::SINGLE:
+    case datadriven::OperationMultipleEvalPrecision::MIXED:
+      if (!singlePrecisionDataset) {
+        throw base::factory_exception(
+            "OperationMultipleEval: single and mixed precision are only supported for single "
+            "precision datasets (createOperationMultipleEvalSP).");
+      }
+
+      return (precision == datadriven::OperationMultipleEvalPrecision::MIXED);
+
+    default:
+      throw base::factory_exception("OperationMultipleEval: unknown precision.");
+  }
+}
+
+}  // namespace
+
 datadriven::OperationTest* createOperationTest(base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear) {
     return new datadriven::OperationTestLinear(&grid.getStorage());
@@ -410,6 +454,8 @@ datadriven::OperationDensityConditionalKDE* createOperationDensityConditionalKDE
 base::OperationMultipleEval* createOperationMultipleEval(
     base::Grid& grid, base::DataMatrix& dataset,
     sgpp::datadriven::OperationMultipleEvalConfiguration& configuration) {
+  accumulatesInDoublePrecision(configuration.getPrecision(), false);
+
   if (configuration.getMPIType() == sgpp::datadriven::OperationMultipleEvalMPIType::MASTERSLAVE) {
 #ifdef USE_MPI
     if (grid.getType() == base::GridType::Linear) {
@@ -504,6 +550,10 @@ base::OperationMultipleEval* createOperationMultipleEval(
     }
   } else if (grid.getType() == base::GridType::Bspline) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingBSpline(
+            grid, dynamic_cast<base::BsplineGrid*>(&grid)->getDegree(), dataset);
+      }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCL) {
 #ifdef USE_OCL
         return datadriven::createStreamingBSplineOCLConfigured(grid, dataset, configuration);
@@ -513,6 +563,18 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       }
     }
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    if ((configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) &&
+        (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT)) {
+      return new datadriven::OperationMultiEvalStreamingBSpline(
+          grid, dynamic_cast<base::ModBsplineGrid*>(&grid)->getDegree(), dataset);
+    }
+  } else if (grid.getType() == base::GridType::BsplineBoundary) {
+    if ((configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) &&
+        (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT)) {
+      return new datadriven::OperationMultiEvalStreamingBSpline(
+          grid, dynamic_cast<base::BsplineBoundaryGrid*>(&grid)->getDegree(), dataset);
+    }
   } else if (grid.getType() == base::GridType::Poly) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::CUDA) {
@@ -538,6 +600,19 @@ base::OperationMultipleEval* createOperationMultipleEval(
   throw base::factory_exception("OperationMultiEval is not implemented for this grid type.");
 }
 
+base::OperationMultipleEvalSP* createOperationMultipleEvalSP(
+    base::Grid& grid, base::DataMatrixSP& dataset,
+    sgpp::datadriven::OperationMultipleEvalConfiguration& configuration) {
+  if (configuration.getType() != sgpp::datadriven::OperationMultipleEvalType::DEFAULT ||
+      configuration.getMPIType() != sgpp::datadriven::OperationMultipleEvalMPIType::NONE) {
+    throw base::factory_exception(
+        "createOperationMultipleEvalSP is only implemented for the default type.");
+  }
+
+  const bool mixedPrecision = accumulatesInDoublePrecision(configuration.getPrecision(), true);
+  return createOperationMultipleEvalSP(grid, dataset, mixedPrecision);
+}
+
 datadriven::OperationMakePositive* createOperationMakePositive(
     datadriven::MakePositiveCandidateSearchAlgorithm candidateSearchAlgorithm,
     datadriven::MakePositiveInterpolationAlgorithm interpolationAlgorithm,
@@ -20,6 +20,7 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationCovariance.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalSP.hpp>
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 
 #include <sgpp/datadriven/operation/hash/simple/OperationLimitFunctionValueRange.hpp>
@@ -181,6 +182,8 @@ datadriven::OperationDensityConditionalKDE* createOperationDensityConditionalKDE
 
 /**
  * Factory method, returning an OperationMultipleEval for the grid.
+ * Only OperationMultipleEvalPrecision::DOUBLE is supported, otherwise a factory_exception
+ * is thrown.
  *
  * @param grid Grid which is to be used for the operation
  * @param dataset dataset to be evaluated
@@ -191,6 +194,21 @@ base::OperationMultipleEval* createOperationMultipleEval(
     base::Grid& grid, base::DataMatrix& dataset,
     sgpp::datadriven::OperationMultipleEvalConfiguration& configuration);
 
+/**
+ * Factory method, returning a single precision OperationMultipleEvalSP for the grid.
+ * The precision of the accumulation is taken from the configuration
+ * (OperationMultipleEvalPrecision::SINGLE accumulates in single precision,
+ * MIXED in double precision); for DOUBLE a factory_exception is thrown.
+ *
+ * @param grid Grid which is to be used for the operation
+ * @param dataset dataset to be evaluated (single precision)
+ * @param configuration configuration to be used (precision)
+ * @return Pointer to new OperationMultipleEvalSP for the Grid grid
+ */
+base::OperationMultipleEvalSP* createOperationMultipleEvalSP(
+    base::Grid& grid, base::DataMatrixSP& dataset,
+    sgpp::datadriven::OperationMultipleEvalConfiguration& configuration);
+
 /**
  * Factory method, returning an OperationMakePositive for an arbitrary function f or some
  * sparse grid, which is yet to be defined.
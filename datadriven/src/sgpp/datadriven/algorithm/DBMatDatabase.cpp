@@ -14,6 +14,10 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
 #include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 namespace sgpp {
@@ -30,6 +34,22 @@ const std::string keyRegularizationStrength = "lambda";
 const std::string keyDecompositionType = "decomposition";
 const std::string keyFilepath = "filepath";
 
+namespace {
+
+/**
+ * Process-wide cache of the offline objects loaded by DBMatDatabase::loadDataMatrix, indexed by
+ * the filepath of the serialized object. The cache does not own the objects, an entry expires
+ * as soon as the last caller releases its object.
+ */
+std::map<std::string, std::weak_ptr<const DBMatOffline>> offlineCache;
+
+/**
+ * Guards offlineCache
+ */
+std::mutex offlineCacheMutex;
+
+}  // namespace
+
 DBMatDatabase::DBMatDatabase(const std::string& filepath) {
   databaseFilepath = filepath;
   databaseRoot = std::make_unique<json::JSON>(filepath);
@@ -70,6 +90,52 @@ std::string& DBMatDatabase::getDataMatrix(
   }
 }
 
+std::shared_ptr<const DBMatOffline> DBMatDatabase::loadDataMatrix(
+    sgpp::base::GeneralGridConfiguration& gridConfig,
+    sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+    sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  const std::string filepath = getDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig);
+  std::shared_ptr<const DBMatOffline> offline;
+
+  {
+    std::lock_guard<std::mutex> lock(offlineCacheMutex);
+    auto it = offlineCache.find(filepath);
+
+    if (it != offlineCache.end()) {
+      offline = it->second.lock();
+    }
+  }
+
+  if (offline == nullptr) {
+    // Not loaded yet or released by all callers: map the file (outside the lock, concurrent
+    // loads of the same file are harmless, the first one that is still alive is kept)
+    offline = std::shared_ptr<const DBMatOffline>(DBMatOfflineFactory::buildFromFile(filepath));
+    std::lock_guard<std::mutex> lock(offlineCacheMutex);
+    std::weak_ptr<const DBMatOffline>& entry = offlineCache[filepath];
+    std::shared_ptr<const DBMatOffline> cached = entry.lock();
+
+    if (cached != nullptr) {
+      offline = cached;
+    } else {
+      entry = offline;
+    }
+
+    // remove the entries of objects that have been released
+    for (auto it = offlineCache.begin(); it != offlineCache.end();) {
+      it = it->second.expired() ? offlineCache.erase(it) : std::next(it);
+    }
+  }
+
+  return offline;
+}
+
+void DBMatDatabase::clearCache() {
+  std::lock_guard<std::mutex> lock(offlineCacheMutex);
+  offlineCache.clear();
+}
+
 void DBMatDatabase::putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConfig,
     sgpp::base::AdaptivityConfiguration& adaptivityConfig,
     sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
@@ -107,6 +173,11 @@ void DBMatDatabase::putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConf
     // Update only if overwriteEntry is set to true
     if (overwriteEntry) {
       json::DictNode* entry = (json::DictNode*)(&((*database)[entry_index]));
+      {
+        std::lock_guard<std::mutex> lock(offlineCacheMutex);
+        offlineCache.erase((*entry)[keyFilepath].get());
+        offlineCache.erase(filepath);
+      }
       entry->replaceTextAttr(keyFilepath, filepath);
       databaseRoot->serialize(databaseFilepath);
       std::cout << "Updated matrix decomposition to \"" << filepath << "\" in database"
@@ -10,6 +10,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -55,6 +56,33 @@ class DBMatDatabase{
       sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
 
+  /**
+   * Loads the matrix decomposition that matches the configurations. Decompositions are cached
+   * process-wide by their filepath: as long as a caller holds the returned object, later lookups
+   * (from any DBMatDatabase instance) share it instead of reading the file again. The cache does
+   * not keep the objects alive, once all callers released an object, the next lookup reads the
+   * file again. The shared object is read-only, callers that modify the offline object (e.g.,
+   * online objects during refinement) work on a clone().
+   * @param gridConfig the grid configuration the matrix must match
+   * @param adaptivityConfig the adaptivity configuration the matrix must match
+   * @param regularizationConfig the regularization configuration the matrix must match
+   * @param densityEstimationConfig the density estimation configuration the matrix must match
+   * @return offline object shared with the cache, throws an exception if the database does not
+   * contain a matching entry
+   */
+  std::shared_ptr<const DBMatOffline> loadDataMatrix(
+      sgpp::base::GeneralGridConfiguration& gridConfig,
+      sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+      sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
+
+  /**
+   * Removes all decompositions from the process-wide cache used by loadDataMatrix, e.g., after
+   * the files were overwritten by another process. Objects that are still held by callers stay
+   * valid, but are not shared with later lookups.
+   */
+  static void clearCache();
+
   /**
    * Puts a filepath for a given configuration in the database. The filepath refers to the matrix
    * file. If for this configuration a filepath is already present in the database the filepath
@@ -65,7 +93,7 @@ class DBMatDatabase{
    * @param densityEstimationConfig the density estimation configuration the matrix matches
    * @param filepath the path where the matrix decomposition is located at
    * @param overwriteEntry replaces existing entries with the same configuration if and only if
-   * this parameter is set
+   * this parameter is set (the cached decomposition of the replaced entry is dropped)
    */
   void putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConfig,
       sgpp::base::AdaptivityConfiguration& adaptivityConfig,
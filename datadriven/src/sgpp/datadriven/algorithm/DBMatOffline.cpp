@@ -17,17 +17,15 @@
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_matrix_double.h>
-#endif /* USE_GSL */
-
 #include <math.h>
 #include <stdio.h>
 #include <algorithm>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -45,7 +43,8 @@ using sgpp::base::algorithm_exception;
 using sgpp::base::data_exception;
 using sgpp::base::OperationMatrix;
 
-DBMatOffline::DBMatOffline() : lhsMatrix(), isConstructed(false), isDecomposed(false) {
+DBMatOffline::DBMatOffline()
+    : lhsMatrix(), isConstructed(false), isDecomposed(false), mappedFile(), mappedOffset(0) {
   interactions = std::vector<std::vector<size_t>>();
 }
 
@@ -53,7 +52,9 @@ DBMatOffline::DBMatOffline(const DBMatOffline& rhs)
     : lhsMatrix(rhs.lhsMatrix),
       isConstructed(rhs.isConstructed),
       isDecomposed(rhs.isDecomposed),
-      interactions(rhs.interactions) { }
+      interactions(rhs.interactions),
+      mappedFile(rhs.mappedFile),
+      mappedOffset(rhs.mappedOffset) { }
 
 DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs) {
   if (&rhs == this) {
@@ -63,15 +64,43 @@ DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs)
   isConstructed = rhs.isConstructed;
   isDecomposed = rhs.isDecomposed;
   interactions = rhs.interactions;
+  mappedFile = rhs.mappedFile;
+  mappedOffset = rhs.mappedOffset;
   return *this;
 }
 
 DBMatOffline::DBMatOffline(const std::string& filepath)
-    : lhsMatrix(), isConstructed(true), isDecomposed(true) {
-  // Parse the interactions
-  parseInter(filepath, interactions);
+    : lhsMatrix(),
+      isConstructed(true),
+      isDecomposed(true),
+      interactions(),
+      mappedFile(std::make_shared<base::MemoryMappedFile>(filepath)),
+      mappedOffset(0) {
+  // The header is the first line of the file
+  const char* data = mappedFile->getData();
+  const char* headerEnd =
+      static_cast<const char*>(std::memchr(data, '\n', mappedFile->getSize()));
+
+  if (headerEnd == nullptr) {
+    throw algorithm_exception("DBMatOffline: serialized object has no header");
+  }
+
+  std::vector<std::string> tokens;
+  StringTokenizer::tokenize(std::string(data, headerEnd), ",", tokens);
+
+  if (tokens.size() < 4) {
+    throw algorithm_exception("DBMatOffline: invalid header of serialized object");
+  }
 
-  // Parsing of lhsMatrix will be done in subclass implementations
+  // Parse the interactions
+  parseInter(tokens, interactions);
+
+  // The binary payload starts after the header line (at an aligned offset for files written by
+  // store, but older files are supported as well). The (decomposed) matrix is always stored
+  // first, the data of the subclasses is read in the subclass implementations.
+  mappedOffset = static_cast<size_t>(headerEnd - data) + 1;
+  lhsMatrix = DataMatrix(std::stoul(tokens[0]), std::stoul(tokens[1]));
+  readMappedArray(lhsMatrix.getPointer(), lhsMatrix.getSize() * sizeof(double));
 }
 
 DataMatrix& DBMatOffline::getDecomposedMatrix() {
@@ -82,6 +111,14 @@ DataMatrix& DBMatOffline::getDecomposedMatrix() {
   }
 }
 
+const DataMatrix& DBMatOffline::getDecomposedMatrix() const {
+  if (isDecomposed) {
+    return lhsMatrix;
+  } else {
+    throw data_exception("Matrix was not decomposed yet");
+  }
+}
+
 
 void DBMatOffline::buildMatrix(Grid* grid, RegularizationConfiguration& regularizationConfig) {
   if (isConstructed) {  // Already constructed, do nothing
@@ -103,47 +140,45 @@ void DBMatOffline::buildMatrix(Grid* grid, RegularizationConfiguration& regulari
 }
 
 void DBMatOffline::store(const std::string& fileName) {
-#ifdef USE_GSL
   if (!isDecomposed) {
     throw algorithm_exception("Matrix not decomposed yet");
-    return;
   }
 
-  // Write configuration
-  std::ofstream outputFile(fileName, std::ofstream::out);
+  std::ofstream outputFile(fileName, std::ofstream::out | std::ofstream::binary);
 
   if (!outputFile) {
     throw algorithm_exception{"cannot open file for writing"};
   }
 
-  std::string inter = "," + std::to_string(interactions.size());
+  // Write configuration
+  std::string header = std::to_string(lhsMatrix.getNrows()) + "," +
+                       std::to_string(lhsMatrix.getNcols()) + "," +
+                       std::to_string(static_cast<int>(getDecompositionType())) + "," +
+                       std::to_string(interactions.size());
   for (std::vector<size_t> i : interactions) {
-    inter.append("," + std::to_string(i.size()));
+    header.append("," + std::to_string(i.size()));
     for (size_t j : i) {
-      inter.append("," + std::to_string(j));
+      header.append("," + std::to_string(j));
     }
   }
 
-  outputFile << lhsMatrix.getNrows() << "," << lhsMatrix.getNcols() << ","
-             << static_cast<int>(getDecompositionType()) << inter << "\n";
-  outputFile.close();
+  // pad the header line such that the matrix can be mapped at an aligned address
+  const size_t headerSize = header.size() + 1;
+  header.append((payloadAlignment - headerSize % payloadAlignment) % payloadAlignment, ' ');
+  header.push_back('\n');
+  outputFile.write(header.data(), static_cast<std::streamsize>(header.size()));
 
-  // write matrix
-  // switch to c FILE API for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
+  // write matrix (row-major, same layout as gsl_matrix_fwrite)
+  outputFile.write(reinterpret_cast<const char*>(lhsMatrix.getPointer()),
+                   static_cast<std::streamsize>(lhsMatrix.getSize() * sizeof(double)));
+
+  if (!outputFile) {
+    throw algorithm_exception{"cannot write file"};
   }
-  gsl_matrix_view matrixView =
-      gsl_matrix_view_array(lhsMatrix.getPointer(), lhsMatrix.getNrows(), lhsMatrix.getNcols());
-  gsl_matrix_fwrite(outputCFile, &matrixView.matrix);
 
-  fclose(outputCFile);
+  outputFile.close();
   std::cout << "Stored " << lhsMatrix.getNrows() << "x" << lhsMatrix.getNcols() << " matrix" <<
       std::endl;
-#else
-  throw base::not_implemented_exception("built withot GSL");
-#endif /* USE_GSL */
 }
 
 void DBMatOffline::printMatrix() {
@@ -155,20 +190,8 @@ void DBMatOffline::printMatrix() {
   }
 }
 
-void sgpp::datadriven::DBMatOffline::parseInter(const std::string& fileName,
+void sgpp::datadriven::DBMatOffline::parseInter(const std::vector<std::string>& tokens,
     std::vector<std::vector<size_t>>& interactions) const {
-  std::ifstream file(fileName, std::istream::in);
-  // Read configuration
-  if (!file) {
-    throw algorithm_exception("Failed to open File");
-  }
-  std::string str;
-  std::getline(file, str);
-  file.close();
-
-  std::vector<std::string> tokens;
-  StringTokenizer::tokenize(str, ",", tokens);
-
   for (size_t i = 4; i < tokens.size(); i+= std::stoi(tokens[i])+1) {
     std::vector<size_t> tmp = std::vector<size_t>();
     for (size_t j = 1; j <= std::stoul(tokens[i]); j++) {
@@ -176,10 +199,16 @@ void sgpp::datadriven::DBMatOffline::parseInter(const std::string& fileName,
     }
     interactions.push_back(tmp);
   }
-
-  std::cout << interactions.size() << std::endl;
 }
 
+void DBMatOffline::readMappedArray(void* destination, size_t bytes) {
+  if ((mappedFile == nullptr) || (mappedOffset + bytes > mappedFile->getSize())) {
+    throw algorithm_exception("DBMatOffline: serialized object is incomplete");
+  }
+
+  std::memcpy(destination, mappedFile->getData() + mappedOffset, bytes);
+  mappedOffset += bytes;
+}
 
 size_t DBMatOffline::getGridSize() { return lhsMatrix.getNrows(); }
 
@@ -6,10 +6,12 @@
 #pragma once
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
 
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,7 +34,8 @@ class DBMatOffline {
  public:
   /**
    * Constructor
-   * Create offline object from serialized offline object
+   * Create offline object from serialized offline object. The file is memory-mapped read-only,
+   * so its pages are read on demand and shared with other processes that load the same file.
    *
    * @param fileName path to the file that stores serialized offline object
    */
@@ -70,7 +73,7 @@ class DBMatOffline {
    * @return a copy of this very object as a pointer to a new DBMatOffline object which is owned by
    * the caller.
    */
-  virtual DBMatOffline* clone() = 0;
+  virtual DBMatOffline* clone() const = 0;
 
   /**
    * Only Offline objects based on Cholesky decomposition, or orthogonal adaptivity can be refined
@@ -85,6 +88,14 @@ class DBMatOffline {
    */
   DataMatrix& getDecomposedMatrix();
 
+  /**
+   * Get a read-only reference to the decomposed matrix, e.g., of a shared offline object loaded
+   * by DBMatDatabase::loadDataMatrix. Throws if matrix has not yet been decomposed.
+   *
+   * @return decomposed matrix
+   */
+  const DataMatrix& getDecomposedMatrix() const;
+
   /**
    * Allows access to lhs matrix, which is meant ONLY FOR TESTING
    */
@@ -113,7 +124,10 @@ class DBMatOffline {
   void printMatrix();
 
   /**
-   * Serialize the DBMatOffline Object
+   * Serialize the DBMatOffline Object. The file consists of a text header line (size of the
+   * matrix, decomposition type and interactions), padded with spaces such that the binary payload
+   * starts at a multiple of payloadAlignment bytes, followed by the row-major matrix entries
+   * (the same layout as gsl_matrix_fwrite) and the data of the subclasses.
    * @param fileName path where to store the file.
    */
   virtual void store(const std::string& fileName);
@@ -130,6 +144,12 @@ class DBMatOffline {
    */
   virtual sgpp::datadriven::MatrixDecompositionType getDecompositionType() = 0;
 
+ public:
+  /**
+   * Alignment of the binary payload of serialized offline objects in bytes
+   */
+  static const size_t payloadAlignment = 64;
+
  protected:
   DBMatOffline();
   DataMatrix lhsMatrix;              // stores the (decomposed) matrix
@@ -142,12 +162,31 @@ class DBMatOffline {
 
  protected:
   /**
-   * Read the Interactionsterms from a serialized DBMatOfflibe object.
-   * @param fileName path of the serialized DBMatOffline object
+   * Read the Interactionsterms from the header of a serialized DBMatOffline object.
+   * @param tokens the comma-separated tokens of the header line
    * @param interactions the interactions to populate
    */
-  void parseInter(const std::string& fileName,
+  void parseInter(const std::vector<std::string>& tokens,
       std::vector<std::vector<size_t>>& interactions) const;
+
+  /**
+   * Copies the next array of the binary payload of the mapped file and advances the read
+   * position. Used by the subclasses to read the data they append in store().
+   * @param destination where to copy the data to
+   * @param bytes size of the array in bytes
+   */
+  void readMappedArray(void* destination, size_t bytes);
+
+  /**
+   * Read-only mapping of the file this object was loaded from (nullptr if it was not loaded
+   * from a file), shared between copies of the object
+   */
+  std::shared_ptr<base::MemoryMappedFile> mappedFile;
+
+  /**
+   * Read position in the mapped file in bytes
+   */
+  size_t mappedOffset;
 };
 
 }  // namespace datadriven
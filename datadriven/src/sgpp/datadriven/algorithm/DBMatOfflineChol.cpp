@@ -14,6 +14,7 @@
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatParallelDecomposition.hpp>
 
 #ifdef USE_GSL
 #include <gsl/gsl_blas.h>
@@ -40,13 +41,12 @@ DBMatOfflineChol::DBMatOfflineChol() : DBMatOfflineGE() {}
 
 DBMatOfflineChol::DBMatOfflineChol(const std::string& fileName) : DBMatOfflineGE{fileName} {}
 
-DBMatOffline* DBMatOfflineChol::clone() { return new DBMatOfflineChol{*this}; }
+DBMatOffline* DBMatOfflineChol::clone() const { return new DBMatOfflineChol{*this}; }
 
 bool DBMatOfflineChol::isRefineable() { return true; }
 
 void DBMatOfflineChol::decomposeMatrix(RegularizationConfiguration& regularizationConfig,
     DensityEstimationConfiguration& densityEstimationConfig) {
-#ifdef USE_GSL
   if (isConstructed) {
     if (isDecomposed) {
       // Already decomposed => Do nothing
@@ -54,19 +54,28 @@ void DBMatOfflineChol::decomposeMatrix(RegularizationConfiguration& regularizati
     } else {
       auto begin = std::chrono::high_resolution_clock::now();
 
-      size_t n = lhsMatrix.getNrows();
-      gsl_matrix_view m = gsl_matrix_view_array(lhsMatrix.getPointer(), n,
-                                                n);  // Create GSL matrix view for decomposition
-      // Perform Cholesky decomposition
-      gsl_linalg_cholesky_decomp(&m.matrix);
-
-      // Isolate lower triangular matrix
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          if (i < j) {
-            lhsMatrix.set(i, j, 0);
+      if (densityEstimationConfig.parallelDecomposition_) {
+        // Blocked parallel Cholesky decomposition, yields the lower triangular matrix
+        DBMatParallelDecomposition::cholesky(lhsMatrix);
+      } else {
+#ifdef USE_GSL
+        size_t n = lhsMatrix.getNrows();
+        gsl_matrix_view m = gsl_matrix_view_array(lhsMatrix.getPointer(), n,
+                                                  n);  // Create GSL matrix view for decomposition
+        // Perform Cholesky decomposition
+        gsl_linalg_cholesky_decomp(&m.matrix);
+
+        // Isolate lower triangular matrix
+        for (size_t i = 0; i < n; i++) {
+          for (size_t j = 0; j < n; j++) {
+            if (i < j) {
+              lhsMatrix.set(i, j, 0);
+            }
           }
         }
+#else
+        throw algorithm_exception("built withot GSL");
+#endif /*USE_GSL*/
       }
       isDecomposed = true;
       auto end = std::chrono::high_resolution_clock::now();
@@ -77,19 +86,15 @@ void DBMatOfflineChol::decomposeMatrix(RegularizationConfiguration& regularizati
   } else {
     throw algorithm_exception("Matrix has to be constructed before it can be decomposed");
   }
-#else
-  throw algorithm_exception("built withot GSL");
-#endif /*USE_GSL*/
 }
 
 void DBMatOfflineChol::choleskyModification(Grid& grid,
-    datadriven::DensityEstimationConfiguration&, size_t newPoints,
+    datadriven::DensityEstimationConfiguration& densityEstimationConfig, size_t newPoints,
     std::list<size_t> deletedPoints, double lambda) {
-#ifdef USE_GSL
-
   // Start coarsening
   // If list 'deletedPoints' is not empty, grid points got removed
   if (deletedPoints.size() > 0) {
+#ifdef USE_GSL
     size_t new_size = grid.getSize();
     size_t old_size = new_size - newPoints + deletedPoints.size();
 
@@ -142,19 +147,27 @@ void DBMatOfflineChol::choleskyModification(Grid& grid,
       // for necessary rank one updates
       lhsMatrix.resizeToSubMatrix(coarseCount_1 + 1, coarseCount_1 + 1, lhsMatrix.getNrows(),
                                   lhsMatrix.getNrows());
-      DataVector temp_col(update_matrix.getNrows());
-
-      // 'coarseCount_1' many rank one updates based on the columns of
-      // 'update_matrix' are performed
-      DBMatDMSChol cholsolver;
-      for (size_t i = 0; i < coarseCount_1; i++) {
-        update_matrix.getColumn(i, temp_col);
-        cholsolver.choleskyUpdate(lhsMatrix, temp_col, false);
+      if (densityEstimationConfig.parallelDecomposition_) {
+        // All 'coarseCount_1' rank one updates in one blocked pass over the factor
+        DBMatParallelDecomposition::choleskyUpdate(lhsMatrix, update_matrix);
+      } else {
+        DataVector temp_col(update_matrix.getNrows());
+
+        // 'coarseCount_1' many rank one updates based on the columns of
+        // 'update_matrix' are performed
+        DBMatDMSChol cholsolver;
+        for (size_t i = 0; i < coarseCount_1; i++) {
+          update_matrix.getColumn(i, temp_col);
+          cholsolver.choleskyUpdate(lhsMatrix, temp_col, false);
+        }
       }
     } else {
       // If no indices have been less than 'c'
       lhsMatrix.resizeQuadratic(old_size - coarseCount_2);
     }
+#else
+    throw algorithm_exception("built withot GSL");
+#endif /*USE_GSL*/
   }
 
   // Start refinement
@@ -162,8 +175,8 @@ void DBMatOfflineChol::choleskyModification(Grid& grid,
     size_t gridSize = grid.getStorage().getSize();
     size_t gridDim = grid.getStorage().getDimension();
 
-    // DataMatrix to collect vectors to append
-    DataMatrix mat_refine(gridSize, newPoints);
+    // DataMatrix to collect the rows to append
+    DataMatrix mat_refine(newPoints, gridSize);
 
     DataMatrix level(gridSize, gridDim);
     DataMatrix index(gridSize, gridDim);
@@ -172,6 +185,7 @@ void DBMatOfflineChol::choleskyModification(Grid& grid,
     double lambda_conf = lambda;
     // Loop to calculate all L2-products of added points based on the
     // hat-function as basis function
+#pragma omp parallel for schedule(static)
     for (size_t i = 0; i < gridSize; i++) {
       for (size_t j = gridSize - newPoints; j < gridSize; j++) {
         double res = 1;
@@ -219,9 +233,9 @@ void DBMatOfflineChol::choleskyModification(Grid& grid,
 
         // add current lambda to lower diagonal elements of mat_refine
         if (i == j) {
-          mat_refine.set(i, j - gridSize + newPoints, res + lambda_conf);
+          mat_refine.set(j - gridSize + newPoints, i, res + lambda_conf);
         } else {
-          mat_refine.set(i, j - gridSize + newPoints, res);
+          mat_refine.set(j - gridSize + newPoints, i, res);
         }
       }
     }
@@ -233,18 +247,25 @@ void DBMatOfflineChol::choleskyModification(Grid& grid,
     // in order to save runtime
     this->lhsMatrix.resizeQuadratic(gridSize);
 
-    // Now its time to call 'choleskyAddPoint''countNewGridPoints' often
-    DataVector temp_col = DataVector(gridSize);
-    for (size_t j = gridSize - newPoints; j < gridSize; j++) {
-      temp_col.resizeZero(gridSize);
-      mat_refine.getColumn(j - gridSize + newPoints, temp_col);
-      temp_col.resizeZero(j + 1);
-      choleskyAddPoint(temp_col, j);
-    }
-  }
+    if (densityEstimationConfig.parallelDecomposition_) {
+      // Append all rows at once (blocked forward substitution)
+      DBMatParallelDecomposition::choleskyAppendRows(lhsMatrix, gridSize - newPoints,
+                                                     mat_refine);
+    } else {
+#ifdef USE_GSL
+      // Now its time to call 'choleskyAddPoint''countNewGridPoints' often
+      DataVector temp_col = DataVector(gridSize);
+      for (size_t j = gridSize - newPoints; j < gridSize; j++) {
+        temp_col.resizeZero(gridSize);
+        mat_refine.getRow(j - gridSize + newPoints, temp_col);
+        temp_col.resizeZero(j + 1);
+        choleskyAddPoint(temp_col, j);
+      }
 #else
-  throw algorithm_exception("built withot GSL");
+      throw algorithm_exception("built withot GSL");
 #endif /*USE_GSL*/
+    }
+  }
 }
 
 
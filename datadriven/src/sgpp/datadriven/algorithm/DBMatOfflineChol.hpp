@@ -31,7 +31,7 @@ class DBMatOfflineChol : public DBMatOfflineGE {
 
   explicit DBMatOfflineChol(const std::string& fileName);
 
-  DBMatOffline* clone() override;
+  DBMatOffline* clone() const override;
 
   bool isRefineable() override;
 
@@ -52,7 +52,10 @@ class DBMatOfflineChol : public DBMatOfflineGE {
 
   /**
    * Updates offline cholesky factorization based on coarsed (deletedPoints)
-   * and refined (newPoints) gridPoints
+   * and refined (newPoints) gridPoints. If parallelDecomposition_ is set in the density
+   * estimation configuration, all points of a step are processed as one batch (blocked rank-k
+   * update, blocked appending of the new rows, see DBMatParallelDecomposition), otherwise one
+   * point at a time. Coarsening always requires GSL, refinement only if processed point by point.
    *
    * @param grid the underlying grid
    * @param densityEstimationConfig configuration for the density estimation
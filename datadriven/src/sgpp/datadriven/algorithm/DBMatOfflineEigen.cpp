@@ -18,7 +18,6 @@
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
-#include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_eigen.h>
@@ -39,47 +38,9 @@ using sgpp::base::OperationMatrix;
 DBMatOfflineEigen::DBMatOfflineEigen() {}
 
 sgpp::datadriven::DBMatOfflineEigen::DBMatOfflineEigen(const std::string& fileName)
-    : DBMatOffline{fileName} {
-  // Read grid size from header (number of rows in lhsMatrix)
-  std::ifstream filestream(fileName, std::istream::in);
-  // Read configuration
-  if (!filestream) {
-    throw algorithm_exception("Failed to open File");
-  }
-  std::string str;
-  std::getline(filestream, str);
-  filestream.close();
-
-  std::vector<std::string> tokens;
-  StringTokenizer::tokenize(str, ",", tokens);
-
-  auto nCols = std::stoi(tokens[0]);
-  auto nRows = std::stoi(tokens[1]);
-
-  FILE* file = fopen(fileName.c_str(), "rb");
-  if (!file) {
-    throw application_exception{"Failed to open File"};
-  }
-
-  // seek end of first line
-  char c = 0;
-  while (c != '\n') {
-    c = static_cast<char>(fgetc(file));
-  }
-
-  // TODO(lettrich) : test if we can do this without copying.
-  // Read matrix
-  gsl_matrix* matrix;
-  matrix = gsl_matrix_alloc(nRows, nCols);
-  gsl_matrix_fread(file, matrix);
-  fclose(file);
-
-  lhsMatrix = DataMatrix(matrix->data, matrix->size1, matrix->size2);
-  gsl_matrix_free(matrix);
-}
-
+    : DBMatOffline{fileName} {}
 
-DBMatOffline* DBMatOfflineEigen::clone() { return new DBMatOfflineEigen{*this}; }
+DBMatOffline* DBMatOfflineEigen::clone() const { return new DBMatOfflineEigen{*this}; }
 
 bool DBMatOfflineEigen::isRefineable() { return false; }
 
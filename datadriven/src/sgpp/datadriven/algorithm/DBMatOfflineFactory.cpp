@@ -19,6 +19,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -79,7 +80,6 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 }
 
 DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
-#ifdef USE_GSL
   std::ifstream file(fileName, std::istream::in);
 
   if (!file) {
@@ -90,25 +90,25 @@ DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
   std::getline(file, str);
   file.close();
 
-  std::cout << str;
   std::vector<std::string> tokens;
   StringTokenizer::tokenize(str, ",", tokens);
-  std::cout << "tokens: ";
-  for (auto& item : tokens) {
-    std::cout << item << ",";
-  }
-  std::cout << std::endl;
 
   MatrixDecompositionType type = static_cast<MatrixDecompositionType>(std::stoi(tokens[2]));
 
-  std::cout << "type: " << static_cast<int>(type) << std::endl;
-
   switch (type) {
     case (MatrixDecompositionType::Eigen):
+#ifdef USE_GSL
       return new DBMatOfflineEigen(fileName);
+#else
+      throw factory_exception("built without GSL");
+#endif /* USE_GSL */
       break;
     case (MatrixDecompositionType::LU):
+#ifdef USE_GSL
       return new DBMatOfflineLU(fileName);
+#else
+      throw factory_exception("built without GSL");
+#endif /* USE_GSL */
       break;
     case (MatrixDecompositionType::Chol):
       return new DBMatOfflineChol(fileName);
@@ -123,9 +123,6 @@ DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
       throw factory_exception("Trying to build offline object from unknown decomposition type");
       return nullptr;
   }
-#else
-  throw factory_exception("built withot GSL");
-#endif /* USE_GSL */
 }
 
 } /* namespace datadriven */
@@ -16,7 +16,6 @@
 #include <sgpp/base/exception/not_implemented_exception.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/exception/algorithm_exception.hpp>
-#include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
 #ifdef USE_GSL
 #include <gsl/gsl_linalg.h>
@@ -38,48 +37,7 @@ using sgpp::base::DataMatrix;
 DBMatOfflineGE::DBMatOfflineGE() : DBMatOffline() {}
 
 sgpp::datadriven::DBMatOfflineGE::DBMatOfflineGE(const std::string& fileName)
-    : DBMatOffline{fileName} {
-  // Read grid size from header (number of rows in lhsMatrix)
-  std::ifstream filestream(fileName, std::istream::in);
-  // Read configuration
-  if (!filestream) {
-    throw algorithm_exception("Failed to open File");
-  }
-  std::string str;
-  std::getline(filestream, str);
-  filestream.close();
-
-  std::vector<std::string> tokens;
-  StringTokenizer::tokenize(str, ",", tokens);
-
-#ifdef USE_GSL
-  auto size = std::stoi(tokens[0]);
-
-  FILE* file = fopen(fileName.c_str(), "rb");
-  if (!file) {
-    throw application_exception{"Failed to open File"};
-  }
-
-  // seek end of first line
-  char c = 0;
-  while (c != '\n') {
-    c = static_cast<char>(fgetc(file));
-  }
-
-  // TODO(lettrich) : test if we can do this without copying.
-  // Read matrix
-  gsl_matrix* matrix;
-  matrix = gsl_matrix_alloc(size, size);
-  gsl_matrix_fread(file, matrix);
-  fclose(file);
-
-  lhsMatrix = DataMatrix(matrix->data, matrix->size1, matrix->size2);
-  gsl_matrix_free(matrix);
-#else
-  throw base::not_implemented_exception("built withot GSL");
-#endif /* USE_GSL */
-}
-
+    : DBMatOffline{fileName} {}
 
 void DBMatOfflineGE::buildMatrix(Grid* grid, RegularizationConfiguration& regularizationConfig) {
   // build matrix
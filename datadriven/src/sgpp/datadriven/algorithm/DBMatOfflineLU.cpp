@@ -14,7 +14,7 @@
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineLU.hpp>
-#include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
+#include <sgpp/datadriven/algorithm/DBMatParallelDecomposition.hpp>
 
 #include <gsl/gsl_linalg.h>
 #include <gsl/gsl_math.h>
@@ -22,6 +22,7 @@
 #include <gsl/gsl_permutation.h>
 #include <gsl/gsl_permute.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -52,7 +53,7 @@ DBMatOfflineLU& DBMatOfflineLU::operator=(const DBMatOfflineLU& rhs) {
   return *this;
 }
 
-DBMatOffline* DBMatOfflineLU::clone() { return new DBMatOfflineLU{*this}; }
+DBMatOffline* DBMatOfflineLU::clone() const { return new DBMatOfflineLU{*this}; }
 
 bool DBMatOfflineLU::isRefineable() { return false; }
 
@@ -70,7 +71,14 @@ void DBMatOfflineLU::decomposeMatrix(RegularizationConfiguration& regularization
           std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(n)};  // allocate permutation
       int signum;
 
-      gsl_linalg_LU_decomp(&m.matrix, permutation.get(), &signum);
+      if (densityEstimationConfig.parallelDecomposition_) {
+        // Blocked parallel LU decomposition, the permutation has the same format as in GSL
+        std::vector<size_t> rowPermutation;
+        signum = DBMatParallelDecomposition::lu(lhsMatrix, rowPermutation);
+        std::copy(rowPermutation.begin(), rowPermutation.end(), permutation->data);
+      } else {
+        gsl_linalg_LU_decomp(&m.matrix, permutation.get(), &signum);
+      }
       isDecomposed = true;
     }
 
@@ -80,50 +88,10 @@ void DBMatOfflineLU::decomposeMatrix(RegularizationConfiguration& regularization
 }
 
 DBMatOfflineLU::DBMatOfflineLU(const std::string& fileName)
-    : DBMatOfflineGE(), permutation{nullptr} {
-  isConstructed = true;
-  isDecomposed = true;
-
-  // Read grid size from header (number of rows in lhsMatrix)
-  std::ifstream filestream(fileName, std::istream::in);
-  // Read configuration
-  if (!filestream) {
-    throw algorithm_exception("Failed to open File");
-  }
-  std::string str;
-  std::getline(filestream, str);
-  filestream.close();
-
-  std::vector<std::string> tokens;
-  StringTokenizer::tokenize(str, ",", tokens);
-
-  auto size = std::stoi(tokens[0]);
-
-  FILE* file = fopen(fileName.c_str(), "rb");
-  if (!file) {
-    throw algorithm_exception{"Failed to open File"};
-  }
-
-  // seek end of first line
-  char c = 0;
-  while (c != '\n') {
-    c = static_cast<char>(fgetc(file));
-  }
-
-  // TODO(lettrich) : test if we can do this without copying.
-  // Read matrix
-  gsl_matrix* matrix;
-  matrix = gsl_matrix_alloc(size, size);
-  gsl_matrix_fread(file, matrix);
-
-  // read permutation
-  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(size)};
-  gsl_permutation_fread(file, permutation.get());
-
-  fclose(file);
-
-  lhsMatrix = DataMatrix(matrix->data, matrix->size1, matrix->size2);
-  gsl_matrix_free(matrix);
+    : DBMatOfflineGE{fileName}, permutation{nullptr} {
+  // read permutation, which is stored after the matrix
+  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(lhsMatrix.getNrows())};
+  readMappedArray(permutation->data, permutation->size * sizeof(size_t));
 }
 
 
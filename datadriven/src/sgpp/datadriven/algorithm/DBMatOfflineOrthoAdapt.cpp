@@ -11,7 +11,8 @@
 #endif /* USE_GSL */
 
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
-#include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
+#include <sgpp/datadriven/algorithm/DBMatParallelDecomposition.hpp>
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -27,63 +28,17 @@ DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt() : DBMatOffline() {
 
 DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt(const std::string& fileName)
     : DBMatOffline(fileName) {
+  // lhsMatrix is read in the super constructor, followed by q_ortho_matrix_ and t_inv_tridiag_
+  size_t size = getGridSize();
 
-  // Read grid size from header (number of rows in lhsMatrix)
-  std::ifstream filestream(fileName, std::istream::in);
-  // Read configuration
-  if (!filestream) {
-    throw sgpp::base::algorithm_exception("Failed to open File");
-  }
-  std::string str;
-  std::getline(filestream, str);
-  filestream.close();
-
-  std::vector<std::string> tokens;
-  StringTokenizer::tokenize(str, ",", tokens);
-
-  auto size = std::stoi(tokens[0]);
-  std::cout << "Grid size " << size << std::endl;
-  // grid already initialized in super constructor
-
-  this->lhsMatrix = sgpp::base::DataMatrix(size, size);
   this->q_ortho_matrix_ = sgpp::base::DataMatrix(size, size);
   this->t_tridiag_inv_matrix_ = sgpp::base::DataMatrix(size, size);
-#ifdef USE_GSL
-  gsl_matrix_view lhs_view =
-      gsl_matrix_view_array(this->lhsMatrix.getPointer(), size, size);
-  gsl_matrix_view q_view =
-      gsl_matrix_view_array(this->q_ortho_matrix_.getPointer(), size, size);
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(this->t_tridiag_inv_matrix_.getPointer(), size, size);
-
-  FILE* file = fopen(fileName.c_str(), "rb");
-  if (!file) {
-    throw sgpp::base::algorithm_exception{"Failed to open File"};
-  }
-
-  // seek end of first line
-  char c = 0;
-  while (c != '\n') {
-    c = static_cast<char>(fgetc(file));
-  }
-
-  std::cout << "Fread init" << std::endl;
-  gsl_matrix_fread(file, &lhs_view.matrix);
-  gsl_matrix_fread(file, &q_view.matrix);
-  gsl_matrix_fread(file, &t_inv_view.matrix);
-  std::cout << "Fread done" << std::endl;
-
-  fclose(file);
-
-  this->isConstructed = true;
-  this->isDecomposed = true;
-#else
-  throw sgpp::base::algorithm_exception("USE_GSL has to be set");
-#endif /* USE_GSL */
+  readMappedArray(this->q_ortho_matrix_.getPointer(), size * size * sizeof(double));
+  readMappedArray(this->t_tridiag_inv_matrix_.getPointer(), size * size * sizeof(double));
 }
 
 
-DBMatOffline* DBMatOfflineOrthoAdapt::clone() { return new DBMatOfflineOrthoAdapt{*this}; }
+DBMatOffline* DBMatOfflineOrthoAdapt::clone() const { return new DBMatOfflineOrthoAdapt{*this}; }
 
 bool DBMatOfflineOrthoAdapt::isRefineable() { return true; }
 
@@ -105,7 +60,11 @@ void DBMatOfflineOrthoAdapt::decomposeMatrix(RegularizationConfiguration& regula
   sgpp::base::DataVector subdiag(dim_a - 1);
 
   // decomposing: lhs = Q * T * Q^t
-  this->hessenberg_decomposition(diag, subdiag);
+  if (densityEstimationConfig.parallelDecomposition_) {
+    DBMatParallelDecomposition::tridiagonalize(lhsMatrix, q_ortho_matrix_, diag, subdiag);
+  } else {
+    this->hessenberg_decomposition(diag, subdiag);
+  }
 
   // adding configuration parameter lambda to diag before inverting T
   for (size_t i = 0; i < dim_a; i++) {
@@ -167,27 +126,26 @@ void DBMatOfflineOrthoAdapt::invert_symmetric_tridiag(sgpp::base::DataVector& di
 }
 
 void DBMatOfflineOrthoAdapt::store(const std::string& fileName) {
-#ifdef USE_GSL
   DBMatOffline::store(fileName);
 
-  FILE* outCFile = fopen(fileName.c_str(), "ab");
-  if (!outCFile) {
+  std::ofstream outputFile(fileName,
+                           std::ofstream::out | std::ofstream::app | std::ofstream::binary);
+  if (!outputFile) {
     throw sgpp::base::algorithm_exception{"cannot open file for writing"};
   }
 
   auto dim_a = getGridSize();
   // store q_ortho_matrix_
-  gsl_matrix_view q_view =
-      gsl_matrix_view_array(this->q_ortho_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &q_view.matrix);
+  outputFile.write(reinterpret_cast<const char*>(this->q_ortho_matrix_.getPointer()),
+                   static_cast<std::streamsize>(dim_a * dim_a * sizeof(double)));
 
   // store t_inv_tridiag_
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(this->t_tridiag_inv_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &t_inv_view.matrix);
+  outputFile.write(reinterpret_cast<const char*>(this->t_tridiag_inv_matrix_.getPointer()),
+                   static_cast<std::streamsize>(dim_a * dim_a * sizeof(double)));
 
-  fclose(outCFile);
-#endif /* USE_GSL */
+  if (!outputFile) {
+    throw sgpp::base::algorithm_exception{"cannot write file"};
+  }
 }
 
 
@@ -29,7 +29,7 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
    */
   explicit DBMatOfflineOrthoAdapt(const std::string& fileName);
 
-  DBMatOffline* clone();
+  DBMatOffline* clone() const override;
 
   bool isRefineable() override;
 
@@ -0,0 +1,784 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * DBMatParallelDecomposition.cpp
+ */
+
+#include <sgpp/datadriven/algorithm/DBMatParallelDecomposition.hpp>
+
+#include <sgpp/base/exception/algorithm_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::algorithm_exception;
+
+namespace {
+
+/**
+ * Computes the Householder reflection I - beta * v * v^T that maps x to alpha * e_1.
+ *
+ * @return false if x is already a multiple of e_1 (then alpha = x[0] and no reflection is needed)
+ */
+bool householderVector(const double* x, size_t m, std::vector<double>& v, double& beta,
+                       double& alpha) {
+  double sigma = 0.0;
+
+  for (size_t i = 1; i < m; i++) {
+    sigma += x[i] * x[i];
+  }
+
+  if (sigma == 0.0) {
+    alpha = x[0];
+    return false;
+  }
+
+  const double norm = std::sqrt(x[0] * x[0] + sigma);
+  alpha = (x[0] >= 0.0) ? -norm : norm;
+  std::copy(x, x + m, v.begin());
+  v[0] -= alpha;
+  beta = 2.0 / (v[0] * v[0] + sigma);
+  return true;
+}
+
+/**
+ * Computes p = beta * A * v for a symmetric m x m matrix A of which only the lower triangle is
+ * read (row stride n). The rows are distributed among the threads, the contributions of the
+ * strict lower triangle to the upper part of the product are summed up per thread.
+ */
+void symmetricProduct(const double* a, size_t n, size_t m, const double* v, double beta,
+                      double* p) {
+  std::fill(p, p + m, 0.0);
+
+#pragma omp parallel
+  {
+    std::vector<double> partialProduct(m, 0.0);
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t i = 0; i < m; i++) {
+      const double* row = a + i * n;
+      const double vi = v[i];
+      double s = 0.0;
+
+      for (size_t j = 0; j < i; j++) {
+        s += row[j] * v[j];
+        partialProduct[j] += row[j] * vi;
+      }
+
+      partialProduct[i] += s + row[i] * vi;
+    }
+
+#pragma omp critical
+    {
+      for (size_t i = 0; i < m; i++) {
+        p[i] += beta * partialProduct[i];
+      }
+    }
+  }
+}
+
+/**
+ * Computes the dot products of x with count (at most 4) vectors y, y + stride, ... of length m.
+ * Four vectors are processed at once, so each entry of x is loaded only once and the sums are
+ * accumulated independently.
+ */
+void dotProducts(const double* x, const double* y, size_t stride, size_t count, size_t m,
+                 double* result) {
+  if (count == 4) {
+    const double* y0 = y;
+    const double* y1 = y + stride;
+    const double* y2 = y + 2 * stride;
+    const double* y3 = y + 3 * stride;
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+
+    for (size_t j = 0; j < m; j++) {
+      const double xj = x[j];
+      s0 += xj * y0[j];
+      s1 += xj * y1[j];
+      s2 += xj * y2[j];
+      s3 += xj * y3[j];
+    }
+
+    result[0] = s0;
+    result[1] = s1;
+    result[2] = s2;
+    result[3] = s3;
+  } else {
+    for (size_t q = 0; q < count; q++) {
+      const double* yq = y + q * stride;
+      double s = 0.0;
+
+      for (size_t j = 0; j < m; j++) {
+        s += x[j] * yq[j];
+      }
+
+      result[q] = s;
+    }
+  }
+}
+
+}  // namespace
+
+void DBMatParallelDecomposition::cholesky(DataMatrix& matrix, size_t blockSize) {
+  const size_t n = matrix.getNrows();
+
+  if (matrix.getNcols() != n) {
+    throw algorithm_exception("DBMatParallelDecomposition::cholesky : matrix is not square");
+  }
+
+  blockSize = std::max(blockSize, size_t(1));
+  double* a = matrix.getPointer();
+
+  for (size_t k = 0; k < n; k += blockSize) {
+    const size_t kEnd = std::min(k + blockSize, n);
+
+    // factorize the diagonal block (the updates of the previous panels are already applied)
+    for (size_t j = k; j < kEnd; j++) {
+      double* rowJ = a + j * n;
+      double d = rowJ[j];
+
+      for (size_t m = k; m < j; m++) {
+        d -= rowJ[m] * rowJ[m];
+      }
+
+      if (!(d > 0.0)) {
+        throw algorithm_exception(
+            "DBMatParallelDecomposition::cholesky : matrix is not positive definite");
+      }
+
+      d = std::sqrt(d);
+      rowJ[j] = d;
+
+      for (size_t i = j + 1; i < kEnd; i++) {
+        double* rowI = a + i * n;
+        double s = rowI[j];
+
+        for (size_t m = k; m < j; m++) {
+          s -= rowI[m] * rowJ[m];
+        }
+
+        rowI[j] = s / d;
+      }
+    }
+
+#pragma omp parallel
+    {
+      // panel below the diagonal block: L21 = A21 * L11^{-T}
+#pragma omp for schedule(static)
+      for (size_t i = kEnd; i < n; i++) {
+        double* rowI = a + i * n;
+
+        for (size_t j = k; j < kEnd; j++) {
+          const double* rowJ = a + j * n;
+          double s = rowI[j];
+
+          for (size_t m = k; m < j; m++) {
+            s -= rowI[m] * rowJ[m];
+          }
+
+          rowI[j] = s / rowJ[j];
+        }
+      }
+
+      // trailing lower triangle: A22 -= L21 * L21^T, processed in tiles of blockSize x blockSize
+#pragma omp for schedule(dynamic)
+      for (size_t ib = kEnd; ib < n; ib += blockSize) {
+        const size_t iEnd = std::min(ib + blockSize, n);
+
+        for (size_t jb = kEnd; jb < iEnd; jb += blockSize) {
+          for (size_t i = ib; i < iEnd; i++) {
+            double* rowI = a + i * n;
+            const size_t jEnd = std::min(jb + blockSize, i + 1);
+
+            for (size_t j = jb; j < jEnd; j++) {
+              const double* rowJ = a + j * n;
+              double s = 0.0;
+
+              for (size_t m = k; m < kEnd; m++) {
+                s += rowI[m] * rowJ[m];
+              }
+
+              rowI[j] -= s;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // isolate the lower triangular matrix
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    std::fill(a + i * n + i + 1, a + (i + 1) * n, 0.0);
+  }
+}
+
+void DBMatParallelDecomposition::choleskyUpdate(DataMatrix& factor, const DataMatrix& updates,
+                                                size_t blockSize) {
+  const size_t n = factor.getNrows();
+  const size_t k = updates.getNcols();
+
+  if ((factor.getNcols() != n) || (updates.getNrows() != n)) {
+    throw algorithm_exception(
+        "DBMatParallelDecomposition::choleskyUpdate : sizes of factor and updates do not match");
+  }
+
+  if ((n == 0) || (k == 0)) {
+    return;
+  }
+
+  blockSize = std::max(blockSize, size_t(1));
+  double* l = factor.getPointer();
+  // row i contains the entries i of the update vectors, which are eliminated column by column
+  DataMatrix work(updates);
+  double* x = work.getPointer();
+  // Givens rotations (cosine, sine) of column j for update vector m are stored at j * k + m
+  std::vector<double> cosines(n * k, 1.0);
+  std::vector<double> sines(n * k, 0.0);
+
+  // applies the rotations of column j to row i of L and of the update vectors
+  auto rotate = [&](size_t i, size_t j) {
+    const double* c = &cosines[j * k];
+    const double* s = &sines[j * k];
+    double* xi = x + i * k;
+    double lij = l[i * n + j];
+
+    for (size_t m = 0; m < k; m++) {
+      const double t = c[m] * lij + s[m] * xi[m];
+      xi[m] = c[m] * xi[m] - s[m] * lij;
+      lij = t;
+    }
+
+    l[i * n + j] = lij;
+  };
+
+  for (size_t b = 0; b < n; b += blockSize) {
+    const size_t bEnd = std::min(b + blockSize, n);
+
+    // diagonal block: determine the rotations of the columns b, ..., bEnd - 1
+    for (size_t i = b; i < bEnd; i++) {
+      for (size_t j = b; j < i; j++) {
+        rotate(i, j);
+      }
+
+      double* xi = x + i * k;
+      double d = l[i * n + i];
+
+      for (size_t m = 0; m < k; m++) {
+        if (xi[m] == 0.0) {
+          continue;
+        }
+
+        const double r = std::sqrt(d * d + xi[m] * xi[m]);
+        cosines[i * k + m] = d / r;
+        sines[i * k + m] = xi[m] / r;
+        d = r;
+        xi[m] = 0.0;
+      }
+
+      if (!(d > 0.0)) {
+        throw algorithm_exception(
+            "DBMatParallelDecomposition::choleskyUpdate : matrix is not positive definite");
+      }
+
+      l[i * n + i] = d;
+    }
+
+    // rows below the diagonal block
+#pragma omp parallel for schedule(static)
+    for (size_t i = bEnd; i < n; i++) {
+      for (size_t j = b; j < bEnd; j++) {
+        rotate(i, j);
+      }
+    }
+  }
+}
+
+void DBMatParallelDecomposition::choleskyAppendRows(DataMatrix& factor, size_t size,
+                                                    const DataMatrix& newRows, size_t blockSize) {
+  const size_t n = factor.getNrows();
+  const size_t k = newRows.getNrows();
+
+  if ((factor.getNcols() != n) || (size + k > n) || (newRows.getNcols() != size + k)) {
+    throw algorithm_exception(
+        "DBMatParallelDecomposition::choleskyAppendRows : sizes of factor and rows do not match");
+  }
+
+  if (k == 0) {
+    return;
+  }
+
+  blockSize = std::max(blockSize, size_t(1));
+  const double* l = factor.getPointer();
+  const double* a = newRows.getPointer();
+  const size_t aCols = newRows.getNcols();
+
+  // L21 = A21 * L11^{-T}, i.e., forward substitution with L11 for the k rows of A21 at once
+  DataMatrix l21(k, size);
+  double* y = l21.getPointer();
+
+  for (size_t m = 0; m < k; m++) {
+    std::copy(a + m * aCols, a + m * aCols + size, y + m * size);
+  }
+
+  for (size_t b = 0; b < size; b += blockSize) {
+    const size_t bEnd = std::min(b + blockSize, size);
+    const size_t blockRows = bEnd - b;
+
+    // contributions of the columns that are already solved (four rows of L21 at a time,
+    // consecutive iterations share the row of L11)
+    const size_t groups = (k + 3) / 4;
+
+#pragma omp parallel for schedule(static)
+    for (size_t t = 0; t < blockRows * groups; t++) {
+      const size_t i = b + t / groups;
+      const size_t m = 4 * (t % groups);
+      const size_t count = std::min(k - m, size_t(4));
+      double s[4];
+      dotProducts(l + i * n, y + m * size, size, count, b, s);
+
+      for (size_t q = 0; q < count; q++) {
+        y[(m + q) * size + i] -= s[q];
+      }
+    }
+
+    // triangular solve with the diagonal block
+#pragma omp parallel for schedule(static)
+    for (size_t m = 0; m < k; m++) {
+      double* ym = y + m * size;
+
+      for (size_t i = b; i < bEnd; i++) {
+        const double* rowI = l + i * n;
+        double s = ym[i];
+
+        for (size_t j = b; j < i; j++) {
+          s -= rowI[j] * ym[j];
+        }
+
+        ym[i] = s / rowI[i];
+      }
+    }
+  }
+
+  // L22 = chol(A22 - L21 * L21^T)
+  DataMatrix l22(k, k);
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t m = 0; m < k; m++) {
+    const double* ym = y + m * size;
+
+    for (size_t q = 0; q <= m; q += 4) {
+      const size_t count = std::min(m + 1 - q, size_t(4));
+      double s[4];
+      dotProducts(ym, y + q * size, size, count, size, s);
+
+      for (size_t p = 0; p < count; p++) {
+        l22.set(m, q + p, a[m * aCols + size + q + p] - s[p]);
+      }
+    }
+  }
+
+  cholesky(l22, blockSize);
+
+  for (size_t m = 0; m < k; m++) {
+    double* row = factor.getPointer() + (size + m) * n;
+    std::copy(y + m * size, y + (m + 1) * size, row);
+    std::copy(l22.getPointer() + m * k, l22.getPointer() + (m + 1) * k, row + size);
+    std::fill(row + size + k, row + n, 0.0);
+  }
+}
+
+int DBMatParallelDecomposition::lu(DataMatrix& matrix, std::vector<size_t>& permutation,
+                                   size_t blockSize) {
+  const size_t n = matrix.getNrows();
+
+  if (matrix.getNcols() != n) {
+    throw algorithm_exception("DBMatParallelDecomposition::lu : matrix is not square");
+  }
+
+  blockSize = std::max(blockSize, size_t(1));
+  double* a = matrix.getPointer();
+  int signum = 1;
+
+  permutation.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    permutation[i] = i;
+  }
+
+  for (size_t k = 0; k < n; k += blockSize) {
+    const size_t kEnd = std::min(k + blockSize, n);
+
+    // factorize the panel (columns k, ..., kEnd - 1) with partial pivoting
+    for (size_t j = k; j < kEnd; j++) {
+      size_t pivotRow = j;
+      double pivotAbs = std::abs(a[j * n + j]);
+
+      for (size_t i = j + 1; i < n; i++) {
+        if (std::abs(a[i * n + j]) > pivotAbs) {
+          pivotRow = i;
+          pivotAbs = std::abs(a[i * n + j]);
+        }
+      }
+
+      if (pivotRow != j) {
+        std::swap_ranges(a + j * n, a + (j + 1) * n, a + pivotRow * n);
+        std::swap(permutation[j], permutation[pivotRow]);
+        signum = -signum;
+      }
+
+      const double* rowJ = a + j * n;
+      const double pivot = rowJ[j];
+
+      if (pivot == 0.0) {
+        continue;
+      }
+
+#pragma omp parallel for schedule(static)
+      for (size_t i = j + 1; i < n; i++) {
+        double* rowI = a + i * n;
+        const double l = rowI[j] / pivot;
+        rowI[j] = l;
+
+        for (size_t c = j + 1; c < kEnd; c++) {
+          rowI[c] -= l * rowJ[c];
+        }
+      }
+    }
+
+#pragma omp parallel
+    {
+      // block row right of the panel: U12 = L11^{-1} * A12, processed in column tiles
+#pragma omp for schedule(static)
+      for (size_t cb = kEnd; cb < n; cb += blockSize) {
+        const size_t cEnd = std::min(cb + blockSize, n);
+
+        for (size_t r = k + 1; r < kEnd; r++) {
+          double* rowR = a + r * n;
+
+          for (size_t m = k; m < r; m++) {
+            const double l = rowR[m];
+            const double* rowM = a + m * n;
+
+            for (size_t c = cb; c < cEnd; c++) {
+              rowR[c] -= l * rowM[c];
+            }
+          }
+        }
+      }
+
+      // trailing matrix: A22 -= L21 * U12, processed in tiles of blockSize x blockSize
+#pragma omp for schedule(dynamic)
+      for (size_t ib = kEnd; ib < n; ib += blockSize) {
+        const size_t iEnd = std::min(ib + blockSize, n);
+
+        for (size_t cb = kEnd; cb < n; cb += blockSize) {
+          const size_t cEnd = std::min(cb + blockSize, n);
+
+          for (size_t i = ib; i < iEnd; i++) {
+            double* rowI = a + i * n;
+
+            for (size_t m = k; m < kEnd; m++) {
+              const double l = rowI[m];
+              const double* rowM = a + m * n;
+
+              for (size_t c = cb; c < cEnd; c++) {
+                rowI[c] -= l * rowM[c];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return signum;
+}
+
+void DBMatParallelDecomposition::tridiagonalize(DataMatrix& matrix, DataMatrix& q,
+                                                DataVector& diag, DataVector& subdiag) {
+  const size_t n = matrix.getNrows();
+
+  if (matrix.getNcols() != n) {
+    throw algorithm_exception("DBMatParallelDecomposition::tridiagonalize : matrix is not square");
+  }
+
+  q.resizeZero(n, n);
+  q.setAll(0.0);
+  diag.resizeZero(n);
+  subdiag.resizeZero((n > 0) ? (n - 1) : 0);
+
+  if (n == 0) {
+    return;
+  }
+
+  double* a = matrix.getPointer();
+  // Householder reflections H_k = I - beta_k * v_k * v_k^T, the vectors v_k (n - k - 1 entries)
+  // are stored below the subdiagonal in column k of the matrix; only the lower triangle of the
+  // trailing matrix is read and updated
+  std::vector<double> betas(n, 0.0);
+  std::vector<double> x(n);
+  std::vector<double> v(n);
+  std::vector<double> p(n);
+  std::vector<double> vNext(n);
+  std::vector<double> pNext(n);
+  double beta = 0.0;
+  double alpha = 0.0;
+  // true if v, beta, alpha and p = beta * A22 * v of the current step have been computed during
+  // the update of the previous step
+  bool havePrecomputedStep = false;
+
+  for (size_t k = 0; k + 2 < n; k++) {
+    const size_t m = n - k - 1;
+    double* a22 = a + (k + 1) * n + (k + 1);
+
+    if (!havePrecomputedStep) {
+      for (size_t i = 0; i < m; i++) {
+        x[i] = a[(k + 1 + i) * n + k];
+      }
+
+      if (!householderVector(x.data(), m, v, beta, alpha)) {
+        // the column is already reduced
+        subdiag[k] = alpha;
+        continue;
+      }
+
+      symmetricProduct(a22, n, m, v.data(), beta, p.data());
+    }
+
+    betas[k] = beta;
+    subdiag[k] = alpha;
+
+    // w = p - (beta / 2) * (p^T v) * v (stored in p)
+    double vp = 0.0;
+
+    for (size_t i = 0; i < m; i++) {
+      vp += p[i] * v[i];
+    }
+
+    const double factor = 0.5 * beta * vp;
+
+    for (size_t i = 0; i < m; i++) {
+      p[i] -= factor * v[i];
+    }
+
+    // A22 -= v * w^T + w * v^T, starting with the first column, which is reduced in the next step
+    for (size_t i = 0; i < m; i++) {
+      a22[i * n] -= v[i] * p[0] + p[i] * v[0];
+      x[i] = a22[i * n];
+    }
+
+    double betaNext = 0.0;
+    double alphaNext = 0.0;
+    const bool fuse =
+        (k + 3 < n) && householderVector(x.data() + 1, m - 1, vNext, betaNext, alphaNext);
+
+    if (fuse) {
+      std::fill(pNext.begin(), pNext.begin() + (m - 1), 0.0);
+    }
+
+    // update the remaining columns; if possible, compute the product of the next step on the fly
+    // while the rows are in cache
+#pragma omp parallel
+    {
+      std::vector<double> partialProduct(fuse ? (m - 1) : 0, 0.0);
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t i = 1; i < m; i++) {
+        double* row = a22 + i * n;
+        const double vi = v[i];
+        const double wi = p[i];
+
+        if (fuse) {
+          const double vNextI = vNext[i - 1];
+          double s = 0.0;
+
+          for (size_t j = 1; j < i; j++) {
+            const double aij = row[j] - (vi * p[j] + wi * v[j]);
+            row[j] = aij;
+            s += aij * vNext[j - 1];
+            partialProduct[j - 1] += aij * vNextI;
+          }
+
+          row[i] -= 2.0 * vi * wi;
+          partialProduct[i - 1] += s + row[i] * vNextI;
+        } else {
+          for (size_t j = 1; j <= i; j++) {
+            row[j] -= vi * p[j] + wi * v[j];
+          }
+        }
+      }
+
+      if (fuse) {
+#pragma omp critical
+        {
+          for (size_t i = 0; i + 1 < m; i++) {
+            pNext[i] += betaNext * partialProduct[i];
+          }
+        }
+      }
+    }
+
+    for (size_t i = 0; i < m; i++) {
+      a[(k + 1 + i) * n + k] = v[i];
+    }
+
+    havePrecomputedStep = fuse;
+
+    if (fuse) {
+      std::swap(v, vNext);
+      std::swap(p, pNext);
+      beta = betaNext;
+      alpha = alphaNext;
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    diag[i] = a[i * n + i];
+  }
+
+  if (n >= 2) {
+    subdiag[n - 2] = a[(n - 1) * n + (n - 2)];
+  }
+
+  // accumulate Q = H_0 * H_1 * ... * H_{n-3} backwards in groups of reflections, using the
+  // compact WY representation H_k0 * ... * H_{k1-1} = I - V * T * V^T of each group
+  double* qData = q.getPointer();
+
+  for (size_t i = 0; i < n; i++) {
+    qData[i * n + i] = 1.0;
+  }
+
+  const size_t groupSize = defaultBlockSize;
+  const size_t numReflections = (n >= 3) ? (n - 2) : 0;
+  std::vector<double> vGroup;
+  std::vector<double> tGroup;
+  std::vector<double> wGroup;
+  std::vector<double> temp(groupSize);
+
+  for (size_t k1 = numReflections; k1 > 0;) {
+    const size_t k0 = (k1 > groupSize) ? (k1 - groupSize) : 0;
+    const size_t b = k1 - k0;
+    // the group acts on rows/columns k0 + 1, ..., n - 1
+    const size_t m = n - k0 - 1;
+
+    // V (m x b), column j contains v_{k0 + j} starting at row j
+    vGroup.assign(m * b, 0.0);
+
+    for (size_t j = 0; j < b; j++) {
+      const size_t k = k0 + j;
+
+      if (betas[k] != 0.0) {
+        for (size_t i = 0; i < n - k - 1; i++) {
+          vGroup[(i + j) * b + j] = a[(k + 1 + i) * n + k];
+        }
+      }
+    }
+
+    // upper triangular T (b x b) with T(0:j, j) = -beta_j * T(0:j, 0:j) * V(:, 0:j)^T * v_j
+    tGroup.assign(b * b, 0.0);
+
+    for (size_t j = 0; j < b; j++) {
+      const double betaJ = betas[k0 + j];
+      tGroup[j * b + j] = betaJ;
+
+      for (size_t i = 0; i < j; i++) {
+        double s = 0.0;
+
+        for (size_t r = j; r < m; r++) {
+          s += vGroup[r * b + i] * vGroup[r * b + j];
+        }
+
+        temp[i] = s;
+      }
+
+      for (size_t i = 0; i < j; i++) {
+        double s = 0.0;
+
+        for (size_t l = i; l < j; l++) {
+          s += tGroup[i * b + l] * temp[l];
+        }
+
+        tGroup[i * b + j] = -betaJ * s;
+      }
+    }
+
+    double* q22 = qData + (k0 + 1) * n + (k0 + 1);
+    wGroup.assign(b * m, 0.0);
+
+#pragma omp parallel
+    {
+      std::vector<double> column(b);
+
+      // W = T * (V^T * Q22) (b x m), processed in column tiles
+#pragma omp for schedule(static)
+      for (size_t cb = 0; cb < m; cb += groupSize) {
+        const size_t cEnd = std::min(cb + groupSize, m);
+
+        for (size_t i = 0; i < m; i++) {
+          const double* row = q22 + i * n;
+
+          for (size_t j = 0; j < b; j++) {
+            const double vij = vGroup[i * b + j];
+
+            if (vij != 0.0) {
+              double* wRow = &wGroup[j * m];
+
+              for (size_t c = cb; c < cEnd; c++) {
+                wRow[c] += vij * row[c];
+              }
+            }
+          }
+        }
+
+        for (size_t c = cb; c < cEnd; c++) {
+          for (size_t i = 0; i < b; i++) {
+            double s = 0.0;
+
+            for (size_t l = i; l < b; l++) {
+              s += tGroup[i * b + l] * wGroup[l * m + c];
+            }
+
+            column[i] = s;
+          }
+
+          for (size_t i = 0; i < b; i++) {
+            wGroup[i * m + c] = column[i];
+          }
+        }
+      }
+
+      // Q22 -= V * W
+#pragma omp for schedule(static)
+      for (size_t i = 0; i < m; i++) {
+        double* row = q22 + i * n;
+
+        for (size_t j = 0; j < b; j++) {
+          const double vij = vGroup[i * b + j];
+
+          if (vij != 0.0) {
+            const double* wRow = &wGroup[j * m];
+
+            for (size_t c = 0; c < m; c++) {
+              row[c] -= vij * wRow[c];
+            }
+          }
+        }
+      }
+    }
+
+    k1 = k0;
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
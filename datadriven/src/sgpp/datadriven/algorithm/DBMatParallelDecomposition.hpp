@@ -0,0 +1,113 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * DBMatParallelDecomposition.hpp
+ */
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+/**
+ * Cache-blocked, OpenMP-parallel dense matrix decompositions on DataMatrix objects that can be
+ * used by the offline objects instead of the sequential GSL routines. The output formats match
+ * the ones of the corresponding GSL routines, so the online objects work with both variants.
+ */
+class DBMatParallelDecomposition {
+ public:
+  /**
+   * Default block size (number of columns of a panel)
+   */
+  static const size_t defaultBlockSize = 64;
+
+  /**
+   * In-place Cholesky decomposition A = L * L^T of a symmetric positive definite matrix
+   * (right-looking, blocked). Only the lower triangle of A is read. On return, matrix contains L
+   * and its strict upper triangle is set to zero.
+   *
+   * @param matrix the symmetric positive definite matrix, overwritten by L
+   * @param blockSize number of columns of a panel
+   * @throws algorithm_exception if the matrix is not square or not positive definite
+   */
+  static void cholesky(DataMatrix& matrix, size_t blockSize = defaultBlockSize);
+
+  /**
+   * Rank-k update of a Cholesky factor: overwrites L by the Cholesky factor of
+   * L * L^T + V * V^T. Equivalent to k rank-one updates with Givens rotations
+   * (DBMatDMSChol::choleskyUpdate), but all k updates are applied in a single pass over L: the
+   * rotations of a block of columns are computed sequentially and then applied to all rows below
+   * the block in parallel.
+   *
+   * @param factor the lower triangular factor L
+   * @param updates the update vectors as columns of V (the number of rows equals the size of L)
+   * @param blockSize number of columns of a block
+   * @throws algorithm_exception if the sizes do not match or the factor is singular
+   */
+  static void choleskyUpdate(DataMatrix& factor, const DataMatrix& updates,
+                             size_t blockSize = defaultBlockSize);
+
+  /**
+   * Appends k rows to a Cholesky factor, i.e., computes the factor of the matrix A extended by
+   * k rows and columns. Equivalent to adding one row at a time (with a triangular solve each), but
+   * L21 = A21 * L11^{-T} is computed for all k rows in one blocked forward substitution, followed
+   * by the Cholesky decomposition of the Schur complement A22 - L21 * L21^T.
+   *
+   * @param factor matrix with at least size + k rows and columns, whose leading size x size block
+   * contains the factor L11 of A11; the rows size, ..., size + k - 1 are overwritten by
+   * [L21 L22 0]
+   * @param size size of L11
+   * @param newRows the rows [A21 A22] of the extended matrix (k x (size + k)), only the lower
+   * triangle of A22 is read
+   * @param blockSize number of columns of a block
+   * @throws algorithm_exception if the sizes do not match or the extended matrix is not positive
+   * definite
+   */
+  static void choleskyAppendRows(DataMatrix& factor, size_t size, const DataMatrix& newRows,
+                                 size_t blockSize = defaultBlockSize);
+
+  /**
+   * In-place LU decomposition P * A = L * U with partial pivoting (right-looking, blocked).
+   * On return, the strict lower triangle of matrix contains L (unit diagonal) and the upper
+   * triangle contains U. Row i of P * A is row permutation[i] of A, which is the format of
+   * gsl_linalg_LU_decomp. Singular matrices are decomposed without error (U has a zero on the
+   * diagonal).
+   *
+   * @param matrix the matrix, overwritten by L and U
+   * @param permutation the row permutation, resized to the number of rows
+   * @param blockSize number of columns of a panel
+   * @return the sign of the permutation (+1 or -1)
+   * @throws algorithm_exception if the matrix is not square
+   */
+  static int lu(DataMatrix& matrix, std::vector<size_t>& permutation,
+                size_t blockSize = defaultBlockSize);
+
+  /**
+   * Householder tridiagonalization A = Q * T * Q^T of a symmetric matrix. The symmetric rank-2
+   * update of the trailing matrix is fused with the matrix-vector product of the next step and
+   * parallelized over the rows, Q is accumulated blockwise. Only the lower triangle of A is read.
+   * Corresponds to gsl_linalg_symmtd_decomp followed by gsl_linalg_symmtd_unpack (the signs of
+   * the subdiagonal entries and of the columns of Q may differ).
+   *
+   * @param matrix the symmetric matrix, destroyed during the decomposition
+   * @param q the orthogonal matrix Q, resized to the size of matrix
+   * @param diag the diagonal of T, resized to the size of matrix
+   * @param subdiag the subdiagonal of T, resized to the size of matrix minus one
+   * @throws algorithm_exception if the matrix is not square
+   */
+  static void tridiagonalize(DataMatrix& matrix, DataMatrix& q, DataVector& diag,
+                             DataVector& subdiag);
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -9,6 +9,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/base/tools/ScratchWorkspace.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -35,6 +36,8 @@ class DMSystemMatrixBase : public base::OperationMatrix {
   double computeTimeMultTrans_;
   /// Stopwatch needed to determine the durations of mult and mult transposed
   base::SGppStopwatch* myTimer_;
+  /// temporary vectors of mult, kept between the iterations of the solver
+  base::ScratchWorkspace workspace_;
 
  public:
   /**
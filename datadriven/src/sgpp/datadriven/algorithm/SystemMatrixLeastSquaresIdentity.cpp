@@ -30,7 +30,7 @@ SystemMatrixLeastSquaresIdentity::SystemMatrixLeastSquaresIdentity(base::Grid& g
 SystemMatrixLeastSquaresIdentity::~SystemMatrixLeastSquaresIdentity() {}
 
 void SystemMatrixLeastSquaresIdentity::mult(base::DataVector& alpha, base::DataVector& result) {
-  base::DataVector temp(this->paddedInstances);
+  base::DataVector& temp = this->workspace_.getVector(0, this->paddedInstances);
 
   // Operation B
   this->myTimer_->start();
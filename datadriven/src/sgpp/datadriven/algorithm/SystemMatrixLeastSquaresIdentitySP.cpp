@@ -0,0 +1,58 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/SystemMatrixLeastSquaresIdentitySP.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace datadriven {
+
+SystemMatrixLeastSquaresIdentitySP::SystemMatrixLeastSquaresIdentitySP(
+    base::Grid& grid, base::DataMatrixSP& trainData, float lambda)
+    : DMSystemMatrixBaseSP(trainData, lambda), instances(trainData.getNrows()), grid(grid) {
+  this->implementationConfiguration.setPrecision(OperationMultipleEvalPrecision::MIXED);
+  this->B.reset(op_factory::createOperationMultipleEvalSP(grid, *this->dataset_,
+                                                          this->implementationConfiguration));
+}
+
+SystemMatrixLeastSquaresIdentitySP::~SystemMatrixLeastSquaresIdentitySP() {}
+
+void SystemMatrixLeastSquaresIdentitySP::mult(base::DataVectorSP& alpha,
+                                              base::DataVectorSP& result) {
+  base::DataVectorSP temp(this->instances);
+
+  // Operation B
+  this->myTimer_->start();
+  this->B->mult(alpha, temp);
+  this->completeTimeMult_ += this->myTimer_->stop();
+  this->computeTimeMult_ += this->B->getDuration();
+
+  this->myTimer_->start();
+  this->B->multTranspose(temp, result);
+  this->completeTimeMultTrans_ += this->myTimer_->stop();
+  this->computeTimeMultTrans_ += this->B->getDuration();
+
+  result.axpy(static_cast<float>(this->instances) * this->lambda_, alpha);
+}
+
+void SystemMatrixLeastSquaresIdentitySP::generateb(base::DataVectorSP& classes,
+                                                   base::DataVectorSP& b) {
+  this->myTimer_->start();
+  this->B->multTranspose(classes, b);
+  this->completeTimeMultTrans_ += this->myTimer_->stop();
+  this->computeTimeMultTrans_ += this->B->getDuration();
+}
+
+void SystemMatrixLeastSquaresIdentitySP::setImplementation(
+    datadriven::OperationMultipleEvalConfiguration operationConfiguration) {
+  this->implementationConfiguration = operationConfiguration;
+  this->B.reset(op_factory::createOperationMultipleEvalSP(this->grid, *this->dataset_,
+                                                          this->implementationConfiguration));
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,70 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SYSTEMMATRIXLEASTSQUARESIDENTITYSP_HPP
+#define SYSTEMMATRIXLEASTSQUARESIDENTITYSP_HPP
+
+#include <sgpp/base/datatypes/DataMatrixSP.hpp>
+#include <sgpp/base/datatypes/DataVectorSP.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalSP.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrixBaseSP.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Single precision version of SystemMatrixLeastSquaresIdentity, i.e.,
+ * the system matrix @f$B B^T + M \lambda I@f$ of the least squares regression
+ * with the identity matrix as regularization operator.
+ *
+ * The operation B is evaluated on the CPU by an OperationMultipleEvalSP,
+ * whose accumulation precision is chosen via the
+ * OperationMultipleEvalConfiguration (see OperationMultipleEvalPrecision).
+ */
+class SystemMatrixLeastSquaresIdentitySP : public datadriven::DMSystemMatrixBaseSP {
+ private:
+  /// Number of training instances
+  size_t instances;
+  /// OperationB for calculating the data matrix
+  std::unique_ptr<base::OperationMultipleEvalSP> B;
+
+  base::Grid& grid;
+
+  datadriven::OperationMultipleEvalConfiguration implementationConfiguration;
+
+ public:
+  /**
+   * Std-Constructor, the multi-evaluation uses OperationMultipleEvalPrecision::MIXED
+   * until another configuration is set with setImplementation
+   *
+   * @param SparseGrid reference to the sparse grid
+   * @param trainData reference to base::DataMatrixSP that contains the training data
+   * @param lambda the lambda, the regression parameter
+   */
+  SystemMatrixLeastSquaresIdentitySP(base::Grid& SparseGrid, base::DataMatrixSP& trainData,
+                                     float lambda);
+
+  /**
+   * Std-Destructor
+   */
+  virtual ~SystemMatrixLeastSquaresIdentitySP();
+
+  virtual void mult(base::DataVectorSP& alpha, base::DataVectorSP& result);
+
+  virtual void generateb(base::DataVectorSP& classes, base::DataVectorSP& b);
+
+  void setImplementation(datadriven::OperationMultipleEvalConfiguration operationConfiguration);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* SYSTEMMATRIXLEASTSQUARESIDENTITYSP_HPP */
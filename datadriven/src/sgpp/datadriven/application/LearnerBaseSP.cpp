@@ -7,6 +7,7 @@
 #include <sgpp/base/grid/type/ModLinearGrid.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalSP.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
@@ -23,6 +24,7 @@
 #include <sgpp/base/grid/type/LinearBoundaryGrid.hpp>
 
 #include <iostream>
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -323,6 +325,15 @@ LearnerTiming LearnerBaseSP::train(sgpp::base::DataMatrixSP& trainDataset,
 sgpp::base::DataVectorSP LearnerBaseSP::predict(sgpp::base::DataMatrixSP& testDataset) {
   sgpp::base::DataVectorSP classesComputed(testDataset.getNrows());
 
+  if ((grid_->getType() == sgpp::base::GridType::Linear) ||
+      (grid_->getType() == sgpp::base::GridType::ModLinear)) {
+    // evaluate directly in single precision (with double precision accumulation)
+    std::unique_ptr<sgpp::base::OperationMultipleEvalSP> MultEval(
+        sgpp::op_factory::createOperationMultipleEvalSP(*grid_, testDataset, true));
+    MultEval->mult(*alpha_, classesComputed);
+    return classesComputed;
+  }
+
   sgpp::base::DataVector classesComputedDP(testDataset.getNrows());
   sgpp::base::DataVector alphaDP(grid_->getSize());
   sgpp::base::DataMatrix testDatasetDP(testDataset.getNrows(), testDataset.getNcols());
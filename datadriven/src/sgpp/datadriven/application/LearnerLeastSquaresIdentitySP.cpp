@@ -0,0 +1,48 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/SystemMatrixLeastSquaresIdentitySP.hpp>
+#include <sgpp/datadriven/application/LearnerLeastSquaresIdentitySP.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+
+namespace sgpp {
+namespace datadriven {
+
+LearnerLeastSquaresIdentitySP::LearnerLeastSquaresIdentitySP(const bool isRegression,
+                                                             const bool isVerbose)
+    : sgpp::datadriven::LearnerBaseSP(isRegression, isVerbose) {
+  this->implementationConfiguration.setPrecision(
+      sgpp::datadriven::OperationMultipleEvalPrecision::MIXED);
+}
+
+LearnerLeastSquaresIdentitySP::~LearnerLeastSquaresIdentitySP() {}
+
+sgpp::datadriven::DMSystemMatrixBaseSP* LearnerLeastSquaresIdentitySP::createDMSystem(
+    sgpp::base::DataMatrixSP& trainDataset, float lambdaRegularization) {
+  sgpp::datadriven::SystemMatrixLeastSquaresIdentitySP* systemMatrix =
+      new sgpp::datadriven::SystemMatrixLeastSquaresIdentitySP(*this->grid_, trainDataset,
+                                                               lambdaRegularization);
+  systemMatrix->setImplementation(this->implementationConfiguration);
+  return systemMatrix;
+}
+
+sgpp::base::DataVectorSP LearnerLeastSquaresIdentitySP::predict(
+    sgpp::base::DataMatrixSP& testDataset) {
+  sgpp::base::DataVectorSP classesComputed(testDataset.getNrows());
+
+  std::unique_ptr<sgpp::base::OperationMultipleEvalSP> MultEval(
+      sgpp::op_factory::createOperationMultipleEvalSP(*this->grid_, testDataset,
+                                                      this->implementationConfiguration));
+  MultEval->mult(*this->alpha_, classesComputed);
+
+  return classesComputed;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
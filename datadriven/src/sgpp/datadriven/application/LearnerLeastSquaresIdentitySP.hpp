@@ -0,0 +1,59 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/application/LearnerBaseSP.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * This class implements standard sparse grid regression
+ * with an Identity matrix as regularization operator
+ * in single (or mixed) precision on the CPU.
+ */
+class LearnerLeastSquaresIdentitySP : public sgpp::datadriven::LearnerBaseSP {
+ private:
+  sgpp::datadriven::OperationMultipleEvalConfiguration implementationConfiguration;
+
+ protected:
+  sgpp::datadriven::DMSystemMatrixBaseSP* createDMSystem(sgpp::base::DataMatrixSP& trainDataset,
+                                                         float lambdaRegularization) override;
+
+ public:
+  /**
+   * Constructor, the multi-evaluation uses OperationMultipleEvalPrecision::MIXED
+   * until another configuration is set with setImplementation
+   *
+   * @param isRegression set to true if a regression task should be executed
+   * @param isVerbose set to true in order to allow console output
+   */
+  explicit LearnerLeastSquaresIdentitySP(const bool isRegression, const bool isVerbose = true);
+
+  /**
+   * Destructor
+   */
+  virtual ~LearnerLeastSquaresIdentitySP();
+
+  sgpp::base::DataVectorSP predict(sgpp::base::DataMatrixSP& testDataset) override;
+
+  /**
+   * Sets the configuration of the multi-evaluation, in particular its precision
+   * (OperationMultipleEvalPrecision::SINGLE or MIXED).
+   *
+   * @param operationConfiguration configuration of the multi-evaluation
+   */
+  void setImplementation(
+      sgpp::datadriven::OperationMultipleEvalConfiguration operationConfiguration) {
+    this->implementationConfiguration = operationConfiguration;
+  }
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
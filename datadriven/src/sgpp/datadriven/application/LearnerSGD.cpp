@@ -147,11 +147,13 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
 
   // counts total number of processed data points
   size_t processedPoints = 0;
+  // current training sample (reused for all samples)
+  sgpp::base::DataVector x(dim);
+  sgpp::base::DataVector singleAlpha(1, 1.0);
   // main loop which performs the learning process
   while (cntDataPasses < maxDataPasses) {
     for (size_t currIt = 0; currIt < trainData.getNrows(); currIt++) {
       // get next training sample x and its label y
-      sgpp::base::DataVector x(dim);
       trainData.getRow(currIt, x);
       double y = trainLabels.get(currIt);
 
@@ -164,9 +166,6 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
 
       sgpp::base::DataVector delta(alpha.getSize());
 
-      sgpp::base::DataVector singleAlpha(1);
-      singleAlpha[0] = 1.0;
-
       // perform SGD step
       sgpp::base::DataMatrix dm(x.getPointer(), 1, x.getSize());
       std::unique_ptr<base::OperationMultipleEval> multEval(
@@ -309,8 +308,7 @@ void LearnerSGD::storeResults(base::DataMatrix& testDataset) {
     std::cout << "failed to create csv file!" << std::endl;
   } else {
     for (size_t i = 0; i < predictedLabels.getSize(); i++) {
-      base::DataVector x(2);
-      testDataset.getRow((size_t)i, x);
+      base::ConstDataVectorView x = testDataset.getRowView(i);
       output << x[0] << ";" << x[1] << ";" << predictedLabels[i] << std::endl;
     }
     output.close();
@@ -358,10 +356,7 @@ void LearnerSGD::storeResults(base::DataMatrix& testDataset) {
   std::unique_ptr<base::OperationEval> opEval(
       op_factory::createOperationEval(*grid));
   for (size_t i = 0; i < values.getNrows(); i++) {
-    // get next test sample x
-    base::DataVector x(2);
-    values.getRow(i, x);
-    double res = opEval->eval(alphaAvg, x);
+    double res = opEval->eval(alphaAvg, values.getRowView(i));
     output << res << ";" << std::endl;
   }
   output.close();
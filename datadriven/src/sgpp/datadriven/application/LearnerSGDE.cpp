@@ -749,8 +749,7 @@ void LearnerSGDE::storeResults(base::DataMatrix& testDataset) {
     std::cout << "failed to create csv file!" << std::endl;
   } else {
     for (size_t i = 0; i < predictedLabels.getSize(); i++) {
-      base::DataVector x(2);
-      testDataset.getRow((size_t)i, x);
+      base::ConstDataVectorView x = testDataset.getRowView(i);
       output << x[0] << ";" << x[1] << ";" << predictedLabels[i] << std::endl;
     }
     output.close();
@@ -818,10 +817,7 @@ void LearnerSGDE::storeResults(base::DataMatrix& testDataset) {
     output.open("SGDE_density_fun_" + std::to_string(g.first) + "_evals.csv");
     std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(*g.second));
     for (size_t i = 0; i < values.getNrows(); i++) {
-      // Get next test sample x
-      base::DataVector x(2);
-      values.getRow(i, x);
-      double res = opEval->eval(*alphas.at(g.first), x);
+      double res = opEval->eval(*alphas.at(g.first), values.getRowView(i));
       output << res << ";" << std::endl;
     }
     output.close();
@@ -859,14 +855,12 @@ double LearnerSGDE::getAccuracy(const base::DataVector& referenceLabels, const d
 
 void LearnerSGDE::predict(base::DataMatrix& testData, base::DataVector& predictedLabels) {
   predictedLabels.resize(testData.getNrows());
-  size_t dim = testData.getNcols();
 
   double prior;
 
   for (size_t i = 0; i < testData.getNrows(); i++) {
     // get next test sample x
-    base::DataVector x(dim);
-    testData.getRow((size_t)i, x);
+    base::ConstDataVectorView x = testData.getRowView(i);
     // predict label using Bayes’ Theorem
     double max = std::numeric_limits<double>::max() * (-1);
     int predLabel = 0;
@@ -28,6 +28,10 @@ struct CrossvalidationConfiguration {
   int seed_;      // seed for randomized k-fold
   bool shuffle_;  // randomized/sequential k-fold
   bool silent_;   // verbosity
+  // number of folds that are trained concurrently (one thread per fold)
+  size_t parallelFolds_ = 1;
+  // threads of the operations within one fold (0: split the threads evenly among the folds)
+  size_t threadsPerFold_ = 0;
 
   // regularization parameter optimization
   double lambda_;       // regularization parameter
@@ -35,6 +35,11 @@ struct DensityEstimationConfiguration {
   size_t iCholSweepsRefine_ = 4;
   size_t iCholSweepsUpdateLambda_ = 2;
   size_t iCholSweepsSolver_ = 2;
+
+  // Use the blocked, OpenMP-parallel decompositions (DBMatParallelDecomposition) instead of the
+  // sequential GSL routines for Chol, LU and OrthoAdapt, and apply the Cholesky modifications of
+  // a refinement/coarsening step as one batch instead of one grid point at a time
+  bool parallelDecomposition_ = false;
 };
 
 }  // namespace datadriven
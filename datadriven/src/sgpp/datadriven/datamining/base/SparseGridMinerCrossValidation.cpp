@@ -15,6 +15,13 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
 #include <iostream>
 #include <vector>
 
@@ -26,6 +33,19 @@ SparseGridMinerCrossValidation::SparseGridMinerCrossValidation(
     ModelFittingBase* fitter, Scorer* scorer) : SparseGridMiner(fitter, scorer),
         dataSource{dataSource} {}
 
+SparseGridMinerCrossValidation::SparseGridMinerCrossValidation(
+    DataSourceCrossValidation* dataSource, std::vector<ModelFittingBase*> fitters,
+    std::vector<Scorer*> scorers)
+    : SparseGridMiner(fitters.at(0), scorers.at(0)), dataSource{dataSource} {
+  for (size_t k = 1; k < fitters.size(); k++) {
+    foldFitters.emplace_back(fitters[k]);
+  }
+
+  for (size_t k = 1; k < scorers.size(); k++) {
+    foldScorers.emplace_back(scorers[k]);
+  }
+}
+
 double SparseGridMinerCrossValidation::learn(bool verbose) {
   // todo(fuchsgdk): see below
 
@@ -35,7 +55,12 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   std::vector<double> scores;
   scores.reserve(crossValidationConfig.kfold_);
 
-  for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
+  if (!foldFitters.empty()) {
+    learnParallel(scores);
+  }
+
+  // train the folds one after another (unless they were trained concurrently)
+  for (size_t fold = scores.size(); fold < crossValidationConfig.kfold_; fold++) {
     dataSource->setFold(fold);
 
     // todo(fuchsgdk):
@@ -114,6 +139,125 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
       << "Standard deviation: " << stdDeviation << std::endl;
   return meanScore;
 }
+
+void SparseGridMinerCrossValidation::fetchFold(size_t fold, FoldData& data) {
+  dataSource->setFold(fold);
+  dataSource->reset();
+  data.validationData.reset(new Dataset(*dataSource->getValidationData()));
+  data.batches.clear();
+
+  while (true) {
+    std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
+
+    if (dataset->getNumberInstances() == 0) {
+      // The source does not provide any more samples
+      break;
+    }
+
+    data.batches.push_back(std::move(dataset));
+  }
+}
+
+double SparseGridMinerCrossValidation::learnFold(ModelFittingBase& foldFitter, Scorer& foldScorer,
+                                                 FoldData& data) {
+  RefinementMonitorFactory monitorFactory;
+  std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+      foldFitter.getFitterConfiguration().getRefinementConfig()));
+
+  foldFitter.reset();
+
+  // every epoch iterates over the same batches, as the data source is reset to the same state
+  for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
+    for (auto& dataset : data.batches) {
+      foldFitter.update(*dataset);
+
+      double scoreTrain = foldScorer.test(foldFitter, *dataset);
+      double scoreVal = foldScorer.test(foldFitter, *data.validationData);
+
+      monitor->pushToBuffer(dataset->getNumberInstances(), scoreVal, scoreTrain);
+      size_t refinements = monitor->refinementsNecessary();
+      while (refinements--) {
+        foldFitter.refine();
+      }
+    }
+  }
+
+  return foldScorer.test(foldFitter, *data.validationData);
+}
+
+void SparseGridMinerCrossValidation::learnParallel(std::vector<double>& scores) {
+  const CrossvalidationConfiguration& crossValidationConfig =
+      dataSource->getCrossValidationConfig();
+  const size_t kfold = crossValidationConfig.kfold_;
+
+  std::vector<ModelFittingBase*> fitters{fitter.get()};
+  std::vector<Scorer*> scorers{scorer.get()};
+
+  for (size_t k = 0; k < std::min(foldFitters.size(), foldScorers.size()); k++) {
+    fitters.push_back(foldFitters[k].get());
+    scorers.push_back(foldScorers[k].get());
+  }
+
+  const size_t parallelFolds = std::min(fitters.size(), kfold);
+  size_t threadsPerFold = crossValidationConfig.threadsPerFold_;
+
+#ifdef _OPENMP
+  if (threadsPerFold == 0) {
+    threadsPerFold = std::max(static_cast<size_t>(omp_get_max_threads()) / parallelFolds,
+                              static_cast<size_t>(1));
+  }
+
+  // the operations within the folds run in nested parallel regions
+  const int oldMaxActiveLevels = omp_get_max_active_levels();
+  omp_set_max_active_levels(std::max(oldMaxActiveLevels, 2));
+#endif
+
+  std::cout << "###############" << "Training " << parallelFolds << " folds concurrently"
+            << std::endl;
+
+  scores.resize(kfold);
+  std::vector<FoldData> data(parallelFolds);
+  std::vector<std::exception_ptr> exceptions(parallelFolds);
+
+  for (size_t firstFold = 0; firstFold < kfold; firstFold += parallelFolds) {
+    const size_t groupSize = std::min(parallelFolds, kfold - firstFold);
+
+    // the data source is stateful, so the data of the folds is fetched one after another in the
+    // same order as for sequential training
+    for (size_t k = 0; k < groupSize; k++) {
+      fetchFold(firstFold + k, data[k]);
+    }
+
+#pragma omp parallel for num_threads(static_cast<int>(groupSize)) schedule(static, 1)
+    for (size_t k = 0; k < groupSize; k++) {
+#ifdef _OPENMP
+      omp_set_num_threads(static_cast<int>(threadsPerFold));
+#endif
+
+      try {
+        scores[firstFold + k] = learnFold(*fitters[k], *scorers[k], data[k]);
+      } catch (...) {
+        exceptions[k] = std::current_exception();
+      }
+    }
+
+    for (size_t k = 0; k < groupSize; k++) {
+      if (exceptions[k]) {
+#ifdef _OPENMP
+        omp_set_max_active_levels(oldMaxActiveLevels);
+#endif
+        std::rethrow_exception(exceptions[k]);
+      }
+
+      std::cout << "###############" << "Fold #" << (firstFold + k) << std::endl
+                << "Score on validation data: " << scores[firstFold + k] << std::endl;
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_max_active_levels(oldMaxActiveLevels);
+#endif
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
 
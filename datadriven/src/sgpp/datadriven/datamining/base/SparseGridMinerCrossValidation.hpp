@@ -16,6 +16,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -41,6 +42,22 @@ class SparseGridMinerCrossValidation : public SparseGridMiner {
   SparseGridMinerCrossValidation(DataSourceCrossValidation* dataSource, ModelFittingBase* fitter,
       Scorer* scorer);
 
+  /**
+   * Constructor for training several folds concurrently. The folds are trained in groups of
+   * fitters.size() folds, each fold of a group on its own thread with its own fitter and scorer.
+   * The remaining threads are used by the operations within the folds, see
+   * CrossvalidationConfiguration::threadsPerFold_. The scores are identical to training the folds
+   * one after another.
+   * @param dataSource configured instance of data source object, that will provide samples to learn
+   * from. The miner instance will take ownership of the passed object.
+   * @param fitters one configured fitter per concurrently trained fold, all configured
+   * identically. The miner instance will take ownership of the passed objects.
+   * @param scorers one configured scorer per concurrently trained fold (same size as fitters). The
+   * miner instance will take ownership of the passed objects.
+   */
+  SparseGridMinerCrossValidation(DataSourceCrossValidation* dataSource,
+      std::vector<ModelFittingBase*> fitters, std::vector<Scorer*> scorers);
+
   /**
    * Copy constructor deleted - not all members can be copied or cloned .
    * @param rhs the object to copy from
@@ -78,11 +95,61 @@ class SparseGridMinerCrossValidation : public SparseGridMiner {
   double learn(bool verbose) override;
 
  private:
+  /**
+   * Training and validation data of one fold, fetched from the data source in advance for
+   * training several folds concurrently.
+   */
+  struct FoldData {
+    /**
+     * Batches of training data in the order provided by the data source
+     */
+    std::vector<std::unique_ptr<Dataset>> batches;
+    /**
+     * Validation data of the fold
+     */
+    std::unique_ptr<Dataset> validationData;
+  };
+
+  /**
+   * Fetches the batches and the validation data of a fold from the data source.
+   * @param fold index of the fold
+   * @param[out] data training and validation data of the fold
+   */
+  void fetchFold(size_t fold, FoldData& data);
+
+  /**
+   * Trains a fitter on the batches of a fold for all epochs (as learn does for a single fold)
+   * and scores the model on the validation data of the fold.
+   * @param foldFitter fitter to train (will be reset)
+   * @param foldScorer scorer to assess the model
+   * @param data training and validation data of the fold
+   * @return score on the validation data
+   */
+  double learnFold(ModelFittingBase& foldFitter, Scorer& foldScorer, FoldData& data);
+
+  /**
+   * Trains all folds in groups of concurrently trained folds.
+   * @param[out] scores scores of the folds on their validation data
+   */
+  void learnParallel(std::vector<double>& scores);
+
   /**
    * DataSource provides samples that will be used by fitter to generalize data and scorer to
    * validate and assess model robustness.
    */
   std::unique_ptr<DataSourceCrossValidation> dataSource;
+
+  /**
+   * Additional fitters for training several folds concurrently (fitter is used for the first
+   * fold of each group).
+   */
+  std::vector<std::unique_ptr<ModelFittingBase>> foldFitters;
+
+  /**
+   * Additional scorers for training several folds concurrently (scorer is used for the first
+   * fold of each group).
+   */
+  std::vector<std::unique_ptr<Scorer>> foldScorers;
 };
 
 } /* namespace datadriven */
@@ -15,11 +15,13 @@
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorFactory.hpp>
 
 #include <algorithm>
@@ -60,6 +62,11 @@ DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withStreaming(bool streaming) {
+  config.streaming = streaming;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
   config.filePath = filePath;
   if (config.fileType == DataSourceFileType::NONE) {
@@ -69,6 +76,19 @@ DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
 }
 
 DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
+  // binary files are memory-mapped and therefore never have to be streamed
+  if (config.streaming && config.fileType != DataSourceFileType::BINARY) {
+    if (config.shuffling != DataSourceShufflingType::sequential) {
+      throw data_exception("Streaming data sources only support sequential shuffling");
+    }
+
+    // the streaming sample provider inflates compressed files itself
+    return new DataSourceSplitting(
+        config, new StreamingFileSampleProvider(config.fileType, config.isCompressed,
+                                                config.streamingChunkSize,
+                                                config.streamingNumBufferedChunks));
+  }
+
   // Create a shuffling functor
   DataShufflingFunctorFactory shufflingFunctorFactory;
   DataShufflingFunctor *shuffling = shufflingFunctorFactory.buildDataShufflingFunctor(config);
@@ -79,11 +99,16 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
     sampleProvider = new ArffFileSampleProvider(shuffling);
   } else if (config.fileType == DataSourceFileType::CSV) {
     sampleProvider = new CSVFileSampleProvider(shuffling);
+  } else if (config.fileType == DataSourceFileType::BINARY) {
+    sampleProvider = new BinaryFileSampleProvider(shuffling);
   } else {
     data_exception("Unknown file type");
   }
 
   if (config.isCompressed) {
+    if (config.fileType == DataSourceFileType::BINARY) {
+      throw data_exception("Compressed binary datasets are not supported");
+    }
 #ifndef ZLIB
     throw sgpp::base::application_exception{
         "sgpp has been built without zlib support. Reading compressed files is not possible"};
@@ -105,6 +130,10 @@ DataSourceSplitting* DataSourceBuilder::splittingFromConfig(const DataSourceConf
 }
 
 DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
+  if (config.streaming) {
+    throw data_exception("Cross validation is not supported for streaming data sources");
+  }
+
   // Create a shuffling functor
   DataShufflingFunctorFactory shufflingFunctorFactory;
   DataShufflingFunctor *shuffling = shufflingFunctorFactory.buildDataShufflingFunctor(config);
@@ -117,11 +146,16 @@ DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
     sampleProvider = new ArffFileSampleProvider(crossValidationShuffling);
   } else if (config.fileType == DataSourceFileType::CSV) {
     sampleProvider = new CSVFileSampleProvider(crossValidationShuffling);
+  } else if (config.fileType == DataSourceFileType::BINARY) {
+    sampleProvider = new BinaryFileSampleProvider(crossValidationShuffling);
   } else {
     data_exception("Unknown file type");
   }
 
   if (config.isCompressed) {
+    if (config.fileType == DataSourceFileType::BINARY) {
+      throw data_exception("Compressed binary datasets are not supported");
+    }
 #ifndef ZLIB
     throw sgpp::base::application_exception{
         "sgpp has been built without zlib support. Reading compressed files is not possible"};
@@ -48,6 +48,15 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withCompression(bool isCompressed);
 
+  /**
+   * Optionally specify that the file should be read in chunks on a background thread instead of
+   * at once (see #sgpp::datadriven::StreamingFileSampleProvider). Streaming data sources only
+   * support sequential shuffling and no cross validation.
+   * @param streaming true if the file should be streamed, false otherwise.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withStreaming(bool streaming);
+
   /**
    * Optionally Specify the file type if files are used. If data source does not use any files,
    * this is set to none by default.
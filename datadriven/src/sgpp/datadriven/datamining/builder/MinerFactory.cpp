@@ -22,7 +22,9 @@
 #include <sgpp/datadriven/datamining/modules/hpo/BoHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/HarmonicaHyperparameterOptimizer.hpp>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -30,6 +32,25 @@ namespace datadriven {
 SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
   DataMiningConfigParser parser(path);
   if (parser.hasFitterConfigCrossValidation()) {
+    CrossvalidationConfiguration crossValidationConfig{};
+    parser.getFitterCrossvalidationConfig(crossValidationConfig, crossValidationConfig);
+
+    if (crossValidationConfig.parallelFolds_ > 1) {
+      // one fitter and scorer per concurrently trained fold
+      const size_t parallelFolds =
+          std::min(crossValidationConfig.parallelFolds_, crossValidationConfig.kfold_);
+      std::vector<ModelFittingBase*> fitters;
+      std::vector<Scorer*> scorers;
+
+      for (size_t k = 0; k < parallelFolds; k++) {
+        fitters.push_back(createFitter(parser));
+        scorers.push_back(createScorer(parser));
+      }
+
+      return new SparseGridMinerCrossValidation(createDataSourceCrossValidation(parser), fitters,
+                                                scorers);
+    }
+
     // TODO(fuchsgdk): implement the cv stuff
     return new SparseGridMinerCrossValidation(createDataSourceCrossValidation(parser),
         createFitter(parser), createScorer(parser));
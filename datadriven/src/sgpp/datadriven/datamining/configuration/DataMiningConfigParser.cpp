@@ -92,6 +92,13 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.filePath = parseString(*dataSourceConfig, "filePath", defaults.filePath, "dataSource");
     config.isCompressed =
         parseBool(*dataSourceConfig, "compression", defaults.isCompressed, "dataSource");
+    config.streaming =
+        parseBool(*dataSourceConfig, "streaming", defaults.streaming, "dataSource");
+    config.streamingChunkSize = parseUInt(*dataSourceConfig, "streamingChunkSize",
+                                          defaults.streamingChunkSize, "dataSource");
+    config.streamingNumBufferedChunks =
+        parseUInt(*dataSourceConfig, "streamingNumBufferedChunks",
+                  defaults.streamingNumBufferedChunks, "dataSource");
     config.numBatches =
         parseUInt(*dataSourceConfig, "numBatches", defaults.numBatches, "dataSource");
     config.batchSize = parseUInt(*dataSourceConfig, "batchSize", defaults.batchSize, "dataSource");
@@ -307,6 +314,10 @@ bool DataMiningConfigParser::getFitterCrossvalidationConfig(
         parseBool(*crossvalidationConfig, "shuffle", defaults.shuffle_, "crossValidation");
     config.silent_ =
         parseBool(*crossvalidationConfig, "silent", defaults.silent_, "crossValidation");
+    config.parallelFolds_ = parseUInt(*crossvalidationConfig, "parallelFolds",
+                                      defaults.parallelFolds_, "crossValidation");
+    config.threadsPerFold_ = parseUInt(*crossvalidationConfig, "threadsPerFold",
+                                       defaults.threadsPerFold_, "crossValidation");
     config.lambda_ =
         parseDouble(*crossvalidationConfig, "lambda", defaults.lambda_, "crossValidation");
     config.lambdaStart_ = parseDouble(*crossvalidationConfig, "lambdaStart", defaults.lambdaStart_,
@@ -344,6 +355,9 @@ bool DataMiningConfigParser::getFitterDensityEstimationConfig(
                   defaults.iCholSweepsUpdateLambda_, "densityEstimationConfig");
     config.iCholSweepsSolver_ = parseUInt(*densityEstimationConfig, "iCholSweepsSolver",
                                           defaults.iCholSweepsSolver_, "densityEstimationConfig");
+    config.parallelDecomposition_ =
+        parseBool(*densityEstimationConfig, "parallelDecomposition",
+                  defaults.parallelDecomposition_, "densityEstimationConfig");
 
     // parse  density estimation type
     if (densityEstimationConfig->contains("densityEstimationType")) {
@@ -0,0 +1,166 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * BinaryFileSampleProvider.cpp
+ */
+
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+BinaryFileSampleProvider::BinaryFileSampleProvider(DataShufflingFunctor* shuffling)
+    : shuffling{shuffling},
+      file{nullptr},
+      buffer{nullptr},
+      data{nullptr},
+      info(),
+      hasTargets{true},
+      numSamples{0},
+      dimension{0},
+      counter{0} {}
+
+SampleProvider* BinaryFileSampleProvider::clone() const {
+  return dynamic_cast<SampleProvider*>(new BinaryFileSampleProvider{*this});
+}
+
+size_t BinaryFileSampleProvider::getDim() const {
+  if (data != nullptr) {
+    return dimension;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+size_t BinaryFileSampleProvider::getNumSamples() const {
+  if (data != nullptr) {
+    return numSamples;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+void BinaryFileSampleProvider::readFile(const std::string& filePath, bool hasTargets,
+                                        size_t readinCutoff, std::vector<size_t> readinColumns,
+                                        std::vector<double> readinClasses) {
+  file = std::make_shared<base::MemoryMappedFile>(filePath);
+  buffer = nullptr;
+  data = file->getData();
+  initialize(file->getSize(), hasTargets, readinCutoff, readinColumns, readinClasses);
+}
+
+void BinaryFileSampleProvider::readString(const std::string& input, bool hasTargets,
+                                          size_t readinCutoff, std::vector<size_t> readinColumns,
+                                          std::vector<double> readinClasses) {
+  // copy to an aligned buffer, as the values are accessed in place
+  file = nullptr;
+  buffer = std::make_shared<std::vector<double>>((input.size() + sizeof(double) - 1) /
+                                                 sizeof(double));
+  std::memcpy(buffer->data(), input.data(), input.size());
+  data = reinterpret_cast<const char*>(buffer->data());
+  initialize(input.size(), hasTargets, readinCutoff, readinColumns, readinClasses);
+}
+
+void BinaryFileSampleProvider::initialize(size_t size, bool hasTargets, size_t readinCutoff,
+                                          const std::vector<size_t>& readinColumns,
+                                          const std::vector<double>& readinClasses) {
+  try {
+    info = BinaryDatasetTools::readBinaryHeader(data, size);
+  } catch (...) {
+    data = nullptr;
+    throw;
+  }
+
+  if (hasTargets && !info.hasTargets) {
+    data = nullptr;
+    throw base::data_exception{"Binary dataset does not contain targets."};
+  }
+
+  if (!readinColumns.empty() &&
+      (*std::max_element(readinColumns.begin(), readinColumns.end()) >= info.dimension)) {
+    data = nullptr;
+    throw base::data_exception{"Invalid column selection for binary dataset."};
+  }
+
+  this->hasTargets = hasTargets;
+  this->readinColumns = readinColumns;
+  dimension = readinColumns.empty() ? info.dimension : readinColumns.size();
+  selectedRows.clear();
+  counter = 0;
+
+  if (hasTargets && !readinClasses.empty()) {
+    for (size_t row = 0; (row < info.numberInstances) && (selectedRows.size() < readinCutoff);
+         row++) {
+      const double target = getTarget(row);
+
+      if (std::any_of(readinClasses.begin(), readinClasses.end(),
+                      [target](double cl) { return std::fabs(target - cl) < 0.001; })) {
+        selectedRows.push_back(row);
+      }
+    }
+
+    numSamples = selectedRows.size();
+  } else {
+    numSamples = std::min(info.numberInstances, readinCutoff);
+  }
+}
+
+Dataset* BinaryFileSampleProvider::getNextSamples(size_t howMany) {
+  if (data == nullptr) {
+    throw base::file_exception("No dataset loaded.");
+  }
+
+  const size_t size = std::min(howMany, numSamples - counter);
+  auto tmpDataset = std::make_unique<Dataset>(size, dimension);
+
+  double* destSamples = tmpDataset->getData().data();
+  double* destTargets = tmpDataset->getTargets().data();
+
+  // copy "size" rows beginning from "counter" to the new dataset.
+  for (size_t i = counter; i < counter + size; ++i) {
+    size_t srcIdx = shuffling != nullptr ? (*shuffling)(i, numSamples) : i;
+    const size_t row = selectedRows.empty() ? srcIdx : selectedRows[srcIdx];
+    double* destRow = destSamples + (i - counter) * dimension;
+
+    if (!readinColumns.empty()) {
+      for (size_t t = 0; t < dimension; t++) {
+        destRow[t] = getValue(row * info.dimension + readinColumns[t]);
+      }
+    } else if (info.singlePrecision) {
+      const float* srcRow = reinterpret_cast<const float*>(data + info.dataOffset) +
+                            row * info.dimension;
+      std::copy(srcRow, srcRow + dimension, destRow);
+    } else {
+      std::memcpy(destRow, data + info.dataOffset + row * info.dimension * sizeof(double),
+                  dimension * sizeof(double));
+    }
+
+    destTargets[i - counter] = hasTargets ? getTarget(row) : 0.0;
+  }
+
+  counter = counter + size;
+
+  return tmpDataset.release();
+}
+
+Dataset* BinaryFileSampleProvider::getAllSamples() {
+  return this->getNextSamples(getNumSamples());
+}
+
+void BinaryFileSampleProvider::reset() {
+  counter = 0;
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
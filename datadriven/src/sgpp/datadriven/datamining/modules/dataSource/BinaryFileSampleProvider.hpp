@@ -0,0 +1,171 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * BinaryFileSampleProvider.hpp
+ */
+
+#pragma once
+
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetTools.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * BinaryFileSampleProvider provides samples from binary dataset files (see
+ * #sgpp::datadriven::BinaryDatasetTools). The file is memory-mapped instead of parsed, so opening
+ * it takes constant time, only the pages of requested samples are read from disk and several
+ * processes share the page-cached file. Copies of the provider (see #clone) share the mapping.
+ * The samples of a batch are copied from the mapped pages to the returned
+ * #sgpp::datadriven::Dataset.
+ */
+class BinaryFileSampleProvider : public FileSampleProvider {
+ public:
+  /**
+   * Default constructor
+   * @param shuffling functor to permute the training data indexes
+   */
+  explicit BinaryFileSampleProvider(DataShufflingFunctor *shuffling = nullptr);
+
+  /**
+   * Clone Pattern to allow copying of derived classes.
+   * @return a Pointer to a new instance of #sgpp::datadriven::BinaryFileSampleProvider with copied
+   * state. Caller owns the new object.
+   */
+  SampleProvider *clone() const override;
+
+  Dataset *getNextSamples(size_t howMany) override;
+
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  size_t getNumSamples() const override;
+
+  /**
+   * Map an existing binary dataset file. Throws if file can not be opened or is no valid binary
+   * dataset.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readFile(const std::string &filePath,
+                bool hasTargets,
+                size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Read a binary dataset from a string (the contents are copied).
+   * @param input string containing a binary dataset
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readString(const std::string &input,
+                  bool hasTargets,
+                  size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Resets the state of the sample provider (e.g. to start a new epoch)
+   */
+  void reset() override;
+
+ private:
+  /**
+   * Functor to shuffle the data (permute the indexes)
+   */
+  DataShufflingFunctor *shuffling;
+
+  /**
+   * Mapped file (shared between copies of the provider)
+   */
+  std::shared_ptr<base::MemoryMappedFile> file;
+
+  /**
+   * Copy of the data passed to #readString
+   */
+  std::shared_ptr<std::vector<double>> buffer;
+
+  /**
+   * Contents of the mapped file or of #buffer
+   */
+  const char *data;
+
+  /**
+   * Layout of the data
+   */
+  BinaryDatasetInfo info;
+
+  /**
+   * Whether the targets are read
+   */
+  bool hasTargets;
+
+  /**
+   * Columns that are read (empty for all columns)
+   */
+  std::vector<size_t> readinColumns;
+
+  /**
+   * Rows of the file that are provided (empty for the first #numSamples rows), used if only
+   * some classes are read
+   */
+  std::vector<size_t> selectedRows;
+
+  /**
+   * Number of provided samples
+   */
+  size_t numSamples;
+
+  /**
+   * Dimensionality of the provided samples
+   */
+  size_t dimension;
+
+  /**
+   * Indicates the index where #getNextSamples will start grabbing new samples in its
+   * next call.
+   */
+  size_t counter;
+
+  /**
+   * Checks the header of #data and applies the selection of rows and columns.
+   */
+  void initialize(size_t size, bool hasTargets, size_t readinCutoff,
+                  const std::vector<size_t> &readinColumns,
+                  const std::vector<double> &readinClasses);
+
+  /**
+   * @return value with the given index in the array of samples (row-major)
+   */
+  inline double getValue(size_t index) const {
+    return info.singlePrecision
+               ? reinterpret_cast<const float *>(data + info.dataOffset)[index]
+               : reinterpret_cast<const double *>(data + info.dataOffset)[index];
+  }
+
+  /**
+   * @return target of the given row of the file
+   */
+  inline double getTarget(size_t row) const {
+    return info.singlePrecision
+               ? reinterpret_cast<const float *>(data + info.targetsOffset)[row]
+               : reinterpret_cast<const double *>(data + info.targetsOffset)[row];
+  }
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
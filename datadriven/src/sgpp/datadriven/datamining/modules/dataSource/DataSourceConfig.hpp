@@ -22,7 +22,7 @@ namespace datadriven {
 /**
  * Supported file types for sgpp::datadriven::FileSampleProvider
  */
-enum class DataSourceFileType { NONE, ARFF, CSV };
+enum class DataSourceFileType { NONE, ARFF, CSV, BINARY };
 
 /**
  * Enumeration of all supported shuffling types used to permute samples in a dataset. An entry
@@ -48,6 +48,19 @@ struct DataSourceConfig {
    * The dataset is gzip compressed
    */
   bool isCompressed = false;
+  /**
+   * Read the file in chunks on a background thread instead of at once (see
+   * #sgpp::datadriven::StreamingFileSampleProvider). Only sequential shuffling is supported.
+   */
+  bool streaming = false;
+  /**
+   * Number of samples per chunk if the file is streamed
+   */
+  size_t streamingChunkSize = 4096;
+  /**
+   * Maximal number of parsed chunks kept in memory if the file is streamed
+   */
+  size_t streamingNumBufferedChunks = 4;
   /**
    * How many batches should the dataset be split into for batch learning - if 1, take the
    * entire dataset
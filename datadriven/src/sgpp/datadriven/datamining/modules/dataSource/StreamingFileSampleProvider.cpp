@@ -0,0 +1,507 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * StreamingFileSampleProvider.cpp
+ */
+
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifdef ZLIB
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+#ifdef ZLIB
+namespace {
+
+/**
+ * Stream buffer inflating a gzip compressed file block by block.
+ */
+class GzipStreamBuffer : public std::streambuf {
+ public:
+  explicit GzipStreamBuffer(const std::string& fileName)
+      : file(gzopen(fileName.c_str(), "rb")), buffer(1 << 16) {}
+
+  ~GzipStreamBuffer() override {
+    if (file != nullptr) {
+      gzclose(file);
+    }
+  }
+
+  bool isOpen() const { return file != nullptr; }
+
+ protected:
+  int_type underflow() override {
+    if (gptr() < egptr()) {
+      return traits_type::to_int_type(*gptr());
+    }
+
+    int bytes = gzread(file, buffer.data(), static_cast<unsigned int>(buffer.size()));
+
+    if (bytes <= 0) {
+      return traits_type::eof();
+    }
+
+    setg(buffer.data(), buffer.data(), buffer.data() + bytes);
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  gzFile file;
+  std::vector<char> buffer;
+};
+
+/**
+ * Input stream reading a gzip compressed file.
+ */
+class GzipInputStream : public std::istream {
+ public:
+  explicit GzipInputStream(const std::string& fileName)
+      : std::istream(nullptr), streamBuffer(fileName) {
+    rdbuf(&streamBuffer);
+  }
+
+  bool isOpen() const { return streamBuffer.isOpen(); }
+
+ private:
+  GzipStreamBuffer streamBuffer;
+};
+
+}  // namespace
+#endif
+
+StreamingFileSampleProvider::StreamingFileSampleProvider(DataSourceFileType fileType,
+                                                         bool isCompressed, size_t chunkSize,
+                                                         size_t numBufferedChunks)
+    : fileType(fileType),
+      isCompressed(isCompressed),
+      chunkSize(std::max(chunkSize, static_cast<size_t>(1))),
+      numBufferedChunks(std::max(numBufferedChunks, static_cast<size_t>(1))),
+      filePath(""),
+      input(nullptr),
+      hasTargets(true),
+      readinCutoff(-1),
+      numColumns(0),
+      dimension(0),
+      numSamples(0),
+      numSamplesCounted(false),
+      finished(false),
+      stopRequested(false),
+      readerException(nullptr),
+      currentChunk(nullptr),
+      currentPosition(0) {
+  if (fileType != DataSourceFileType::CSV && fileType != DataSourceFileType::ARFF) {
+    throw base::data_exception{"StreamingFileSampleProvider: Unknown file type"};
+  }
+#ifndef ZLIB
+  if (isCompressed) {
+    throw base::application_exception{
+        "sgpp has been built without zlib support. Reading compressed files is not possible"};
+  }
+#endif
+}
+
+StreamingFileSampleProvider::StreamingFileSampleProvider(const StreamingFileSampleProvider& rhs)
+    : StreamingFileSampleProvider(rhs.fileType, rhs.isCompressed, rhs.chunkSize,
+                                  rhs.numBufferedChunks) {
+  filePath = rhs.filePath;
+  input = rhs.input;
+  hasTargets = rhs.hasTargets;
+  readinCutoff = rhs.readinCutoff;
+  readinColumns = rhs.readinColumns;
+  readinClasses = rhs.readinClasses;
+  numColumns = rhs.numColumns;
+  dimension = rhs.dimension;
+  numSamples = rhs.numSamples;
+  numSamplesCounted = rhs.numSamplesCounted;
+
+  if (dimension != 0) {
+    startReader();
+  }
+}
+
+StreamingFileSampleProvider::~StreamingFileSampleProvider() { stopReader(); }
+
+SampleProvider* StreamingFileSampleProvider::clone() const {
+  return dynamic_cast<SampleProvider*>(new StreamingFileSampleProvider{*this});
+}
+
+size_t StreamingFileSampleProvider::getDim() const {
+  if (dimension != 0) {
+    return dimension;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+size_t StreamingFileSampleProvider::getNumSamples() const {
+  if (dimension == 0) {
+    throw base::file_exception{"No dataset loaded."};
+  }
+
+  if (!numSamplesCounted) {
+    auto stream = openStream();
+    std::string line;
+    std::vector<double> values;
+    size_t lineNumber = 0;
+    bool headerSkipped = false;
+
+    numSamples = 0;
+
+    while (numSamples < readinCutoff &&
+           nextSample(*stream, line, lineNumber, headerSkipped, values)) {
+      numSamples++;
+    }
+
+    numSamplesCounted = true;
+  }
+
+  return numSamples;
+}
+
+void StreamingFileSampleProvider::readFile(const std::string& filePath, bool hasTargets,
+                                           size_t readinCutoff, std::vector<size_t> readinColumns,
+                                           std::vector<double> readinClasses) {
+  stopReader();
+  this->filePath = filePath;
+  this->input = nullptr;
+  this->hasTargets = hasTargets;
+  this->readinCutoff = readinCutoff;
+  this->readinColumns = readinColumns;
+  this->readinClasses = readinClasses;
+  parseHeader();
+  startReader();
+}
+
+void StreamingFileSampleProvider::readString(const std::string& input, bool hasTargets,
+                                             size_t readinCutoff,
+                                             std::vector<size_t> readinColumns,
+                                             std::vector<double> readinClasses) {
+  stopReader();
+  this->filePath = "";
+  this->input = std::make_shared<const std::string>(input);
+  this->hasTargets = hasTargets;
+  this->readinCutoff = readinCutoff;
+  this->readinColumns = readinColumns;
+  this->readinClasses = readinClasses;
+  parseHeader();
+  startReader();
+}
+
+Dataset* StreamingFileSampleProvider::getNextSamples(size_t howMany) {
+  if (dimension == 0) {
+    throw base::file_exception{"No dataset loaded."};
+  }
+
+  // collect the ranges of the chunks that form the requested samples
+  std::vector<std::tuple<std::shared_ptr<Chunk>, size_t, size_t>> pieces;
+  size_t size = 0;
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (size < howMany) {
+      if ((currentChunk == nullptr) || (currentPosition == currentChunk->size)) {
+        notEmpty.wait(lock, [this]() { return !chunks.empty() || finished; });
+
+        if (chunks.empty()) {
+          if (readerException != nullptr) {
+            std::rethrow_exception(readerException);
+          }
+
+          currentChunk = nullptr;
+          break;
+        }
+
+        currentChunk = chunks.front();
+        currentPosition = 0;
+        chunks.pop_front();
+        notFull.notify_one();
+      }
+
+      const size_t count = std::min(howMany - size, currentChunk->size - currentPosition);
+      pieces.emplace_back(currentChunk, currentPosition, count);
+      currentPosition += count;
+      size += count;
+    }
+  }
+
+  auto dataset = std::make_unique<Dataset>(size, dimension);
+  double* data = dataset->getData().getPointer();
+  double* targets = dataset->getTargets().getPointer();
+
+  for (auto& piece : pieces) {
+    const Chunk& chunk = *std::get<0>(piece);
+    const size_t begin = std::get<1>(piece);
+    const size_t count = std::get<2>(piece);
+
+    std::copy(chunk.data.begin() + begin * dimension,
+              chunk.data.begin() + (begin + count) * dimension, data);
+    std::copy(chunk.targets.begin() + begin, chunk.targets.begin() + begin + count, targets);
+    data += count * dimension;
+    targets += count;
+  }
+
+  return dataset.release();
+}
+
+Dataset* StreamingFileSampleProvider::getAllSamples() {
+  return getNextSamples(std::numeric_limits<size_t>::max());
+}
+
+void StreamingFileSampleProvider::reset() {
+  if (dimension != 0) {
+    stopReader();
+    startReader();
+  }
+}
+
+std::unique_ptr<std::istream> StreamingFileSampleProvider::openStream() const {
+  if (input != nullptr) {
+    return std::unique_ptr<std::istream>(new std::istringstream(*input));
+  }
+
+  if (isCompressed) {
+#ifdef ZLIB
+    auto stream = std::make_unique<GzipInputStream>(filePath);
+
+    if (!stream->isOpen()) {
+      throw base::file_exception{("Unable to open Gzip compressed file: " + filePath).c_str()};
+    }
+
+    return std::unique_ptr<std::istream>(stream.release());
+#else
+    throw base::application_exception{
+        "sgpp has been built without zlib support. Reading compressed files is not possible"};
+#endif
+  }
+
+  auto stream = std::make_unique<std::ifstream>(filePath.c_str());
+
+  if (!stream->is_open()) {
+    throw base::file_exception{("Unable to open file: " + filePath).c_str()};
+  }
+
+  return std::unique_ptr<std::istream>(stream.release());
+}
+
+bool StreamingFileSampleProvider::nextDataLine(std::istream& stream, std::string& line,
+                                               size_t& lineNumber, bool& headerSkipped) const {
+  while (std::getline(stream, line)) {
+    lineNumber++;
+
+    if (!line.empty() && (line.back() == '\r')) {
+      line.pop_back();
+    }
+
+    if (line.empty()) {
+      continue;
+    }
+
+    if (fileType == DataSourceFileType::CSV) {
+      const size_t firstCharacter = line.find_first_not_of(" \t");
+
+      if ((firstCharacter == std::string::npos) || (line[firstCharacter] == '#')) {
+        // blank lines and comments
+        continue;
+      }
+
+      // the first line with content contains the column titles
+      if (!headerSkipped) {
+        headerSkipped = true;
+        continue;
+      }
+    } else if ((line.find('%') != std::string::npos) || (line.find('@') != std::string::npos)) {
+      // ARFF comments and attribute specifications
+      continue;
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+bool StreamingFileSampleProvider::nextSample(std::istream& stream, std::string& line,
+                                             size_t& lineNumber, bool& headerSkipped,
+                                             std::vector<double>& values) const {
+  while (nextDataLine(stream, line, lineNumber, headerSkipped)) {
+    // parse the values in place (tokens that are no numbers are read as 0 like atof does)
+    values.clear();
+    const char* position = line.c_str();
+
+    while (true) {
+      char* end = nullptr;
+      values.push_back(std::strtod(position, &end));
+      position = std::strchr(end, ',');
+
+      if (position == nullptr) {
+        break;
+      }
+
+      position++;
+    }
+
+    if (values.size() != numColumns) {
+      throw base::data_exception{
+          ("StreamingFileSampleProvider: Columns missing in line " + std::to_string(lineNumber))
+              .c_str()};
+    }
+
+    if (hasTargets && !readinClasses.empty()) {
+      const double target = values.back();
+      const bool isSelectedClass =
+          std::any_of(readinClasses.begin(), readinClasses.end(),
+                      [target](double cl) { return std::fabs(target - cl) < 0.001; });
+
+      if (!isSelectedClass) {
+        continue;
+      }
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+void StreamingFileSampleProvider::parseHeader() {
+  numColumns = 0;
+  dimension = 0;
+  numSamplesCounted = false;
+
+  auto stream = openStream();
+  std::string line;
+  size_t lineNumber = 0;
+  bool headerSkipped = false;
+
+  if (!nextDataLine(*stream, line, lineNumber, headerSkipped)) {
+    throw base::data_exception{"StreamingFileSampleProvider: The data contains no samples"};
+  }
+
+  // relies on the first line being a correct instance line
+  numColumns = std::count(line.begin(), line.end(), ',') + 1;
+  const size_t maxDim = hasTargets ? numColumns - 1 : numColumns;
+
+  if (!readinColumns.empty()) {
+    if (*std::max_element(readinColumns.begin(), readinColumns.end()) >= maxDim) {
+      throw base::data_exception{"StreamingFileSampleProvider: Invalid column selection"};
+    }
+
+    dimension = readinColumns.size();
+  } else {
+    dimension = maxDim;
+  }
+
+  if (dimension == 0) {
+    throw base::data_exception{"StreamingFileSampleProvider: The data has no dimensions"};
+  }
+}
+
+void StreamingFileSampleProvider::startReader() {
+  auto stream = openStream();
+
+  chunks.clear();
+  currentChunk = nullptr;
+  currentPosition = 0;
+  finished = false;
+  stopRequested = false;
+  readerException = nullptr;
+  reader = std::thread(&StreamingFileSampleProvider::readChunks, this, std::move(stream));
+}
+
+void StreamingFileSampleProvider::stopReader() {
+  if (reader.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopRequested = true;
+    }
+
+    notFull.notify_all();
+    reader.join();
+  }
+
+  chunks.clear();
+  currentChunk = nullptr;
+  currentPosition = 0;
+}
+
+void StreamingFileSampleProvider::readChunks(std::unique_ptr<std::istream> stream) {
+  try {
+    std::string line;
+    std::vector<double> values;
+    size_t lineNumber = 0;
+    bool headerSkipped = false;
+    size_t numRead = 0;
+    bool endOfData = false;
+
+    while (!endOfData) {
+      auto chunk = std::make_shared<Chunk>();
+      chunk->data.reserve(chunkSize * dimension);
+      chunk->targets.reserve(chunkSize);
+
+      while (chunk->size < chunkSize) {
+        if ((numRead >= readinCutoff) ||
+            !nextSample(*stream, line, lineNumber, headerSkipped, values)) {
+          endOfData = true;
+          break;
+        }
+
+        if (readinColumns.empty()) {
+          chunk->data.insert(chunk->data.end(), values.begin(), values.begin() + dimension);
+        } else {
+          for (size_t column : readinColumns) {
+            chunk->data.push_back(values[column]);
+          }
+        }
+
+        chunk->targets.push_back(hasTargets ? values.back() : 0.0);
+        chunk->size++;
+        numRead++;
+      }
+
+      std::unique_lock<std::mutex> lock(mutex);
+      notFull.wait(lock, [this]() { return stopRequested || chunks.size() < numBufferedChunks; });
+
+      if (stopRequested) {
+        return;
+      }
+
+      if (chunk->size > 0) {
+        chunks.push_back(chunk);
+      }
+
+      finished = endOfData;
+      notEmpty.notify_all();
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex);
+    readerException = std::current_exception();
+    finished = true;
+    notEmpty.notify_all();
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
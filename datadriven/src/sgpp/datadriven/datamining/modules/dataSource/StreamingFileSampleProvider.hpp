@@ -0,0 +1,271 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * StreamingFileSampleProvider.hpp
+ */
+
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * StreamingFileSampleProvider reads CSV or ARFF files (optionally gzip compressed) in chunks
+ * instead of parsing the whole file into one #sgpp::datadriven::Dataset. A background thread
+ * parses chunks of a fixed number of samples and keeps a bounded number of them in a queue, so
+ * the memory consumption does not depend on the size of the file and reading the file overlaps
+ * with the processing of the samples returned by #getNextSamples.
+ *
+ * The samples are returned in the order of the file, i.e., shuffling is not supported. The
+ * format of the files is the same as for #sgpp::datadriven::CSVFileSampleProvider (the first line
+ * contains the column titles) and #sgpp::datadriven::ArffFileSampleProvider (lines containing '@'
+ * or '%' are skipped).
+ */
+class StreamingFileSampleProvider : public FileSampleProvider {
+ public:
+  /**
+   * Constructor
+   * @param fileType format of the files (CSV or ARFF)
+   * @param isCompressed whether files read with #readFile are gzip compressed
+   * @param chunkSize number of samples that are parsed at once by the background thread
+   * @param numBufferedChunks maximal number of parsed chunks that are kept in memory
+   */
+  explicit StreamingFileSampleProvider(DataSourceFileType fileType, bool isCompressed = false,
+                                       size_t chunkSize = 4096, size_t numBufferedChunks = 4);
+
+  /**
+   * Copy constructor. The copy starts reading the file (or string) of rhs from the beginning.
+   * @param rhs the object to copy the configuration from
+   */
+  StreamingFileSampleProvider(const StreamingFileSampleProvider &rhs);
+
+  StreamingFileSampleProvider &operator=(const StreamingFileSampleProvider &rhs) = delete;
+
+  /**
+   * Destructor, stops the background thread.
+   */
+  ~StreamingFileSampleProvider() override;
+
+  /**
+   * Clone Pattern to allow copying of derived classes.
+   * @return a Pointer to a new instance of #sgpp::datadriven::StreamingFileSampleProvider reading
+   * the same file from the beginning. Caller owns the new object.
+   */
+  SampleProvider *clone() const override;
+
+  /**
+   * Returns the next samples of the file, waiting for the background thread if necessary.
+   * @param howMany number of requested samples
+   * @return #sgpp::datadriven::Dataset* containing at most howMany samples (less if the end of the
+   * file is reached). This object is owned by the caller.
+   */
+  Dataset *getNextSamples(size_t howMany) override;
+
+  /**
+   * Returns all remaining samples of the file. Note that this loads the remaining file into
+   * memory.
+   * @return #sgpp::datadriven::Dataset* containing the remaining samples. This object is owned by
+   * the caller.
+   */
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  /**
+   * Returns the number of samples of the file. The samples are counted in a separate pass over
+   * the file (with bounded memory) when this function is called for the first time.
+   * @return the number of samples of the file (respecting readinCutoff and readinClasses)
+   */
+  size_t getNumSamples() const override;
+
+  /**
+   * Opens the file, parses its header and starts the background thread. Throws if the file can
+   * not be opened or parsed.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readFile(const std::string &filePath, bool hasTargets, size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Streams the samples from a string (which has to be uncompressed).
+   * @param input string containing the data in the file format of this provider
+   * @param hasTargets whether the data has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readString(const std::string &input, bool hasTargets, size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Restarts reading at the beginning of the file (e.g. to start a new epoch)
+   */
+  void reset() override;
+
+ private:
+  /**
+   * Samples parsed by the background thread, stored row-wise.
+   */
+  struct Chunk {
+    std::vector<double> data;
+    std::vector<double> targets;
+    size_t size = 0;
+  };
+
+  /**
+   * Format of the files
+   */
+  DataSourceFileType fileType;
+  /**
+   * Whether files read with #readFile are gzip compressed
+   */
+  bool isCompressed;
+  /**
+   * Number of samples per chunk
+   */
+  size_t chunkSize;
+  /**
+   * Maximal number of chunks in #chunks
+   */
+  size_t numBufferedChunks;
+
+  /**
+   * Path of the file, empty if the samples are read from #input
+   */
+  std::string filePath;
+  /**
+   * Data passed to #readString
+   */
+  std::shared_ptr<const std::string> input;
+  bool hasTargets;
+  size_t readinCutoff;
+  std::vector<size_t> readinColumns;
+  std::vector<double> readinClasses;
+
+  /**
+   * Number of values per line (including the target)
+   */
+  size_t numColumns;
+  /**
+   * Dimensionality of the returned samples
+   */
+  size_t dimension;
+  /**
+   * Number of samples, computed by #getNumSamples
+   */
+  mutable size_t numSamples;
+  /**
+   * Whether #numSamples has been computed
+   */
+  mutable bool numSamplesCounted;
+
+  std::thread reader;
+  std::mutex mutex;
+  /**
+   * Signals that a chunk has been removed from the queue or the reader should stop
+   */
+  std::condition_variable notFull;
+  /**
+   * Signals that a chunk has been added to the queue or the reader has finished
+   */
+  std::condition_variable notEmpty;
+  /**
+   * Chunks parsed by the background thread that have not been fetched yet
+   */
+  std::deque<std::shared_ptr<Chunk>> chunks;
+  /**
+   * Whether the background thread has reached the end of the file
+   */
+  bool finished;
+  /**
+   * Whether the background thread should stop
+   */
+  bool stopRequested;
+  /**
+   * Exception thrown by the background thread, rethrown by #getNextSamples
+   */
+  std::exception_ptr readerException;
+
+  /**
+   * Chunk that is currently consumed by #getNextSamples and the index of its next sample
+   */
+  std::shared_ptr<Chunk> currentChunk;
+  size_t currentPosition;
+
+  /**
+   * Opens a new stream positioned at the beginning of the file or string.
+   */
+  std::unique_ptr<std::istream> openStream() const;
+
+  /**
+   * Parses the header of the data and determines the number of columns and the dimension.
+   */
+  void parseHeader();
+
+  /**
+   * Reads the next line of the stream containing a sample, skipping empty lines, comments and
+   * headers. The header of a CSV file is its first line that is neither blank nor a comment
+   * (starting with '#').
+   * @param stream the stream
+   * @param line buffer for the line
+   * @param lineNumber number of lines read so far, incremented by this function
+   * @param headerSkipped whether the CSV header has been read from the stream, set by this
+   * function (false for a new stream)
+   * @return false if the end of the stream has been reached
+   */
+  bool nextDataLine(std::istream &stream, std::string &line, size_t &lineNumber,
+                    bool &headerSkipped) const;
+
+  /**
+   * Reads and parses the next sample from the stream, skipping samples of classes that are not
+   * in #readinClasses.
+   * @param stream the stream
+   * @param line buffer for the current line
+   * @param lineNumber number of lines read so far, incremented by this function
+   * @param headerSkipped whether the CSV header has been read from the stream (see
+   * nextDataLine())
+   * @param values buffer for the parsed values of the line
+   * @return false if the end of the stream has been reached
+   */
+  bool nextSample(std::istream &stream, std::string &line, size_t &lineNumber,
+                  bool &headerSkipped, std::vector<double> &values) const;
+
+  /**
+   * Starts the background thread reading from the beginning of the file.
+   */
+  void startReader();
+
+  /**
+   * Stops the background thread and discards the parsed chunks.
+   */
+  void stopReader();
+
+  /**
+   * Function of the background thread.
+   * @param stream stream to read from
+   */
+  void readChunks(std::unique_ptr<std::istream> stream);
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -90,11 +90,14 @@ double ModelFittingClassification::evaluate(const DataVector& sample) {
 }
 
 void ModelFittingClassification::evaluate(DataMatrix& samples, DataVector& results) {
-#pragma omp parallel for
-  for (size_t i = 0; i < samples.getNrows(); i++) {
+#pragma omp parallel
+  {
     DataVector tmp(samples.getNcols());
-    samples.getRow(i, tmp);
-    results.set(i, evaluate(tmp));
+#pragma omp for
+    for (size_t i = 0; i < samples.getNrows(); i++) {
+      samples.getRow(i, tmp);
+      results.set(i, evaluate(tmp));
+    }
   }
 }
 
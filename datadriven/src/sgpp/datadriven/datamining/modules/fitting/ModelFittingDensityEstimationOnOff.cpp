@@ -77,30 +77,36 @@ void ModelFittingDensityEstimationOnOff::fit(DataMatrix& newDataset) {
   alpha = DataVector{grid->getSize()};
 
   // Build the offline instance first
-  DBMatOffline *offline = nullptr;
-
   // Intialize database if it is provided
   if (!databaseConfig.filepath.empty()) {
     datadriven::DBMatDatabase database(databaseConfig.filepath);
     // Check if database holds a fitting lhs matrix decomposition
     if (database.hasDataMatrix(gridConfig, refinementConfig, regularizationConfig,
         densityEstimationConfig)) {
-      std::string offlineFilepath = database.getDataMatrix(gridConfig, refinementConfig,
-          regularizationConfig, densityEstimationConfig);
-      offline = DBMatOfflineFactory::buildFromFile(offlineFilepath);
+      offline = database.loadDataMatrix(gridConfig, refinementConfig, regularizationConfig,
+          densityEstimationConfig);
+
+      // the online object modifies the decomposition only when the grid is refined, hence it
+      // only gets a copy of the shared, cached object if refinements are configured
+      if (refinementConfig.numRefinements_ > 0) {
+        offline = std::shared_ptr<const DBMatOffline>(offline->clone());
+      }
     }
   }
 
   // Build and decompose offline object if not loaded from database
   if (offline == nullptr) {
     // Build offline object by factory, build matrix and decompose
-    offline = DBMatOfflineFactory::buildOfflineObject(gridConfig, refinementConfig,
-        regularizationConfig, densityEstimationConfig);
-    offline->buildMatrix(grid.get(), regularizationConfig);
-    offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+    std::unique_ptr<DBMatOffline> newOffline(DBMatOfflineFactory::buildOfflineObject(gridConfig,
+        refinementConfig, regularizationConfig, densityEstimationConfig));
+    newOffline->buildMatrix(grid.get(), regularizationConfig);
+    newOffline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+    offline = std::move(newOffline);
   }
-  online = std::unique_ptr<DBMatOnlineDE>{DBMatOnlineDEFactory::buildDBMatOnlineDE(*offline,
-     *grid, regularizationConfig.lambda_)};
+  // the online object is only allowed to modify the offline object during refinement, in which
+  // case the offline object is not shared (see above)
+  online = std::unique_ptr<DBMatOnlineDE>{DBMatOnlineDEFactory::buildDBMatOnlineDE(
+      const_cast<DBMatOffline&>(*offline), *grid, regularizationConfig.lambda_)};
 
   online->computeDensityFunction(alpha, newDataset, *grid,
       this->config->getDensityEstimationConfig(), true,
@@ -162,6 +168,7 @@ bool ModelFittingDensityEstimationOnOff::isRefinable() {
 void ModelFittingDensityEstimationOnOff::reset() {
   grid.reset();
   online.reset();
+  offline.reset();
   refinementsPerformed = 0;
 }
 
@@ -26,6 +26,7 @@
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 
 #include <list>
+#include <memory>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::Grid;
@@ -113,6 +114,10 @@ class ModelFittingDensityEstimationOnOff : public ModelFittingDensityEstimation
   void reset() override;
 
  private:
+  // The offline object, shared with the cache of the database if it is loaded from the database
+  // and the grid is not refined
+  std::shared_ptr<const DBMatOffline> offline;
+
   // The online object
   std::unique_ptr<DBMatOnlineDE> online;
 };
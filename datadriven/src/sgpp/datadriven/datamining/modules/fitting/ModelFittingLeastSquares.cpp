@@ -94,7 +94,7 @@ bool ModelFittingLeastSquares::refine() {
 
 void ModelFittingLeastSquares::update(Dataset &newDataset) {
   if (grid != nullptr) {
-    reset();
+    // keep the (possibly refined) grid and use the current surpluses as initial guess
     // reassign dataset
     dataset = &newDataset;
     // create sytem matrix
@@ -55,6 +55,12 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
    */
   bool refine() override;
 
+  /**
+   * Fit the model to a new batch of training data. The grid of a previous fit (including its
+   * refinements) is kept and the current weights are used as initial guess. If there is no grid
+   * yet, the model is fitted from scratch.
+   * @param dataset training data
+   */
   void update(Dataset &dataset) override;
 
   /**
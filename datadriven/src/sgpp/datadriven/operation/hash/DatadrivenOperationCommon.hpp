@@ -31,11 +31,20 @@ enum class OperationMultipleEvalSubType {
 
 enum class OperationMultipleEvalMPIType { NONE, MASTERSLAVE, HPX };
 
+/**
+ * Floating point precision of the multi-evaluation operations:
+ * DOUBLE stores and accumulates in double precision (OperationMultipleEval),
+ * MIXED stores data in single precision and accumulates in double precision,
+ * SINGLE stores and accumulates in single precision (both OperationMultipleEvalSP).
+ */
+enum class OperationMultipleEvalPrecision { DOUBLE, SINGLE, MIXED };
+
 class OperationMultipleEvalConfiguration {
  private:
   OperationMultipleEvalType type = OperationMultipleEvalType::DEFAULT;
   OperationMultipleEvalSubType subType = OperationMultipleEvalSubType::DEFAULT;
   OperationMultipleEvalMPIType mpiType = OperationMultipleEvalMPIType::NONE;
+  OperationMultipleEvalPrecision precision = OperationMultipleEvalPrecision::DOUBLE;
 
   std::shared_ptr<base::OperationConfiguration> parameters;
 
@@ -82,6 +91,10 @@ class OperationMultipleEvalConfiguration {
 
   OperationMultipleEvalSubType getSubType() { return this->subType; }
 
+  OperationMultipleEvalPrecision getPrecision() { return this->precision; }
+
+  void setPrecision(OperationMultipleEvalPrecision precision) { this->precision = precision; }
+
   std::shared_ptr<base::OperationConfiguration> getParameters() { return this->parameters; }
 
   std::string& getName() { return this->name; }
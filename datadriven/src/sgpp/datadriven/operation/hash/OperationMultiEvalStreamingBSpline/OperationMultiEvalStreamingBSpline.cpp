@@ -0,0 +1,446 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include "sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp"
+
+#include "sgpp/base/exception/operation_exception.hpp"
+#include "sgpp/globaldef.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/**
+ * Adds the weighted values of the cardinal B-spline of degree P at scale * x + shift
+ * to the values of all points of a chunk. The B-spline is evaluated branch-free
+ * with truncated powers, mirrored to the left half of its support.
+ * The degree is a template parameter such that the inner loops are unrolled and the
+ * loop over the points is vectorized.
+ *
+ * @param coefficients  coefficients of the truncated powers
+ * @param scale         factor of the affine transformation
+ * @param shift         offset of the affine transformation
+ * @param weight        weight of the B-spline
+ * @param x             coordinates of the points of the chunk
+ * @param[in,out] value function values
+ */
+template <size_t P>
+inline void addCardinalBSpline(const double* coefficients, double scale, double shift,
+                               double weight, const double* x, double* value) {
+  const double upperKnot = static_cast<double>(P + 1);
+
+#pragma omp simd
+  for (size_t k = 0; k < STREAMING_BSPLINE_CHUNK_DATA_POINTS; k++) {
+    const double y = scale * x[k] + shift;
+    const double s = (y < upperKnot - y) ? y : upperKnot - y;
+    double bspline = 0.0;
+
+    for (size_t j = 0; j <= P / 2; j++) {
+      const double u = (s > static_cast<double>(j)) ? s - static_cast<double>(j) : 0.0;
+      double power = u;
+
+      for (size_t q = 1; q < P; q++) {
+        power *= u;
+      }
+
+      bspline += coefficients[j] * power;
+    }
+
+    value[k] += weight * bspline;
+  }
+}
+
+/**
+ * Same as addCardinalBSpline<P> for arbitrary degrees
+ * (the loops over the points are the innermost loops).
+ *
+ * @param p             B-spline degree
+ * @param coefficients  coefficients of the truncated powers
+ * @param scale         factor of the affine transformation
+ * @param shift         offset of the affine transformation
+ * @param weight        weight of the B-spline
+ * @param x             coordinates of the points of the chunk
+ * @param[in,out] value function values
+ */
+inline void addCardinalBSpline(size_t p, const double* coefficients, double scale, double shift,
+                               double weight, const double* x, double* value) {
+  const size_t chunkSize = STREAMING_BSPLINE_CHUNK_DATA_POINTS;
+  const double upperKnot = static_cast<double>(p + 1);
+  alignas(64) double s[STREAMING_BSPLINE_CHUNK_DATA_POINTS];
+  alignas(64) double u[STREAMING_BSPLINE_CHUNK_DATA_POINTS];
+  alignas(64) double power[STREAMING_BSPLINE_CHUNK_DATA_POINTS];
+
+#pragma omp simd
+  for (size_t k = 0; k < chunkSize; k++) {
+    const double y = scale * x[k] + shift;
+    s[k] = (y < upperKnot - y) ? y : upperKnot - y;
+  }
+
+  for (size_t j = 0; j <= p / 2; j++) {
+    const double jDbl = static_cast<double>(j);
+
+#pragma omp simd
+    for (size_t k = 0; k < chunkSize; k++) {
+      u[k] = (s[k] > jDbl) ? s[k] - jDbl : 0.0;
+      power[k] = u[k];
+    }
+
+    for (size_t q = 1; q < p; q++) {
+#pragma omp simd
+      for (size_t k = 0; k < chunkSize; k++) {
+        power[k] *= u[k];
+      }
+    }
+
+#pragma omp simd
+    for (size_t k = 0; k < chunkSize; k++) {
+      value[k] += weight * coefficients[j] * power[k];
+    }
+  }
+}
+
+}  // namespace
+
+OperationMultiEvalStreamingBSpline::OperationMultiEvalStreamingBSpline(base::Grid& grid,
+                                                                       size_t degree,
+                                                                       base::DataMatrix& dataset)
+    : OperationMultipleEval(grid, dataset),
+      storage(grid.getStorage()),
+      degree(degree),
+      isModified(grid.getType() == base::GridType::ModBspline),
+      dims(grid.getStorage().getDimension()),
+      numberOfPoints(dataset.getNrows()),
+      numberOfChunks((dataset.getNrows() + STREAMING_BSPLINE_CHUNK_DATA_POINTS - 1) /
+                     STREAMING_BSPLINE_CHUNK_DATA_POINTS),
+      preparedGridSize(0),
+      myTimer_(base::SGppStopwatch()),
+      duration(-1.0) {
+  // same degree as used by BsplineBasis
+  if (this->degree < 1) {
+    this->degree = 1;
+  } else if (this->degree % 2 == 0) {
+    this->degree--;
+  }
+
+  // b_p(x) = 1/p! * sum_{j=0}^{p+1} (-1)^j binom(p+1, j) max(x-j, 0)^p,
+  // due to symmetry only the first terms are needed for x <= (p+1)/2
+  double binomial = 1.0;
+  double factorial = 1.0;
+
+  for (size_t q = 2; q <= this->degree; q++) {
+    factorial *= static_cast<double>(q);
+  }
+
+  for (size_t j = 0; j <= this->degree / 2; j++) {
+    coefficients.push_back(((j % 2 == 0) ? binomial : -binomial) / factorial);
+    binomial = binomial * static_cast<double>(this->degree + 1 - j) / static_cast<double>(j + 1);
+  }
+
+  prepareDataset();
+  prepare();
+}
+
+OperationMultiEvalStreamingBSpline::~OperationMultiEvalStreamingBSpline() {}
+
+void OperationMultiEvalStreamingBSpline::prepareDataset() {
+  const size_t chunkSize = STREAMING_BSPLINE_CHUNK_DATA_POINTS;
+  base::DataMatrix pointsInUnitCube(dataset);
+  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+
+  // sort the data points along a Z-order curve to get compact bounding boxes of the chunks
+  const size_t sortedDims = std::min<size_t>(dims, 64);
+  const size_t bitsPerDim = (sortedDims == 0) ? 0 : std::min<size_t>(64 / sortedDims, 16);
+  const double maxQuantized = static_cast<double>((static_cast<uint64_t>(1) << bitsPerDim) - 1);
+  std::vector<uint64_t> keys(numberOfPoints, 0);
+  std::vector<uint64_t> quantized(sortedDims);
+
+  for (size_t j = 0; j < numberOfPoints; j++) {
+    for (size_t t = 0; t < sortedDims; t++) {
+      const double x = std::max(std::min(pointsInUnitCube.get(j, t), 1.0), 0.0);
+      quantized[t] = static_cast<uint64_t>(x * maxQuantized);
+    }
+
+    for (size_t bit = bitsPerDim; bit-- > 0;) {
+      for (size_t t = 0; t < sortedDims; t++) {
+        keys[j] = (keys[j] << 1) | ((quantized[t] >> bit) & 1);
+      }
+    }
+  }
+
+  permutation.resize(numberOfPoints);
+
+  for (size_t j = 0; j < numberOfPoints; j++) {
+    permutation[j] = j;
+  }
+
+  std::stable_sort(permutation.begin(), permutation.end(),
+                   [&keys](size_t j1, size_t j2) { return keys[j1] < keys[j2]; });
+
+  // chunk the sorted data points, the padding repeats the last point of the chunk
+  chunkedData.assign(numberOfChunks * dims * chunkSize, 0.0);
+  chunkLower.assign(numberOfChunks * dims, std::numeric_limits<double>::infinity());
+  chunkUpper.assign(numberOfChunks * dims, -std::numeric_limits<double>::infinity());
+
+  for (size_t c = 0; c < numberOfChunks; c++) {
+    const size_t chunkEnd = std::min((c + 1) * chunkSize, numberOfPoints);
+
+    for (size_t t = 0; t < dims; t++) {
+      double* chunkDataDim = &chunkedData[(c * dims + t) * chunkSize];
+
+      for (size_t k = 0; k < chunkSize; k++) {
+        const size_t j = std::min(c * chunkSize + k, chunkEnd - 1);
+        const double x = pointsInUnitCube.get(permutation[j], t);
+        chunkDataDim[k] = x;
+        chunkLower[c * dims + t] = std::min(chunkLower[c * dims + t], x);
+        chunkUpper[c * dims + t] = std::max(chunkUpper[c * dims + t], x);
+      }
+    }
+  }
+
+  chunkedSource.assign(numberOfChunks * chunkSize, 0.0);
+}
+
+void OperationMultiEvalStreamingBSpline::prepare() {
+  const size_t gridSize = storage.getSize();
+  preparedGridSize = gridSize;
+  const double center = static_cast<double>(degree + 1) / 2.0;
+  const size_t modifiedTerms = (degree + 1) / 2 + 1;
+  base::GridPoint::level_type l;
+  base::GridPoint::index_type i;
+
+  basisParameters.resize(gridSize * dims);
+
+  for (size_t k = 0; k < gridSize; k++) {
+    const base::GridPoint& gp = storage.getPoint(k);
+
+    for (size_t t = 0; t < dims; t++) {
+      BasisParameters1D& parameters = basisParameters[k * dims + t];
+      gp.get(t, l, i);
+      const base::GridPoint::index_type hInv = static_cast<base::GridPoint::index_type>(1) << l;
+      const double hInvDbl = static_cast<double>(hInv);
+
+      if (isModified && (l == 1)) {
+        // constant function
+        parameters.scale = 0.0;
+        parameters.shift = 0.0;
+        parameters.lower = -std::numeric_limits<double>::infinity();
+        parameters.upper = std::numeric_limits<double>::infinity();
+        parameters.terms = 0;
+        continue;
+      } else if (isModified && (i == 1)) {
+        // modified B-spline as linear combination of the B-spline and the
+        // B-splines of the omitted points at and beyond the boundary
+        parameters.scale = hInvDbl;
+        parameters.shift = center - 1.0;
+        parameters.terms = modifiedTerms;
+      } else if (isModified && (i == hInv - 1)) {
+        // mirrored situation at x = 0.5
+        parameters.scale = -hInvDbl;
+        parameters.shift = hInvDbl + center - 1.0;
+        parameters.terms = modifiedTerms;
+      } else {
+        parameters.scale = hInvDbl;
+        parameters.shift = center - static_cast<double>(i);
+        parameters.terms = 1;
+      }
+
+      // support of the summed B-splines is (-(terms - 1), p + 1) after the transformation
+      const double x1 =
+          (-static_cast<double>(parameters.terms - 1) - parameters.shift) / parameters.scale;
+      const double x2 = (static_cast<double>(degree + 1) - parameters.shift) / parameters.scale;
+      parameters.lower = std::min(x1, x2);
+      parameters.upper = std::max(x1, x2);
+    }
+  }
+}
+
+inline bool OperationMultiEvalStreamingBSpline::intersects(size_t gridPoint, size_t chunk) const {
+  const BasisParameters1D* parameters = &basisParameters[gridPoint * dims];
+  const double* lower = &chunkLower[chunk * dims];
+  const double* upper = &chunkUpper[chunk * dims];
+
+  for (size_t t = 0; t < dims; t++) {
+    if ((parameters[t].upper <= lower[t]) || (parameters[t].lower >= upper[t])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+inline void OperationMultiEvalStreamingBSpline::evalChunk(const BasisParameters1D& parameters,
+                                                          const double* x,
+                                                          double* value) const {
+  for (size_t k = 0; k < STREAMING_BSPLINE_CHUNK_DATA_POINTS; k++) {
+    value[k] = 0.0;
+  }
+
+  for (size_t term = 0; term < parameters.terms; term++) {
+    const double weight = static_cast<double>(term + 1);
+    const double shift = parameters.shift + static_cast<double>(term);
+
+    switch (degree) {
+      case 1:
+        addCardinalBSpline<1>(coefficients.data(), parameters.scale, shift, weight, x, value);
+        break;
+      case 3:
+        addCardinalBSpline<3>(coefficients.data(), parameters.scale, shift, weight, x, value);
+        break;
+      case 5:
+        addCardinalBSpline<5>(coefficients.data(), parameters.scale, shift, weight, x, value);
+        break;
+      case 7:
+        addCardinalBSpline<7>(coefficients.data(), parameters.scale, shift, weight, x, value);
+        break;
+      default:
+        addCardinalBSpline(degree, coefficients.data(), parameters.scale, shift, weight, x,
+                           value);
+    }
+  }
+}
+
+void OperationMultiEvalStreamingBSpline::mult(base::DataVector& alpha,
+                                              base::DataVector& result) {
+  const size_t chunkSize = STREAMING_BSPLINE_CHUNK_DATA_POINTS;
+  checkGridSize();
+  const size_t gridSize = preparedGridSize;
+
+  myTimer_.start();
+
+#pragma omp parallel
+  {
+    alignas(64) double chunkResult[STREAMING_BSPLINE_CHUNK_DATA_POINTS];
+    alignas(64) double product[STREAMING_BSPLINE_CHUNK_DATA_POINTS];
+    alignas(64) double value[STREAMING_BSPLINE_CHUNK_DATA_POINTS];
+
+#pragma omp for schedule(dynamic)
+    for (size_t c = 0; c < numberOfChunks; c++) {
+      const double* chunkData = &chunkedData[c * dims * chunkSize];
+
+      for (size_t k = 0; k < chunkSize; k++) {
+        chunkResult[k] = 0.0;
+      }
+
+      for (size_t i = 0; i < gridSize; i++) {
+        if (!intersects(i, c)) {
+          continue;
+        }
+
+        const BasisParameters1D* parameters = &basisParameters[i * dims];
+        const double alphaValue = alpha[i];
+
+        for (size_t k = 0; k < chunkSize; k++) {
+          product[k] = alphaValue;
+        }
+
+        for (size_t t = 0; t < dims; t++) {
+          if (parameters[t].terms == 0) {
+            continue;
+          }
+
+          evalChunk(parameters[t], &chunkData[t * chunkSize], value);
+
+#pragma omp simd
+          for (size_t k = 0; k < chunkSize; k++) {
+            product[k] *= value[k];
+          }
+        }
+
+#pragma omp simd
+        for (size_t k = 0; k < chunkSize; k++) {
+          chunkResult[k] += product[k];
+        }
+      }
+
+      const size_t chunkEnd = std::min((c + 1) * chunkSize, numberOfPoints);
+
+      for (size_t j = c * chunkSize; j < chunkEnd; j++) {
+        result[permutation[j]] = chunkResult[j - c * chunkSize];
+      }
+    }
+  }
+
+  duration = myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingBSpline::multTranspose(base::DataVector& source,
+                                                       base::DataVector& result) {
+  const size_t chunkSize = STREAMING_BSPLINE_CHUNK_DATA_POINTS;
+  checkGridSize();
+  const size_t gridSize = preparedGridSize;
+
+  myTimer_.start();
+
+  // padding lanes have zero weight
+  for (size_t j = 0; j < numberOfPoints; j++) {
+    chunkedSource[j] = source[permutation[j]];
+  }
+
+#pragma omp parallel
+  {
+    alignas(64) double product[STREAMING_BSPLINE_CHUNK_DATA_POINTS];
+    alignas(64) double value[STREAMING_BSPLINE_CHUNK_DATA_POINTS];
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t i = 0; i < gridSize; i++) {
+      const BasisParameters1D* parameters = &basisParameters[i * dims];
+      double sum = 0.0;
+
+      for (size_t c = 0; c < numberOfChunks; c++) {
+        if (!intersects(i, c)) {
+          continue;
+        }
+
+        const double* chunkData = &chunkedData[c * dims * chunkSize];
+        const double* chunkSource = &chunkedSource[c * chunkSize];
+
+        for (size_t k = 0; k < chunkSize; k++) {
+          product[k] = chunkSource[k];
+        }
+
+        for (size_t t = 0; t < dims; t++) {
+          if (parameters[t].terms == 0) {
+            continue;
+          }
+
+          evalChunk(parameters[t], &chunkData[t * chunkSize], value);
+
+#pragma omp simd
+          for (size_t k = 0; k < chunkSize; k++) {
+            product[k] *= value[k];
+          }
+        }
+
+#pragma omp simd reduction(+ : sum)
+        for (size_t k = 0; k < chunkSize; k++) {
+          sum += product[k];
+        }
+      }
+
+      result[i] = sum;
+    }
+  }
+
+  duration = myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingBSpline::checkGridSize() const {
+  if (storage.getSize() != preparedGridSize) {
+    throw base::operation_exception(
+        "OperationMultiEvalStreamingBSpline: the grid was changed, prepare() has to be called "
+        "before the next evaluation");
+  }
+}
+
+double OperationMultiEvalStreamingBSpline::getDuration() { return duration; }
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,141 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include "sgpp/base/operation/hash/OperationMultipleEval.hpp"
+#include "sgpp/base/tools/SGppStopwatch.hpp"
+#include "sgpp/globaldef.hpp"
+
+#include <vector>
+
+#ifndef STREAMING_BSPLINE_CHUNK_DATA_POINTS
+#define STREAMING_BSPLINE_CHUNK_DATA_POINTS 32
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Streaming multi-evaluation for B-spline grids (Bspline, ModBspline and BsplineBoundary).
+ *
+ * The data points are sorted along a Z-order curve and split into chunks of
+ * STREAMING_BSPLINE_CHUNK_DATA_POINTS points, which are stored dimension-wise.
+ * For every pair of chunk and grid point, the 1D basis functions are evaluated at all
+ * points of the chunk at once in a branch-free loop (vectorized with OpenMP SIMD,
+ * the vector width is given by the ARCH of the build).
+ * Grid points whose support does not intersect the bounding box of a chunk
+ * are skipped.
+ */
+class OperationMultiEvalStreamingBSpline : public base::OperationMultipleEval {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid      sparse grid (Bspline, ModBspline or BsplineBoundary)
+   * @param degree    B-spline degree of the grid
+   * @param dataset   data points (one point per row)
+   */
+  OperationMultiEvalStreamingBSpline(base::Grid& grid, size_t degree, base::DataMatrix& dataset);
+
+  ~OperationMultiEvalStreamingBSpline() override;
+
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+  void multTranspose(base::DataVector& source, base::DataVector& result) override;
+
+  /**
+   * Updates the grid-dependent data structures, has to be called if the grid was changed
+   * (mult and multTranspose throw an operation_exception if the grid size differs).
+   */
+  void prepare() override;
+
+  double getDuration() override;
+
+ protected:
+  /**
+   * Parameters of the 1D basis function of a grid point in one dimension.
+   * The basis function is given by
+   * \f$x \mapsto \sum_{k=0}^{\mathrm{terms}-1} (k+1) b_p(\mathrm{scale} \cdot x +
+   * \mathrm{shift} + k)\f$ with the cardinal B-spline \f$b_p\f$,
+   * or it is constant one if terms is zero.
+   */
+  struct BasisParameters1D {
+    /// factor of the affine transformation to the knots of the cardinal B-spline
+    double scale;
+    /// offset of the affine transformation to the knots of the cardinal B-spline
+    double shift;
+    /// lower bound of the support
+    double lower;
+    /// upper bound of the support
+    double upper;
+    /// number of summed B-splines (more than one for modified boundary functions)
+    size_t terms;
+  };
+
+  /**
+   * Sorts, transforms and chunks the data points.
+   */
+  void prepareDataset();
+
+  /**
+   * @param gridPoint   sequence number of the grid point
+   * @param chunk       number of the chunk
+   * @return            whether the support of the grid point intersects the bounding box
+   *                    of the chunk
+   */
+  inline bool intersects(size_t gridPoint, size_t chunk) const;
+
+  /**
+   * Evaluates a 1D basis function at all points of a chunk.
+   *
+   * @param parameters  parameters of the basis function
+   * @param x           coordinates of the points of the chunk
+   * @param[out] value  function values
+   */
+  inline void evalChunk(const BasisParameters1D& parameters, const double* x, double* value) const;
+
+  /**
+   * Throws an operation_exception if the size of the grid changed since the last call
+   * of prepare(), as the basis function parameters would be out of date.
+   */
+  void checkGridSize() const;
+
+  /// storage of the sparse grid
+  base::GridStorage& storage;
+  /// B-spline degree
+  size_t degree;
+  /// whether the grid is a ModBspline grid
+  bool isModified;
+  /// number of dimensions
+  size_t dims;
+  /// number of data points
+  size_t numberOfPoints;
+  /// number of chunks
+  size_t numberOfChunks;
+  /// coefficients of the truncated powers of the cardinal B-spline
+  std::vector<double> coefficients;
+  /// number of grid points when prepare() was called last
+  size_t preparedGridSize;
+  /// basis function parameters, stored grid point after grid point
+  std::vector<BasisParameters1D> basisParameters;
+  /// sequence number of the data point in the original dataset for all sorted data points
+  std::vector<size_t> permutation;
+  /// coordinates of the sorted data points, stored chunk after chunk and dimension after dimension
+  std::vector<double> chunkedData;
+  /// lower corners of the bounding boxes of the chunks
+  std::vector<double> chunkLower;
+  /// upper corners of the bounding boxes of the chunks
+  std::vector<double> chunkUpper;
+  /// sorted and padded source vector of multTranspose
+  std::vector<double> chunkedSource;
+  /// timer object to handle time measurements
+  base::SGppStopwatch myTimer_;
+  /// duration of the last operation
+  double duration;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -60,6 +60,8 @@ void OperationInverseRosenblattTransformationBsplineBoundary::doTransformation(
 // 3. for every sample do...
 #pragma omp parallel
   {
+    base::DataVector cdfs1d(num_dims);
+    base::DataVector coords1d(num_dims);
 #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < pointscdf->getNrows(); i++) {
       // transform the point in the current dimension
@@ -69,9 +71,6 @@ void OperationInverseRosenblattTransformationBsplineBoundary::doTransformation(
       points->set(i, idim, y);
 
       // prepare the next dimensions -> read samples
-      base::DataVector cdfs1d(num_dims);
-      base::DataVector coords1d(num_dims);
-
       pointscdf->getRow(i, cdfs1d);
       points->getRow(i, coords1d);
       doTransformation_start_dimX(this->grid, alpha, idim, &cdfs1d, &coords1d);
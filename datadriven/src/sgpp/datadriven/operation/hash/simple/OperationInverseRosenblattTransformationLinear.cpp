@@ -61,6 +61,8 @@ void OperationInverseRosenblattTransformationLinear::doTransformation(base::Data
 // 3. for every sample do...
 #pragma omp parallel
   {
+    base::DataVector cdfs1d(num_dims);
+    base::DataVector coords1d(num_dims);
 #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < pointscdf->getNrows(); i++) {
       // transform the point in the current dimension
@@ -70,9 +72,6 @@ void OperationInverseRosenblattTransformationLinear::doTransformation(base::Data
       points->set(i, idim, y);
 
       // prepare the next dimensions -> read samples
-      base::DataVector cdfs1d(num_dims);
-      base::DataVector coords1d(num_dims);
-
       pointscdf->getRow(i, cdfs1d);
       points->getRow(i, coords1d);
       doTransformation_start_dimX(this->grid, alpha, idim, &cdfs1d, &coords1d);
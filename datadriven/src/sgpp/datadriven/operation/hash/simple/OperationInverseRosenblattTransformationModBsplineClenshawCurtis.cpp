@@ -60,6 +60,8 @@ void OperationInverseRosenblattTransformationModBsplineClenshawCurtis::doTransfo
 // 3. for every sample do...
 // #pragma omp parallel
   // {
+    base::DataVector cdfs1d(num_dims);
+    base::DataVector coords1d(num_dims);
 // #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < pointscdf->getNrows(); i++) {
       // transform the point in the current dimension
@@ -69,9 +71,6 @@ void OperationInverseRosenblattTransformationModBsplineClenshawCurtis::doTransfo
       points->set(i, idim, y);
 
       // prepare the next dimensions -> read samples
-      base::DataVector cdfs1d(num_dims);
-      base::DataVector coords1d(num_dims);
-
       pointscdf->getRow(i, cdfs1d);
       points->getRow(i, coords1d);
       doTransformation_start_dimX(this->grid, alpha, idim, &cdfs1d, &coords1d);
@@ -98,15 +97,14 @@ void OperationInverseRosenblattTransformationModBsplineClenshawCurtis::doTransfo
 
 // #pragma omp parallel
   // {
+    base::DataVector cdfs1d(pointscdf->getNcols());
+    base::DataVector coords1d(points->getNcols());
 // #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < pointscdf->getNrows(); i++) {
       // 2. 1D transformation on dim_start
       double y = doTransformation1D(g1d, a1d, pointscdf->get(i, dim_start));
       points->set(i, dim_start, y);
       // 3. for every missing dimension do...
-      base::DataVector cdfs1d(pointscdf->getNcols());
-      base::DataVector coords1d(points->getNcols());
-
       pointscdf->getRow(i, cdfs1d);
       points->getRow(i, coords1d);
       doTransformation_start_dimX(this->grid, alpha, dim_start, &cdfs1d, &coords1d);
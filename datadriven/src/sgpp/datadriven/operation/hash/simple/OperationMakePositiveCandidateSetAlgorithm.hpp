@@ -12,6 +12,7 @@
 
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace sgpp {
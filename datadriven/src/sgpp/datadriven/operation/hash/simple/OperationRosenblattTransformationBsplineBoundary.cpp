@@ -62,6 +62,8 @@ void OperationRosenblattTransformationBsplineBoundary::doTransformation(
 // 3. for every sample do...
 #pragma omp parallel
   {
+    base::DataVector cdfs1d(num_dims);
+    base::DataVector coords1d(num_dims);
 #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < points->getNrows(); i++) {
       // transform the point in the current dimension
@@ -71,9 +73,6 @@ void OperationRosenblattTransformationBsplineBoundary::doTransformation(
       pointscdf->set(i, idim, y);
 
       // prepare the next dimensions -> read samples
-      base::DataVector cdfs1d(num_dims);
-      base::DataVector coords1d(num_dims);
-
       points->getRow(i, coords1d);
       pointscdf->getRow(i, cdfs1d);
       doTransformation_start_dimX(this->grid, alpha, idim, &coords1d, &cdfs1d);
@@ -0,0 +1,195 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/BinaryDatasetTools.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// magic number at the beginning of binary dataset files
+const char BINARY_DATASET_MAGIC[8] = {'S', 'G', 'P', 'P', 'D', 'A', 'T', 'A'};
+/// byte order mark to detect files written on machines with different endianness
+const uint32_t BINARY_DATASET_BYTE_ORDER_MARK = 0x01020304;
+/// version of the binary dataset format
+const uint32_t BINARY_DATASET_VERSION = 1;
+
+/**
+ * Header of binary dataset files, followed by the samples and the targets.
+ */
+struct BinaryDatasetHeader {
+  char magic[8];
+  uint32_t byteOrderMark;
+  uint32_t version;
+  uint64_t numberInstances;
+  uint64_t dimension;
+  uint32_t valueSize;
+  uint32_t hasTargets;
+};
+
+/// rounds up to the next multiple of 8 bytes
+inline uint64_t alignBinaryOffset(uint64_t offset) {
+  return (offset + 7) & ~static_cast<uint64_t>(7);
+}
+
+/// writes zeros to the stream until the offset is a multiple of 8 bytes
+void writeBinaryPadding(std::ostream& ostr, uint64_t offset) {
+  const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  ostr.write(zeros, static_cast<std::streamsize>(alignBinaryOffset(offset) - offset));
+}
+
+/// writes the values as doubles or floats
+void writeBinaryValues(std::ostream& ostr, const double* values, size_t count,
+                       bool singlePrecision) {
+  if (singlePrecision) {
+    std::vector<float> converted(values, values + count);
+    ostr.write(reinterpret_cast<const char*>(converted.data()),
+               static_cast<std::streamsize>(count * sizeof(float)));
+  } else {
+    ostr.write(reinterpret_cast<const char*>(values),
+               static_cast<std::streamsize>(count * sizeof(double)));
+  }
+}
+
+}  // namespace
+
+void BinaryDatasetTools::writeBinary(const Dataset& dataset, const std::string& filename,
+                                     bool hasTargets, bool singlePrecision) {
+  std::ofstream ostr(filename.c_str(), std::ios::binary);
+
+  if (!ostr.is_open()) {
+    std::string msg = "Unable to open file: " + filename;
+    throw sgpp::base::file_exception(msg.c_str());
+  }
+
+  BinaryDatasetHeader header;
+  std::memcpy(header.magic, BINARY_DATASET_MAGIC, sizeof(header.magic));
+  header.byteOrderMark = BINARY_DATASET_BYTE_ORDER_MARK;
+  header.version = BINARY_DATASET_VERSION;
+  header.numberInstances = dataset.getNumberInstances();
+  header.dimension = dataset.getDimension();
+  header.valueSize = static_cast<uint32_t>(singlePrecision ? sizeof(float) : sizeof(double));
+  header.hasTargets = hasTargets ? 1 : 0;
+
+  const uint64_t numberValues = header.numberInstances * header.dimension;
+  uint64_t offset = sizeof(header);
+
+  ostr.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  writeBinaryPadding(ostr, offset);
+  offset = alignBinaryOffset(offset);
+
+  writeBinaryValues(ostr, dataset.getData().data(), numberValues, singlePrecision);
+  offset += numberValues * header.valueSize;
+
+  if (hasTargets) {
+    writeBinaryPadding(ostr, offset);
+    writeBinaryValues(ostr, dataset.getTargets().data(), header.numberInstances,
+                      singlePrecision);
+  }
+
+  if (!ostr.good()) {
+    std::string msg = "Unable to write file: " + filename;
+    throw sgpp::base::file_exception(msg.c_str());
+  }
+}
+
+BinaryDatasetInfo BinaryDatasetTools::readBinaryHeader(const char* data, size_t size) {
+  BinaryDatasetHeader header;
+
+  if (size < sizeof(header)) {
+    throw sgpp::base::file_exception("BinaryDatasetTools::readBinaryHeader : data too short");
+  }
+
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, BINARY_DATASET_MAGIC, sizeof(header.magic)) != 0) {
+    throw sgpp::base::file_exception(
+        "BinaryDatasetTools::readBinaryHeader : not a binary dataset file");
+  } else if (header.byteOrderMark != BINARY_DATASET_BYTE_ORDER_MARK) {
+    throw sgpp::base::file_exception(
+        "BinaryDatasetTools::readBinaryHeader : byte order not supported");
+  } else if (header.version > BINARY_DATASET_VERSION) {
+    throw sgpp::base::file_exception(
+        "BinaryDatasetTools::readBinaryHeader : version not supported");
+  } else if ((header.valueSize != sizeof(float)) && (header.valueSize != sizeof(double))) {
+    throw sgpp::base::file_exception(
+        "BinaryDatasetTools::readBinaryHeader : unsupported size of values");
+  }
+
+  BinaryDatasetInfo info;
+  info.dataOffset = alignBinaryOffset(sizeof(header));
+
+  // check the sizes before multiplying them, since the header might be corrupted
+  if ((header.dimension == 0) || (header.dimension > SIZE_MAX / header.valueSize)) {
+    throw sgpp::base::data_exception("BinaryDatasetTools::readBinaryHeader : invalid dimension");
+  }
+
+  const uint64_t rowSize = header.dimension * header.valueSize;
+
+  if ((size < info.dataOffset) ||
+      (header.numberInstances > (size - info.dataOffset) / rowSize)) {
+    throw sgpp::base::data_exception(
+        "BinaryDatasetTools::readBinaryHeader : number of instances exceeds the data");
+  }
+
+  info.numberInstances = header.numberInstances;
+  info.dimension = header.dimension;
+  info.hasTargets = (header.hasTargets != 0);
+  info.singlePrecision = (header.valueSize == sizeof(float));
+  info.targetsOffset = alignBinaryOffset(info.dataOffset + header.numberInstances * rowSize);
+
+  if (info.hasTargets && ((size < info.targetsOffset) ||
+                          (header.numberInstances >
+                           (size - info.targetsOffset) / header.valueSize))) {
+    throw sgpp::base::data_exception(
+        "BinaryDatasetTools::readBinaryHeader : targets exceed the data");
+  }
+
+  return info;
+}
+
+Dataset BinaryDatasetTools::readBinaryFromFile(const std::string& filename) {
+  sgpp::base::MemoryMappedFile file(filename);
+  const BinaryDatasetInfo info = readBinaryHeader(file.getData(), file.getSize());
+  const size_t numberValues = info.numberInstances * info.dimension;
+
+  Dataset dataset(info.numberInstances, info.dimension);
+
+  if (info.singlePrecision) {
+    const float* values = reinterpret_cast<const float*>(file.getData() + info.dataOffset);
+    std::copy(values, values + numberValues, dataset.getData().data());
+
+    if (info.hasTargets) {
+      const float* targets = reinterpret_cast<const float*>(file.getData() + info.targetsOffset);
+      std::copy(targets, targets + info.numberInstances, dataset.getTargets().data());
+    }
+  } else {
+    std::memcpy(dataset.getData().data(), file.getData() + info.dataOffset,
+                numberValues * sizeof(double));
+
+    if (info.hasTargets) {
+      std::memcpy(dataset.getTargets().data(), file.getData() + info.targetsOffset,
+                  info.numberInstances * sizeof(double));
+    }
+  }
+
+  return dataset;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
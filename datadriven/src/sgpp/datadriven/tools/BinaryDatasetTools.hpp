@@ -0,0 +1,81 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BINARYDATASETTOOLS_HPP
+#define BINARYDATASETTOOLS_HPP
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Layout of a binary dataset file (see BinaryDatasetTools).
+ */
+struct BinaryDatasetInfo {
+  /// number of samples
+  size_t numberInstances;
+  /// dimensionality of the samples
+  size_t dimension;
+  /// whether the file contains targets
+  bool hasTargets;
+  /// whether the values are stored as floats (otherwise doubles)
+  bool singlePrecision;
+  /// offset of the samples (row-major) in bytes
+  size_t dataOffset;
+  /// offset of the targets in bytes
+  size_t targetsOffset;
+};
+
+/**
+ * Class that provides functionality to read and write datasets in a binary format.
+ *
+ * The files consist of a header (magic number, byte order mark, version, number of samples,
+ * dimension, size of the values and whether targets are stored), the samples as contiguous
+ * row-major array of doubles or floats and the targets. All arrays are 8-byte aligned, so the
+ * files can be memory-mapped and accessed in place (see BinaryFileSampleProvider).
+ */
+class BinaryDatasetTools {
+ public:
+  /**
+   * Writes a dataset to a binary file.
+   *
+   * @param dataset the dataset
+   * @param filename name of the file
+   * @param hasTargets whether the targets of the dataset are written
+   * @param singlePrecision whether the values are stored as floats instead of doubles
+   */
+  static void writeBinary(const Dataset& dataset, const std::string& filename,
+                          bool hasTargets = true, bool singlePrecision = false);
+
+  /**
+   * Checks the header of binary dataset and returns the layout of the data.
+   * Throws a file_exception if the data is not a valid binary dataset and a data_exception if
+   * the dimension or the number of instances in the header do not match the size of the data.
+   *
+   * @param data contents of the file (8-byte aligned)
+   * @param size size of the contents in bytes
+   * @return layout of the data
+   */
+  static BinaryDatasetInfo readBinaryHeader(const char* data, size_t size);
+
+  /**
+   * Reads a binary dataset file.
+   *
+   * @param filename name of the file
+   * @return the dataset
+   */
+  static Dataset readBinaryFromFile(const std::string& filename);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* BINARYDATASETTOOLS_HPP */
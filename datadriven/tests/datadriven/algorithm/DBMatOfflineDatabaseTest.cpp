@@ -5,10 +5,15 @@
 
 #include <boost/test/unit_test_suite.hpp>
 #include <boost/test/test_tools.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <iostream>
 #include <cstdio>
+#include <fstream>
+#include <memory>
 #include <string>
+#include <vector>
 
 using sgpp::base::GeneralGridConfiguration;
 using sgpp::base::AdaptivityConfiguration;
@@ -144,4 +149,83 @@ BOOST_AUTO_TEST_CASE(TestOverwriteMatrix) {
   removeDatabase(filepath);
 }
 
+BOOST_AUTO_TEST_CASE(TestLoadMatrixCached) {
+  std::string filepath = createEmptyDatabase();
+  DBMatDatabase database(filepath);
+  sgpp::base::RegularGridConfiguration gridConfig;
+  AdaptivityConfiguration adaptivityConfig;
+  RegularizationConfiguration regularizationConfig;
+  DensityEstimationConfiguration densityEstimationConfig;
+  initializeStandardConfiguration(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig);
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+  densityEstimationConfig.parallelDecomposition_ = true;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+
+  // Decompose and store a matrix
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(gridConfig.dim_));
+  grid->getGenerator().regular(gridConfig.level_);
+  sgpp::datadriven::DBMatOfflineChol offline;
+  offline.interactions = {{0, 1}, {2}};
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+  std::string matrixPath = "tmpmatrixLoadMatrixCached";
+  offline.store(matrixPath);
+
+  // The matrix is stored at an aligned offset after the header
+  const size_t n = offline.getGridSize();
+  std::ifstream stream(matrixPath, std::ifstream::binary | std::ifstream::ate);
+  const size_t fileSize = static_cast<size_t>(stream.tellg());
+  stream.close();
+  BOOST_CHECK_EQUAL((fileSize - n * n * sizeof(double)) %
+      sgpp::datadriven::DBMatOffline::payloadAlignment, 0);
+
+  database.putDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig, matrixPath);
+
+  std::shared_ptr<const sgpp::datadriven::DBMatOffline> loaded = database.loadDataMatrix(
+      gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig);
+  BOOST_CHECK(loaded->interactions == offline.interactions);
+  BOOST_CHECK_EQUAL(loaded->getDecomposedMatrix().getNrows(), n);
+
+  for (size_t i = 0; i < n * n; i++) {
+    BOOST_CHECK_EQUAL(loaded->getDecomposedMatrix()[i], offline.getDecomposedMatrix()[i]);
+  }
+
+  // Later lookups are served from the cache, even after the file was removed, and share the
+  // loaded object, clones are independent of it
+  remove(matrixPath.c_str());
+  std::unique_ptr<sgpp::datadriven::DBMatOffline> copy(loaded->clone());
+  BOOST_CHECK(copy->getDecompositionType() == sgpp::datadriven::MatrixDecompositionType::Chol);
+  copy->getDecomposedMatrix().setAll(0.0);
+  DBMatDatabase otherDatabase(filepath);
+  std::shared_ptr<const sgpp::datadriven::DBMatOffline> cached = otherDatabase.loadDataMatrix(
+      gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig);
+  BOOST_CHECK_EQUAL(cached.get(), loaded.get());
+
+  for (size_t i = 0; i < n * n; i++) {
+    BOOST_CHECK_EQUAL(cached->getDecomposedMatrix()[i], offline.getDecomposedMatrix()[i]);
+  }
+
+  // The cache does not keep the object alive: once all callers released it, the file is read
+  // again (which fails, as it was removed)
+  std::weak_ptr<const sgpp::datadriven::DBMatOffline> released = loaded;
+  loaded.reset();
+  BOOST_CHECK(!released.expired());
+  cached.reset();
+  BOOST_CHECK(released.expired());
+  BOOST_CHECK_THROW(database.loadDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig), sgpp::base::factory_exception);
+
+  // Cleared entries are not shared with later lookups, even if they are still held
+  offline.store(matrixPath);
+  loaded = database.loadDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig);
+  remove(matrixPath.c_str());
+  DBMatDatabase::clearCache();
+  BOOST_CHECK_THROW(database.loadDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+      densityEstimationConfig), sgpp::base::factory_exception);
+  removeDatabase(filepath);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
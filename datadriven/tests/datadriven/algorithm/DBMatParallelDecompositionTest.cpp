@@ -0,0 +1,360 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatParallelDecomposition.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::algorithm_exception;
+using sgpp::datadriven::DBMatParallelDecomposition;
+
+BOOST_AUTO_TEST_SUITE(DBMatParallelDecompositionTest)
+
+DataMatrix randomMatrix(size_t n, bool symmetric, double diagonalShift) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataMatrix matrix(n, n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      matrix.set(i, j, distribution(generator));
+    }
+  }
+
+  if (symmetric) {
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < i; j++) {
+        matrix.set(j, i, matrix.get(i, j));
+      }
+
+      matrix.set(i, i, matrix.get(i, i) + diagonalShift);
+    }
+  }
+
+  return matrix;
+}
+
+double maxDifference(const DataMatrix& a, const DataMatrix& b) {
+  double result = 0.0;
+
+  for (size_t i = 0; i < a.getSize(); i++) {
+    result = std::max(result, std::abs(a[i] - b[i]));
+  }
+
+  return result;
+}
+
+BOOST_AUTO_TEST_CASE(testCholesky) {
+  const size_t n = 150;
+  // diagonally dominant => positive definite
+  const DataMatrix matrix = randomMatrix(n, true, static_cast<double>(n));
+
+  // block size that does not divide n
+  DataMatrix l(matrix);
+  DBMatParallelDecomposition::cholesky(l, 16);
+
+  DataMatrix product(n, n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double s = 0.0;
+
+      for (size_t k = 0; k < n; k++) {
+        s += l.get(i, k) * l.get(j, k);
+      }
+
+      product.set(i, j, s);
+
+      if (j > i) {
+        BOOST_CHECK_EQUAL(l.get(i, j), 0.0);
+      }
+    }
+  }
+
+  BOOST_CHECK_SMALL(maxDifference(product, matrix), 1e-10);
+
+  // unblocked variant
+  DataMatrix lUnblocked(matrix);
+  DBMatParallelDecomposition::cholesky(lUnblocked, n);
+  BOOST_CHECK_SMALL(maxDifference(l, lUnblocked), 1e-12);
+
+  DataMatrix indefinite = randomMatrix(n, true, -static_cast<double>(n));
+  BOOST_CHECK_THROW(DBMatParallelDecomposition::cholesky(indefinite), algorithm_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testCholeskyUpdate) {
+  const size_t n = 100;
+  const size_t k = 7;
+  const DataMatrix matrix = randomMatrix(n, true, static_cast<double>(n));
+  DataMatrix updates = randomMatrix(n, false, 0.0);
+  updates.resizeRowsCols(n, k);
+
+  // some update vectors start with zeros (as after the permutations during coarsening)
+  for (size_t i = 0; i < 20; i++) {
+    updates.set(i, 0, 0.0);
+  }
+
+  DataMatrix updated(matrix);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double s = 0.0;
+
+      for (size_t m = 0; m < k; m++) {
+        s += updates.get(i, m) * updates.get(j, m);
+      }
+
+      updated.set(i, j, updated.get(i, j) + s);
+    }
+  }
+
+  DataMatrix l(matrix);
+  DBMatParallelDecomposition::cholesky(l);
+  DBMatParallelDecomposition::choleskyUpdate(l, updates, 16);
+
+  DataMatrix reference(updated);
+  DBMatParallelDecomposition::cholesky(reference);
+  BOOST_CHECK_SMALL(maxDifference(l, reference), 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(testCholeskyAppendRows) {
+  const size_t n = 120;
+  const size_t size = 90;
+  const size_t k = n - size;
+  const DataMatrix matrix = randomMatrix(n, true, static_cast<double>(n));
+
+  // factor of the leading block, padded with zeros
+  DataMatrix l(matrix);
+  l.resizeQuadratic(size);
+  DBMatParallelDecomposition::cholesky(l);
+  l.resizeQuadratic(n);
+
+  DataMatrix newRows(k, n);
+
+  for (size_t m = 0; m < k; m++) {
+    for (size_t j = 0; j < n; j++) {
+      newRows.set(m, j, matrix.get(size + m, j));
+    }
+  }
+
+  DBMatParallelDecomposition::choleskyAppendRows(l, size, newRows, 16);
+
+  DataMatrix reference(matrix);
+  DBMatParallelDecomposition::cholesky(reference);
+  BOOST_CHECK_SMALL(maxDifference(l, reference), 1e-10);
+
+  // not positive definite
+  for (size_t m = 0; m < k; m++) {
+    newRows.set(m, size + m, -1.0);
+  }
+
+  BOOST_CHECK_THROW(DBMatParallelDecomposition::choleskyAppendRows(l, size, newRows),
+                    algorithm_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testLU) {
+  const size_t n = 130;
+  const DataMatrix matrix = randomMatrix(n, false, 0.0);
+
+  DataMatrix lu(matrix);
+  std::vector<size_t> permutation;
+  DBMatParallelDecomposition::lu(lu, permutation, 16);
+
+  BOOST_CHECK_EQUAL(permutation.size(), n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      // (L * U)_ij with unit lower triangular L
+      double s = (i <= j) ? lu.get(i, j) : 0.0;
+
+      for (size_t k = 0; k < std::min(i, j + 1); k++) {
+        s += lu.get(i, k) * lu.get(k, j);
+      }
+
+      BOOST_CHECK_SMALL(s - matrix.get(permutation[i], j), 1e-10);
+    }
+  }
+
+  // the blocked variant applies the updates in the same order as the unblocked one
+  DataMatrix luUnblocked(matrix);
+  std::vector<size_t> permutationUnblocked;
+  DBMatParallelDecomposition::lu(luUnblocked, permutationUnblocked, n);
+
+  BOOST_CHECK(permutation == permutationUnblocked);
+  BOOST_CHECK_EQUAL(maxDifference(lu, luUnblocked), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(testTridiagonalize) {
+  const size_t n = 70;
+  const DataMatrix matrix = randomMatrix(n, true, 0.0);
+
+  DataMatrix work(matrix);
+  DataMatrix q;
+  DataVector diag;
+  DataVector subdiag;
+  DBMatParallelDecomposition::tridiagonalize(work, q, diag, subdiag);
+
+  BOOST_CHECK_EQUAL(diag.getSize(), n);
+  BOOST_CHECK_EQUAL(subdiag.getSize(), n - 1);
+
+  // Q * T
+  DataMatrix qt(n, n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double s = q.get(i, j) * diag[j];
+
+      if (j > 0) {
+        s += q.get(i, j - 1) * subdiag[j - 1];
+      }
+
+      if (j + 1 < n) {
+        s += q.get(i, j + 1) * subdiag[j];
+      }
+
+      qt.set(i, j, s);
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double qtq = 0.0;
+      double qq = 0.0;
+
+      for (size_t k = 0; k < n; k++) {
+        qtq += qt.get(i, k) * q.get(j, k);
+        qq += q.get(i, k) * q.get(j, k);
+      }
+
+      BOOST_CHECK_SMALL(qtq - matrix.get(i, j), 1e-10);
+      BOOST_CHECK_SMALL(qq - ((i == j) ? 1.0 : 0.0), 1e-12);
+    }
+  }
+
+  // tridiagonal matrices are not changed
+  DataMatrix tridiagonal(n, n, 0.0);
+
+  for (size_t i = 0; i < n; i++) {
+    tridiagonal.set(i, i, static_cast<double>(i) + 1.0);
+
+    if (i + 1 < n) {
+      tridiagonal.set(i, i + 1, -1.0);
+      tridiagonal.set(i + 1, i, -1.0);
+    }
+  }
+
+  DBMatParallelDecomposition::tridiagonalize(tridiagonal, q, diag, subdiag);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_EQUAL(diag[i], static_cast<double>(i) + 1.0);
+    BOOST_CHECK_EQUAL(q.get(i, i), 1.0);
+
+    if (i + 1 < n) {
+      BOOST_CHECK_EQUAL(subdiag[i], -1.0);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOfflineCholParallel) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 4;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.1;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.type_ = sgpp::datadriven::DensityEstimationType::Decomposition;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+  densityEstimationConfig.parallelDecomposition_ = true;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(gridConfig.dim_));
+  grid->getGenerator().regular(gridConfig.level_);
+
+  sgpp::datadriven::DBMatOfflineChol offline;
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  const DataMatrix matrix = offline.getLhsMatrix_ONLY_FOR_TESTING();
+  offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  const DataMatrix& l = offline.getDecomposedMatrix();
+  const size_t n = matrix.getNrows();
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j <= i; j++) {
+      double s = 0.0;
+
+      for (size_t k = 0; k <= j; k++) {
+        s += l.get(i, k) * l.get(j, k);
+      }
+
+      BOOST_CHECK_SMALL(s - matrix.get(i, j), 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOfflineCholRefinementBatch) {
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.01;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.type_ = sgpp::datadriven::DensityEstimationType::Decomposition;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+  densityEstimationConfig.parallelDecomposition_ = true;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(3));
+  grid->getGenerator().regular(3);
+
+  sgpp::datadriven::DBMatOfflineChol offline;
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  // refine the grid twice and add all new points as one batch
+  for (size_t step = 0; step < 2; step++) {
+    const size_t oldSize = grid->getSize();
+    DataVector alpha(oldSize);
+
+    for (size_t i = 0; i < oldSize; i++) {
+      alpha[i] = static_cast<double>((i * 7) % 11);
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 5);
+    grid->getGenerator().refine(functor);
+    const size_t newPoints = grid->getSize() - oldSize;
+    BOOST_CHECK(newPoints > 0);
+
+    offline.choleskyModification(*grid, densityEstimationConfig, newPoints, std::list<size_t>(),
+                                 regularizationConfig.lambda_);
+
+    sgpp::datadriven::DBMatOfflineChol reference;
+    reference.buildMatrix(grid.get(), regularizationConfig);
+    reference.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+    BOOST_CHECK_EQUAL(offline.getDecomposedMatrix().getNrows(), grid->getSize());
+    BOOST_CHECK_SMALL(
+        maxDifference(offline.getDecomposedMatrix(), reference.getDecomposedMatrix()), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
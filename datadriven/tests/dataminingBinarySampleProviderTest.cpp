@@ -0,0 +1,198 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * dataminingBinarySampleProviderTest.cpp
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorRandom.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::BinaryDatasetTools;
+using sgpp::datadriven::BinaryFileSampleProvider;
+using sgpp::datadriven::Dataset;
+
+BOOST_AUTO_TEST_SUITE(dataminingBinarySampleProviderTest)
+
+const char* datasetPath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+const char* binaryPath = "dataminingBinarySampleProviderTest.bin";
+
+/**
+ * Reads the liver dataset with the ARFF sample provider.
+ */
+std::unique_ptr<Dataset> readReference(size_t readinCutoff = -1,
+                                       std::vector<size_t> readinColumns = std::vector<size_t>(),
+                                       std::vector<double> readinClasses = std::vector<double>()) {
+  ArffFileSampleProvider referenceProvider;
+  referenceProvider.readFile(datasetPath, true, readinCutoff, readinColumns, readinClasses);
+  return std::unique_ptr<Dataset>(referenceProvider.getAllSamples());
+}
+
+void checkEqual(Dataset& dataset, Dataset& reference, double tolerance) {
+  BOOST_CHECK_EQUAL(dataset.getNumberInstances(), reference.getNumberInstances());
+  BOOST_CHECK_EQUAL(dataset.getDimension(), reference.getDimension());
+
+  for (size_t i = 0; i < reference.getNumberInstances(); i++) {
+    for (size_t t = 0; t < reference.getDimension(); t++) {
+      BOOST_CHECK_SMALL(dataset.getData().get(i, t) - reference.getData().get(i, t), tolerance);
+    }
+
+    BOOST_CHECK_SMALL(dataset.getTargets().get(i) - reference.getTargets().get(i), tolerance);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(binaryTestRoundTrip) {
+  std::unique_ptr<Dataset> reference = readReference();
+
+  for (bool singlePrecision : {false, true}) {
+    const double tolerance = singlePrecision ? 1e-7 : 0.0;
+    BinaryDatasetTools::writeBinary(*reference, binaryPath, true, singlePrecision);
+
+    Dataset dataset = BinaryDatasetTools::readBinaryFromFile(binaryPath);
+    checkEqual(dataset, *reference, tolerance);
+
+    // read in batches, also after a reset
+    BinaryFileSampleProvider sampleProvider;
+    sampleProvider.readFile(binaryPath, true);
+    BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), reference->getNumberInstances());
+    BOOST_CHECK_EQUAL(sampleProvider.getDim(), reference->getDimension());
+
+    for (size_t epoch = 0; epoch < 2; epoch++) {
+      size_t row = 0;
+
+      while (row < reference->getNumberInstances()) {
+        std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(64));
+        BOOST_CHECK(batch->getNumberInstances() > 0);
+
+        for (size_t i = 0; i < batch->getNumberInstances(); i++, row++) {
+          for (size_t t = 0; t < reference->getDimension(); t++) {
+            BOOST_CHECK_SMALL(batch->getData().get(i, t) - reference->getData().get(row, t),
+                              tolerance);
+          }
+
+          BOOST_CHECK_SMALL(batch->getTargets().get(i) - reference->getTargets().get(row),
+                            tolerance);
+        }
+      }
+
+      sampleProvider.reset();
+    }
+
+    // copies share the mapped file
+    std::unique_ptr<sgpp::datadriven::SampleProvider> copy(sampleProvider.clone());
+    std::unique_ptr<Dataset> all(copy->getAllSamples());
+    checkEqual(*all, *reference, tolerance);
+  }
+
+  std::remove(binaryPath);
+}
+
+BOOST_AUTO_TEST_CASE(binaryTestSelection) {
+  std::unique_ptr<Dataset> reference = readReference();
+  BinaryDatasetTools::writeBinary(*reference, binaryPath);
+
+  const std::vector<size_t> columns{2, 0};
+  const std::vector<double> classes{1.0};
+  const size_t cutoff = 100;
+
+  std::unique_ptr<Dataset> selected = readReference(cutoff, columns, classes);
+  BinaryFileSampleProvider sampleProvider;
+  sampleProvider.readFile(binaryPath, true, cutoff, columns, classes);
+  std::unique_ptr<Dataset> dataset(sampleProvider.getAllSamples());
+  checkEqual(*dataset, *selected, 0.0);
+
+  // read from a string
+  std::ifstream file(binaryPath, std::ios::binary);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  BinaryFileSampleProvider stringProvider;
+  stringProvider.readString(contents.str(), true);
+  std::unique_ptr<Dataset> fromString(stringProvider.getAllSamples());
+  checkEqual(*fromString, *reference, 0.0);
+
+  std::remove(binaryPath);
+}
+
+BOOST_AUTO_TEST_CASE(binaryTestShuffling) {
+  std::unique_ptr<Dataset> reference = readReference();
+  BinaryDatasetTools::writeBinary(*reference, binaryPath);
+
+  // the shuffled samples are a permutation of the samples of the file
+  sgpp::datadriven::DataShufflingFunctorRandom shuffling(42);
+  BinaryFileSampleProvider sampleProvider(&shuffling);
+  sampleProvider.readFile(binaryPath, true);
+  std::unique_ptr<Dataset> dataset(sampleProvider.getAllSamples());
+  BOOST_CHECK_EQUAL(dataset->getNumberInstances(), reference->getNumberInstances());
+
+  for (size_t i = 0; i < dataset->getNumberInstances(); i++) {
+    const size_t row = shuffling(i, reference->getNumberInstances());
+
+    for (size_t t = 0; t < reference->getDimension(); t++) {
+      BOOST_CHECK_EQUAL(dataset->getData().get(i, t), reference->getData().get(row, t));
+    }
+  }
+
+  std::remove(binaryPath);
+}
+
+BOOST_AUTO_TEST_CASE(binaryTestInvalidFile) {
+  BinaryFileSampleProvider sampleProvider;
+  BOOST_CHECK_THROW(sampleProvider.readFile(datasetPath, true), sgpp::base::file_exception);
+  BOOST_CHECK_THROW(sampleProvider.getNumSamples(), sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(binaryTestCorruptedHeader) {
+  Dataset dataset(4, 2);
+  dataset.getData().setAll(0.5);
+  dataset.getTargets().setAll(1.0);
+  BinaryDatasetTools::writeBinary(dataset, binaryPath);
+
+  // 8-byte aligned copy of the file
+  std::ifstream file(binaryPath, std::ios::binary);
+  std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  std::vector<uint64_t> buffer((contents.size() + 7) / 8);
+  char* data = reinterpret_cast<char*>(buffer.data());
+  const size_t numberInstancesOffset = 16;
+  const size_t dimensionOffset = 24;
+
+  auto readCorrupted = [&](size_t offset, uint64_t value) {
+    std::memcpy(data, contents.data(), contents.size());
+    std::memcpy(data + offset, &value, sizeof(value));
+    return BinaryDatasetTools::readBinaryHeader(data, contents.size());
+  };
+
+  BOOST_CHECK_EQUAL(readCorrupted(dimensionOffset, 2).numberInstances, 4);
+  BOOST_CHECK_THROW(readCorrupted(dimensionOffset, 0), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(readCorrupted(dimensionOffset, UINT64_MAX / 4), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(readCorrupted(dimensionOffset, 3), sgpp::base::data_exception);
+  // the product with the dimension and the size of the values would overflow
+  BOOST_CHECK_THROW(readCorrupted(numberInstancesOffset, UINT64_MAX / 8 + 2),
+                    sgpp::base::data_exception);
+  BOOST_CHECK_THROW(readCorrupted(numberInstancesOffset, 5), sgpp::base::data_exception);
+
+  std::remove(binaryPath);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
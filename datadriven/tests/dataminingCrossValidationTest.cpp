@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * dataminingCrossValidationTest.cpp
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
+#include <sgpp/datadriven/datamining/builder/LeastSquaresRegressionMinerFactory.hpp>
+
+#include <memory>
+#include <string>
+
+using sgpp::datadriven::LeastSquaresRegressionMinerFactory;
+using sgpp::datadriven::SparseGridMiner;
+
+BOOST_AUTO_TEST_SUITE(test_crossvalidation_miner)
+
+BOOST_AUTO_TEST_CASE(parallelFoldsTest) {
+  // the configurations only differ in the number of concurrently trained folds (2 and 1)
+  const std::string parallelPath = "datadriven/tests/parallel_crossvalidation_test_config.json";
+  const std::string sequentialPath =
+      "datadriven/tests/sequential_crossvalidation_test_config.json";
+  LeastSquaresRegressionMinerFactory factory;
+
+  std::unique_ptr<SparseGridMiner> parallelMiner(factory.buildMiner(parallelPath));
+  std::unique_ptr<SparseGridMiner> sequentialMiner(factory.buildMiner(sequentialPath));
+
+  const double parallelScore = parallelMiner->learn(false);
+  const double sequentialScore = sequentialMiner->learn(false);
+
+  BOOST_CHECK_CLOSE(parallelScore, sequentialScore, 1e-8);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
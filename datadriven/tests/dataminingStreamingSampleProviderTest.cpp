@@ -0,0 +1,145 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * dataminingStreamingSampleProviderTest.cpp
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::DataSourceFileType;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::StreamingFileSampleProvider;
+
+BOOST_AUTO_TEST_SUITE(dataminingStreamingSampleProviderTest)
+
+const double testPoints[10][3] = {{0.307143, 0.130137, 0.050000}, {0.365584, 0.105479, 0.050000},
+                                  {0.178571, 0.201027, 0.050000}, {0.272078, 0.145548, 0.050000},
+                                  {0.318831, 0.065411, 0.050000}, {0.190260, 0.086986, 0.050000},
+                                  {0.190260, 0.062329, 0.072500}, {0.120130, 0.068493, 0.072500},
+                                  {0.225325, 0.056164, 0.072500}, {0.213636, 0.050000, 0.072500}};
+
+const double testValues[10] = {-1., 1., 1., 1., 1., 1., -1., -1., -1., -1.};
+const double tolerance = 1E-5;
+
+/**
+ * Checks that the samples of the small liver dataset are read in batches of three samples
+ * (i.e., across chunk boundaries) in the order of the file, also after a reset.
+ */
+void checkSmallLiverDataset(StreamingFileSampleProvider& sampleProvider) {
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), 3);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), 10);
+
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    size_t row = 0;
+
+    while (row < 10) {
+      std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(3));
+      BOOST_CHECK_EQUAL(batch->getNumberInstances(), std::min<size_t>(3, 10 - row));
+      BOOST_CHECK_EQUAL(batch->getDimension(), 3);
+
+      for (size_t i = 0; i < batch->getNumberInstances(); i++, row++) {
+        for (size_t t = 0; t < 3; t++) {
+          BOOST_CHECK_CLOSE(batch->getData().get(i, t), testPoints[row][t], tolerance);
+        }
+
+        BOOST_CHECK_CLOSE(batch->getTargets().get(i), testValues[row], tolerance);
+      }
+    }
+
+    std::unique_ptr<Dataset> empty(sampleProvider.getNextSamples(3));
+    BOOST_CHECK_EQUAL(empty->getNumberInstances(), 0);
+
+    sampleProvider.reset();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestReadArff) {
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::ARFF, false, 4, 2);
+  sampleProvider.readFile("datadriven/datasets/liver/liver-disorders_normalized_small.arff",
+                          true);
+  checkSmallLiverDataset(sampleProvider);
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestReadCsv) {
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::CSV, false, 4, 2);
+  sampleProvider.readFile("datadriven/datasets/liver/liver-disorders_normalized_small.csv",
+                          true);
+  checkSmallLiverDataset(sampleProvider);
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestCsvHeaderAfterComments) {
+  // the header is the first line that is neither blank nor a comment
+  const std::string input = "\n# generated data\n\nx0,x1,y\n0.1,0.2,1\n# comment\n0.3,0.4,-1\n";
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::CSV, false, 4, 2);
+  sampleProvider.readString(input, true);
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), 2);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), 2);
+
+  std::unique_ptr<Dataset> samples(sampleProvider.getAllSamples());
+  BOOST_CHECK_EQUAL(samples->getNumberInstances(), 2);
+  BOOST_CHECK_CLOSE(samples->getData().get(0, 0), 0.1, tolerance);
+  BOOST_CHECK_CLOSE(samples->getData().get(1, 1), 0.4, tolerance);
+  BOOST_CHECK_CLOSE(samples->getTargets().get(1), -1.0, tolerance);
+}
+
+#ifdef ZLIB
+BOOST_AUTO_TEST_CASE(streamingTestReadGzip) {
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::ARFF, true, 4, 2);
+  sampleProvider.readFile("datadriven/datasets/liver/liver-disorders_normalized_small.arff.gz",
+                          true);
+  checkSmallLiverDataset(sampleProvider);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(streamingTestSelection) {
+  // the streamed samples have to agree with the samples read at once
+  const std::string datasetPath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+  const std::vector<size_t> columns{2, 0};
+  const std::vector<double> classes{1.0};
+  const size_t cutoff = 100;
+
+  ArffFileSampleProvider referenceProvider;
+  referenceProvider.readFile(datasetPath, true, cutoff, columns, classes);
+  std::unique_ptr<Dataset> reference(referenceProvider.getAllSamples());
+
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::ARFF, false, 16, 2);
+  sampleProvider.readFile(datasetPath, true, cutoff, columns, classes);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), reference->getNumberInstances());
+
+  std::unique_ptr<Dataset> first(sampleProvider.getNextSamples(25));
+  std::unique_ptr<Dataset> rest(sampleProvider.getAllSamples());
+  BOOST_CHECK_EQUAL(first->getNumberInstances(), 25);
+  BOOST_CHECK_EQUAL(first->getNumberInstances() + rest->getNumberInstances(),
+                    reference->getNumberInstances());
+  BOOST_CHECK_EQUAL(rest->getDimension(), 2);
+
+  for (size_t i = 0; i < reference->getNumberInstances(); i++) {
+    Dataset& batch = (i < 25) ? *first : *rest;
+    const size_t j = (i < 25) ? i : i - 25;
+
+    for (size_t t = 0; t < 2; t++) {
+      BOOST_CHECK_EQUAL(batch.getData().get(j, t), reference->getData().get(i, t));
+    }
+
+    BOOST_CHECK_EQUAL(batch.getTargets().get(j), reference->getTargets().get(i));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,133 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+
+namespace {
+
+/**
+ * Compares mult and multTranspose of the streaming B-spline multi-evaluation with
+ * the naive multi-evaluation, before and after refining the grid.
+ */
+void compareToNaive(Grid& grid, size_t level) {
+  const size_t dim = grid.getDimension();
+  const size_t numberDataPoints = 250;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  grid.getGenerator().regular(level);
+
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = distribution(generator);
+    }
+  }
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+  std::unique_ptr<OperationMultipleEval> opStreaming(
+      sgpp::op_factory::createOperationMultipleEval(grid, dataset, configuration));
+
+  for (size_t run = 0; run < 2; run++) {
+    if (run == 1) {
+      DataVector refinementAlpha(grid.getSize(), 0.0);
+      refinementAlpha[grid.getSize() / 2] = 1.0;
+      sgpp::base::SurplusRefinementFunctor functor(refinementAlpha, 3);
+      grid.getGenerator().refine(functor);
+
+      // the operation has to be prepared for the refined grid
+      DataVector alphaRefined(grid.getSize());
+      DataVector resultRefined(numberDataPoints);
+      BOOST_CHECK_THROW(opStreaming->mult(alphaRefined, resultRefined),
+                        sgpp::base::operation_exception);
+      BOOST_CHECK_THROW(opStreaming->multTranspose(resultRefined, alphaRefined),
+                        sgpp::base::operation_exception);
+
+      opStreaming->prepare();
+    }
+
+    std::unique_ptr<OperationMultipleEval> opNaive(
+        sgpp::op_factory::createOperationMultipleEvalNaive(grid, dataset));
+
+    DataVector alpha(grid.getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = distribution(generator) - 0.5;
+    }
+
+    DataVector result(numberDataPoints);
+    DataVector resultNaive(numberDataPoints);
+    opStreaming->mult(alpha, result);
+    opNaive->mult(alpha, resultNaive);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      BOOST_CHECK_SMALL(result[i] - resultNaive[i], 1e-10);
+    }
+
+    DataVector source(numberDataPoints);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      source[i] = distribution(generator) - 0.5;
+    }
+
+    DataVector resultTranspose(grid.getSize());
+    DataVector resultTransposeNaive(grid.getSize());
+    opStreaming->multTranspose(source, resultTranspose);
+    opNaive->multTranspose(source, resultTransposeNaive);
+
+    for (size_t i = 0; i < grid.getSize(); i++) {
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeNaive[i], 1e-10);
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestStreamingBSplineMult)
+
+BOOST_AUTO_TEST_CASE(testBspline) {
+  for (size_t degree : {1, 3, 5}) {
+    std::unique_ptr<Grid> grid(Grid::createBsplineGrid(3, degree));
+    compareToNaive(*grid, 4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testModBspline) {
+  for (size_t degree : {1, 3, 5}) {
+    std::unique_ptr<Grid> grid(Grid::createModBsplineGrid(3, degree));
+    compareToNaive(*grid, 4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBsplineBoundary) {
+  for (size_t degree : {1, 3, 5}) {
+    std::unique_ptr<Grid> grid(Grid::createBsplineBoundaryGrid(3, degree));
+    compareToNaive(*grid, 3);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -8,14 +8,18 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/optimization/function/scalar/ScalarFunction.hpp>
 
 #include <cstring>
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -70,6 +74,74 @@ class InterpolantScalarFunction : public ScalarFunction {
     return opEval->eval(alpha, x);
   }
 
+  /**
+   * Evaluation of the function at multiple points.
+   * The points inside the domain are evaluated with one naive multiple
+   * evaluation operation (if available for the grid type), which reuses
+   * the grid traversal for all points; points outside the domain get the
+   * value infinity.
+   *
+   * @param      x      evaluation points \f$\vec{x}_k \in [0, 1]^d\f$
+   *                    (one point per row)
+   * @param[out] value  function values \f$f(\vec{x}_k)\f$
+   */
+  void evalBatch(const base::DataMatrix& x, base::DataVector& value) override {
+    const size_t m = x.getNrows();
+    std::vector<size_t> inDomainRows;
+    inDomainRows.reserve(m);
+    value.resize(m);
+
+    for (size_t k = 0; k < m; k++) {
+      bool inDomain = true;
+
+      for (size_t t = 0; t < d; t++) {
+        if ((x(k, t) < 0.0) || (x(k, t) > 1.0)) {
+          inDomain = false;
+          break;
+        }
+      }
+
+      if (inDomain) {
+        inDomainRows.push_back(k);
+      } else {
+        value[k] = INFINITY;
+      }
+    }
+
+    if (inDomainRows.empty()) {
+      return;
+    }
+
+    base::DataMatrix points(inDomainRows.size(), d);
+    base::DataVector pointValues(inDomainRows.size());
+    base::DataVector xk(d);
+
+    for (size_t i = 0; i < inDomainRows.size(); i++) {
+      x.getRow(inDomainRows[i], xk);
+      points.setRow(i, xk);
+    }
+
+    std::unique_ptr<base::OperationMultipleEval> opMultipleEval;
+
+    try {
+      opMultipleEval.reset(op_factory::createOperationMultipleEvalNaive(grid, points));
+    } catch (const base::factory_exception&) {
+      // no multiple evaluation for this grid type ==> evaluate point by point
+      for (size_t i = 0; i < inDomainRows.size(); i++) {
+        x.getRow(inDomainRows[i], xk);
+        value[inDomainRows[i]] = opEval->eval(alpha, xk);
+      }
+
+      return;
+    }
+
+    opMultipleEval->mult(alpha, pointValues);
+
+    for (size_t i = 0; i < inDomainRows.size(); i++) {
+      value[inDomainRows[i]] = pointValues[i];
+    }
+  }
+
   /**
    * @param[out] clone pointer to cloned object
    */
@@ -7,6 +7,7 @@
 #define SGPP_OPTIMIZATION_FUNCTION_SCALAR_SCALARFUNCTION_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <cstddef>
@@ -42,6 +43,31 @@ class ScalarFunction {
    */
   virtual double eval(const base::DataVector& x) = 0;
 
+  /**
+   * Evaluation of the function at multiple points (batch evaluation).
+   * The default implementation calls eval() for every point; functions
+   * that can evaluate many points more efficiently at once
+   * (e.g., sparse grid interpolants) should override this method.
+   * The method is not required to be thread-safe, parallel optimizers
+   * call it on clones of the function.
+   *
+   * @param      x      evaluation points \f$\vec{x}_k \in [0, 1]^d\f$
+   *                    (one point per row)
+   * @param[out] value  function values \f$f(\vec{x}_k)\f$
+   *                    (resized to the number of points)
+   */
+  virtual void evalBatch(const base::DataMatrix& x, base::DataVector& value) {
+    const size_t m = x.getNrows();
+    base::DataVector xk(d);
+
+    value.resize(m);
+
+    for (size_t k = 0; k < m; k++) {
+      x.getRow(k, xk);
+      value[k] = eval(xk);
+    }
+  }
+
   /**
    * @return dimension \f$d\f$ of the domain
    */
@@ -7,6 +7,7 @@
 #define SGPP_OPTIMIZATION_FUNCTION_SCALAR_SCALARFUNCTIONGRADIENT_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <cstddef>
@@ -47,6 +48,34 @@ class ScalarFunctionGradient {
    */
   virtual double eval(const base::DataVector& x, base::DataVector& gradient) = 0;
 
+  /**
+   * Evaluation of the function and its gradient at multiple points
+   * (batch evaluation).
+   * The default implementation calls eval() for every point.
+   *
+   * @param      x        evaluation points \f$\vec{x}_k \in [0, 1]^d\f$
+   *                      (one point per row)
+   * @param[out] value    function values \f$f(\vec{x}_k)\f$
+   *                      (resized to the number of points)
+   * @param[out] gradient gradients \f$\nabla f(\vec{x}_k)\f$
+   *                      (one gradient per row, resized accordingly)
+   */
+  virtual void evalBatch(const base::DataMatrix& x, base::DataVector& value,
+                         base::DataMatrix& gradient) {
+    const size_t m = x.getNrows();
+    base::DataVector xk(d);
+    base::DataVector gradientK(d);
+
+    value.resize(m);
+    gradient.resize(m, d);
+
+    for (size_t k = 0; k < m; k++) {
+      x.getRow(k, xk);
+      value[k] = eval(xk, gradientK);
+      gradient.setRow(k, gradientK);
+    }
+  }
+
   /**
    * @return dimension \f$d\f$ of the domain
    */
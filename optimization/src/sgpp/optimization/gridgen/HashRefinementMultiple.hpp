@@ -110,6 +110,14 @@ class HashRefinementMultiple : public base::HashRefinement {
   }
 
  protected:
+  /**
+   * The inserted neighbors depend on the points inserted before, so grid points must be
+   * refined one after another.
+   *
+   * @return false
+   */
+  bool canRefineInParallel() const override { return false; }
+
   /**
    * Examine the grid points and stores the indices those that can be
    * refined and have maximal indicator values.
@@ -76,63 +76,6 @@ void MultiStart::optimize() {
     }
   }
 
-  /*Printer::getInstance().disableStatusPrinting();
-
-  #pragma omp parallel shared(d, x0, roundN, xOpt, fOpt, printer) \
-  default(none)
-  {
-    Optimizer* curOptimizerPtr = &optimizer;
-  #ifdef _OPENMP
-    std::unique_ptr<Optimizer> curOptimizer;
-
-    if (omp_get_max_threads() > 1) {
-      optimizer.clone(curOptimizer);
-      curOptimizerPtr = curOptimizer.get();
-    }
-
-  #endif ** _OPENMP **
-
-    base::DataVector curXOpt(d);
-    double curFOpt;
-
-    #pragma omp for ordered schedule(dynamic)
-
-    for (size_t k = 0; k < populationSize; k++) {
-      // optimize with k-th starting point
-      curOptimizerPtr->setStartingPoint(x0[k]);
-      curOptimizerPtr->setN(roundN[k]);
-      curOptimizerPtr->optimize(curXOpt);
-
-      curFOpt = curOptimizerPtr->getScalarFunction().eval(curXOpt);
-
-      #pragma omp critical
-      {
-        if (curFOpt < fOpt) {
-          // this point is the best so far
-          fOpt = curFOpt;
-          xOpt = curXOpt;
-        }
-      }
-
-      // status printing
-      #pragma omp ordered
-      {
-        char str[10];
-        snprintf(str, 10, "%.1f%%",
-                 static_cast<double>(k) /
-                 static_cast<double>(populationSize) * 100.0);
-        Printer::getInstance().getMutex().lock();
-        Printer::getInstance().enableStatusPrinting();
-        Printer::getInstance().printStatusUpdate(std::string(str) +
-                                  ", f(x) = " + std::to_string(fOpt));
-        Printer::getInstance().disableStatusPrinting();
-        Printer::getInstance().getMutex().unlock();
-      }
-    }
-  }
-
-  Printer::getInstance().enableStatusPrinting();*/
-
   base::DataVector xCurrentOpt(d);
   double fCurrentOpt = INFINITY;
 
@@ -145,7 +88,7 @@ void MultiStart::optimize() {
     Printer::getInstance().disableStatusPrinting();
   }
 
-#pragma omp parallel shared(x0, roundN, xCurrentOpt, fCurrentOpt) default(none)
+#pragma omp parallel shared(x0, roundN, xCurrentOpt, fCurrentOpt)
   {
     UnconstrainedOptimizer* curOptimizerPtr = optimizer.get();
 #ifdef _OPENMP
@@ -172,18 +115,17 @@ void MultiStart::optimize() {
       xLocalOpt = curOptimizerPtr->getOptimalPoint();
       fLocalOpt = curOptimizerPtr->getOptimalValue();
 
-#pragma omp critical
+// the results are merged in the order of the starting points
+// (deterministic, independent of the number of threads)
+#pragma omp ordered
       {
         if (fLocalOpt < fCurrentOpt) {
           // this point is the best so far
           xCurrentOpt = xLocalOpt;
           fCurrentOpt = fLocalOpt;
         }
-      }
 
-// status printing
-#pragma omp ordered
-      {
+        // status printing
         char str[10];
         snprintf(str, sizeof(str), "%.1f%%",
                  static_cast<double>(k) / static_cast<double>(populationSize) * 100.0);
@@ -193,11 +135,11 @@ void MultiStart::optimize() {
                                                  std::to_string(fCurrentOpt));
         Printer::getInstance().disableStatusPrinting();
         Printer::getInstance().getMutex().unlock();
-      }
 
-      xHist.appendRow(xCurrentOpt);
-      fHist.append(fCurrentOpt);
-      kHist.push_back(curOptimizerPtr->getHistoryOfOptimalPoints().getNrows());
+        xHist.appendRow(xCurrentOpt);
+        fHist.append(fCurrentOpt);
+        kHist.push_back(curOptimizerPtr->getHistoryOfOptimalPoints().getNrows());
+      }
     }
   }
 
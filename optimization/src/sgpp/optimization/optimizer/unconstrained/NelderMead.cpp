@@ -49,13 +49,22 @@ void NelderMead::optimize() {
   base::DataVector fPoints(d + 1);
   base::DataVector fPointsNew(d + 1);
 
+  // vertices of the simplex as rows (for evaluating multiple vertices at once)
+  base::DataMatrix simplex(d + 1, d);
+  // shrunk vertices as rows and their function values
+  base::DataMatrix shrunk(d, d);
+  base::DataVector fShrunk(d);
+
   // construct starting simplex
   for (size_t t = 0; t < d; t++) {
     points[t + 1][t] = std::min(points[t + 1][t] + STARTING_SIMPLEX_EDGE_LENGTH, 1.0);
-    fPoints[t + 1] = f->eval(points[t + 1]);
   }
 
-  fPoints[0] = f->eval(points[0]);
+  for (size_t i = 0; i < d + 1; i++) {
+    simplex.setRow(i, points[i]);
+  }
+
+  evalPopulation(simplex, fPoints);
 
   std::vector<size_t> index(d + 1, 0);
   base::DataVector pointO(d);
@@ -179,17 +188,18 @@ void NelderMead::optimize() {
     if (shrink) {
       // shrink all points but the first
       for (size_t i = 1; i < d + 1; i++) {
-        bool in_domain = true;
-
         for (size_t t = 0; t < d; t++) {
           points[i][t] = points[0][t] + delta * (points[i][t] - points[0][t]);
-
-          if ((points[i][t] < 0.0) || (points[i][t] > 1.0)) {
-            in_domain = false;
-          }
         }
 
-        fPoints[i] = (in_domain ? f->eval(points[i]) : INFINITY);
+        shrunk.setRow(i - 1, points[i]);
+      }
+
+      // evaluate the shrunk points at once
+      evalPopulation(shrunk, fShrunk);
+
+      for (size_t i = 1; i < d + 1; i++) {
+        fPoints[i] = fShrunk[i - 1];
       }
 
       numberOfFcnEvals += d;
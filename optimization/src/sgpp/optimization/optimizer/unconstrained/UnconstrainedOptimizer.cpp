@@ -0,0 +1,87 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/optimizer/unconstrained/UnconstrainedOptimizer.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+namespace optimizer {
+
+void UnconstrainedOptimizer::evalPopulation(const base::DataMatrix& x, base::DataVector& fx) {
+  const size_t d = f->getNumberOfParameters();
+  const size_t m = x.getNrows();
+  std::vector<size_t> inDomainRows;
+  inDomainRows.reserve(m);
+  fx.resize(m);
+
+  for (size_t k = 0; k < m; k++) {
+    bool inDomain = true;
+
+    for (size_t t = 0; t < d; t++) {
+      if ((x(k, t) < 0.0) || (x(k, t) > 1.0)) {
+        inDomain = false;
+        break;
+      }
+    }
+
+    if (inDomain) {
+      inDomainRows.push_back(k);
+    } else {
+      fx[k] = INFINITY;
+    }
+  }
+
+  const size_t n = inDomainRows.size();
+
+#pragma omp parallel if (n > 1)
+  {  // NOLINT(whitespace/braces)
+    ScalarFunction* curFPtr = f.get();
+    size_t chunkBegin = 0;
+    size_t chunkEnd = n;
+#ifdef _OPENMP
+    std::unique_ptr<ScalarFunction> curF;
+    const size_t numberOfThreads = static_cast<size_t>(omp_get_num_threads());
+    const size_t threadId = static_cast<size_t>(omp_get_thread_num());
+
+    if (numberOfThreads > 1) {
+      f->clone(curF);
+      curFPtr = curF.get();
+      chunkBegin = threadId * n / numberOfThreads;
+      chunkEnd = (threadId + 1) * n / numberOfThreads;
+    }
+
+#endif /* _OPENMP */
+
+    if (chunkEnd > chunkBegin) {
+      base::DataMatrix chunk(chunkEnd - chunkBegin, d);
+      base::DataVector chunkValues(chunkEnd - chunkBegin);
+      base::DataVector xk(d);
+
+      for (size_t i = chunkBegin; i < chunkEnd; i++) {
+        x.getRow(inDomainRows[i], xk);
+        chunk.setRow(i - chunkBegin, xk);
+      }
+
+      curFPtr->evalBatch(chunk, chunkValues);
+
+      for (size_t i = chunkBegin; i < chunkEnd; i++) {
+        fx[inDomainRows[i]] = chunkValues[i - chunkBegin];
+      }
+    }
+  }
+}
+
+}  // namespace optimizer
+}  // namespace optimization
+}  // namespace sgpp
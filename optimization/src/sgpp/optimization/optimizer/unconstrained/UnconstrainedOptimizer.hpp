@@ -128,6 +128,20 @@ class UnconstrainedOptimizer {
   virtual void clone(std::unique_ptr<UnconstrainedOptimizer>& clone) const = 0;
 
  protected:
+  /**
+   * Evaluates the objective function at a whole population of points
+   * (e.g., one generation of a population-based optimizer).
+   * The points are split into contiguous chunks, one per OpenMP thread,
+   * and each thread evaluates its chunk with ScalarFunction::evalBatch
+   * on its own clone of the objective function.
+   * Points outside of \f$[0, 1]^d\f$ are not evaluated, their value
+   * is set to infinity.
+   *
+   * @param      x      points (one point per row)
+   * @param[out] fx     function values (resized to the number of points)
+   */
+  void evalPopulation(const base::DataMatrix& x, base::DataVector& fx);
+
   /// objective function
   std::unique_ptr<ScalarFunction> f;
   /// maximal number of iterations or function evaluations
@@ -31,7 +31,12 @@
 #include <sgpp/optimization/optimizer/constrained/LogBarrier.hpp>
 #include <sgpp/optimization/optimizer/constrained/SquaredPenalty.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
+#include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "CheckEqualFunction.hpp"
@@ -380,6 +385,116 @@ BOOST_AUTO_TEST_CASE(TestUnconstrainedOptimizers) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestPopulationEvaluation) {
+  // Test batch evaluation of objective functions and the parallel evaluation of
+  // populations in gradient-free optimizers.
+  Printer::getInstance().setVerbosity(-1);
+
+  ExampleFunction f;
+  ExampleGradient fGradient;
+
+  const size_t d = f.getNumberOfParameters();
+  const size_t p = 3;
+  const size_t l = 6;
+  const size_t N = 1000;
+  const size_t m = 50;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModBsplineGrid(d, p));
+  sgpp::base::DataVector alpha(0);
+  createSampleGrid(*grid, l, f, alpha);
+  std::unique_ptr<OperationMultipleHierarchisation> op(
+    sgpp::op_factory::createOperationMultipleHierarchisation(*grid));
+  op->doHierarchisation(alpha);
+  InterpolantScalarFunction ft(*grid, alpha);
+  InterpolantScalarFunctionGradient ftGradient(*grid, alpha);
+
+  // evaluation points, the last one is out of the domain
+  sgpp::base::DataMatrix x(m, d);
+  sgpp::base::DataVector xk(d);
+  sgpp::optimization::RandomNumberGenerator::getInstance().setSeed(42);
+
+  for (size_t k = 0; k < m; k++) {
+    for (size_t t = 0; t < d; t++) {
+      x(k, t) = sgpp::optimization::RandomNumberGenerator::getInstance().getUniformRN();
+    }
+  }
+
+  x(m - 1, 0) = 1.5;
+
+  // batch evaluation (default implementation and interpolant)
+  sgpp::base::DataVector value;
+  sgpp::base::DataVector valueT;
+  f.evalBatch(x, value);
+  ft.evalBatch(x, valueT);
+  BOOST_CHECK_EQUAL(value.getSize(), m);
+  BOOST_CHECK_EQUAL(valueT.getSize(), m);
+
+  for (size_t k = 0; k < m; k++) {
+    x.getRow(k, xk);
+    BOOST_CHECK_EQUAL(value[k], f.eval(xk));
+
+    if (k < m - 1) {
+      BOOST_CHECK_CLOSE(valueT[k], ft.eval(xk), 1e-10);
+    } else {
+      BOOST_CHECK(std::isinf(valueT[k]));
+    }
+  }
+
+  // batch evaluation of gradients
+  sgpp::base::DataMatrix gradient;
+  sgpp::base::DataVector gradientK(d);
+  ftGradient.evalBatch(x, value, gradient);
+  BOOST_CHECK_EQUAL(gradient.getNrows(), m);
+  BOOST_CHECK_EQUAL(gradient.getNcols(), d);
+
+  for (size_t k = 0; k < m - 1; k++) {
+    x.getRow(k, xk);
+    BOOST_CHECK_EQUAL(value[k], ftGradient.eval(xk, gradientK));
+
+    for (size_t t = 0; t < d; t++) {
+      BOOST_CHECK_EQUAL(gradient(k, t), gradientK[t]);
+    }
+  }
+
+  // results of the population-based optimizers must not depend on the number of threads
+  std::vector<std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>> optimizers;
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::NelderMead(ft, N)));
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::MultiStart(ft, N)));
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::DifferentialEvolution(ft, N)));
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::CMAES(ft, N)));
+
+  const int maxThreads = omp_get_max_threads();
+
+  for (auto& optimizer : optimizers) {
+    sgpp::base::DataVector xOpt[2];
+    double fOpt[2];
+
+    for (size_t run = 0; run < 2; run++) {
+      omp_set_num_threads((run == 0) ? 1 : std::max(maxThreads, 2));
+      sgpp::optimization::RandomNumberGenerator::getInstance().setSeed(42);
+      optimizer->optimize();
+      xOpt[run] = optimizer->getOptimalPoint();
+      fOpt[run] = optimizer->getOptimalValue();
+    }
+
+    BOOST_CHECK_EQUAL(xOpt[0].getSize(), d);
+    BOOST_CHECK_EQUAL(xOpt[1].getSize(), d);
+    BOOST_CHECK_EQUAL(fOpt[0], fOpt[1]);
+
+    for (size_t t = 0; t < d; t++) {
+      BOOST_CHECK_EQUAL(xOpt[0][t], xOpt[1][t]);
+    }
+
+    BOOST_CHECK_CLOSE(fOpt[0], -2.0, 1e-2);
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
 BOOST_AUTO_TEST_CASE(TestLeastSquaresOptimizers) {
   // Test least squares optimizers in sgpp::optimization::optimizer.
   Printer::getInstance().setVerbosity(-1);
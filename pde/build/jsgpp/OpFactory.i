@@ -3,6 +3,11 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+%ignore sgpp::op_factory::createOperationLaplaceExplicit(
+    sgpp::base::SparseDataMatrix* m, sgpp::base::Grid& grid);
+%ignore sgpp::op_factory::createOperationLTwoDotExplicit(
+    sgpp::base::SparseDataMatrix* m, sgpp::base::Grid& grid);
+
 %include "pde/src/sgpp/pde/operation/PdeOpFactory.hpp"
 
 %newobject sgpp::op_factory::createOperationLaplace(
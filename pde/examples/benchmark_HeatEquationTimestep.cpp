@@ -0,0 +1,149 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystemParallelOMP.hpp>
+#include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+/**
+ * Reference: Laplace operator applied parallel in the dimensions, merging the results of the
+ * dimensions with a lock (the previous implementation of
+ * HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner).
+ */
+void applyLaplaceLocked(sgpp::pde::UpDownOneOpDim& opLaplace, size_t numDims,
+                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
+  result.setAll(0.0);
+  omp_lock_t mutex;
+  omp_init_lock(&mutex);
+
+#pragma omp parallel
+  {
+#pragma omp single nowait
+    {
+      for (size_t i = 0; i < numDims; i++) {
+#pragma omp task firstprivate(i) shared(alpha, result)
+        {
+          sgpp::base::DataVector myResult(result.getSize());
+          opLaplace.multParallelBuildingBlock(alpha, myResult, i);
+
+          omp_set_lock(&mutex);
+          result.add(myResult);
+          omp_unset_lock(&mutex);
+        }
+      }
+
+#pragma omp taskwait
+    }
+  }
+
+  omp_destroy_lock(&mutex);
+}
+
+/**
+ * Measures the runtime of a function in seconds.
+ */
+template <class F>
+double measure(F f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Measures the throughput of Crank-Nicolson timesteps of the heat equation
+ * (HeatEquationParabolicPDESolverSystemParallelOMP) and of the Laplace operator applied
+ * parallel in the dimensions, compared to merging the dimensions with a lock,
+ * for regular linear boundary grids in d = 3, ..., 8 dimensions.
+ */
+int main() {
+  const size_t levels[] = {6, 5, 4, 4, 3, 3};
+  const size_t numTimesteps = 10;
+  const size_t numLaplaceApplications = 20;
+  const double timestepSize = 0.001;
+
+  for (size_t dim = 3; dim <= 8; dim++) {
+    const size_t level = levels[dim - 3];
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(dim));
+    grid->getGenerator().regular(level);
+    const size_t n = grid->getSize();
+
+    // smooth initial heat distribution
+    sgpp::base::DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      sgpp::base::GridPoint& point = grid->getStorage().getPoint(i);
+      double value = 1.0;
+
+      for (size_t d = 0; d < dim; d++) {
+        value *= std::sin(M_PI * point.getStandardCoordinate(d));
+      }
+
+      alpha[i] = value;
+    }
+
+    // Laplace operator on the inner grid
+    std::unique_ptr<sgpp::base::Grid> innerGrid(sgpp::base::Grid::createLinearGrid(dim));
+    innerGrid->getGenerator().regular(level);
+    const size_t nInner = innerGrid->getSize();
+    std::unique_ptr<sgpp::base::OperationMatrix> opLaplace(
+        sgpp::op_factory::createOperationLaplace(*innerGrid));
+    sgpp::pde::UpDownOneOpDim& upDown = dynamic_cast<sgpp::pde::UpDownOneOpDim&>(*opLaplace);
+
+    sgpp::base::DataVector alphaInner(nInner, 1.0);
+    sgpp::base::DataVector resultLocked(nInner);
+    sgpp::base::DataVector result(nInner);
+
+    const double timeLocked = measure([&]() {
+      for (size_t k = 0; k < numLaplaceApplications; k++) {
+        applyLaplaceLocked(upDown, dim, alphaInner, resultLocked);
+      }
+    });
+    const double timeReduction = measure([&]() {
+      for (size_t k = 0; k < numLaplaceApplications; k++) {
+        upDown.mult(alphaInner, result);
+      }
+    });
+
+    double maxError = 0.0;
+
+    for (size_t i = 0; i < nInner; i++) {
+      maxError = std::max(maxError, std::abs(result[i] - resultLocked[i]));
+    }
+
+    // Crank-Nicolson timesteps
+    sgpp::pde::HeatEquationParabolicPDESolverSystemParallelOMP system(*grid, alpha, 1.0,
+                                                                      timestepSize, "CrNic");
+    sgpp::solver::ConjugateGradients cg(1000, 1e-8);
+    sgpp::solver::CrankNicolson crankNicolson(numTimesteps, timestepSize);
+
+    const double timeTimesteps = measure([&]() { crankNicolson.solve(cg, system, false, false); });
+
+    std::cout << "d = " << dim << ", level " << level << ", N = " << n
+              << ", N (inner) = " << nInner << "\n"
+              << "  Laplace, locked merge:    "
+              << static_cast<double>(numLaplaceApplications) / timeLocked << " applications/s\n"
+              << "  Laplace, reduction:       "
+              << static_cast<double>(numLaplaceApplications) / timeReduction
+              << " applications/s\n"
+              << "  max. difference:          " << maxError << "\n"
+              << "  Crank-Nicolson timesteps: "
+              << static_cast<double>(numTimesteps) / timeTimesteps << " timesteps/s" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,161 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/SparseDataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * Reference: assembly of the L2 dot product matrix of a linear grid by testing all pairs of grid
+ * points (the previous implementation of OperationMatrixLTwoDotExplicitLinear).
+ */
+void assembleAllPairs(sgpp::base::Grid& grid, sgpp::base::DataMatrix& m) {
+  const size_t gridSize = grid.getSize();
+  const size_t gridDim = grid.getDimension();
+  sgpp::base::DataMatrix level(gridSize, gridDim);
+  sgpp::base::DataMatrix index(gridSize, gridDim);
+  grid.getStorage().getLevelIndexArraysForEval(level, index);
+
+  for (size_t i = 0; i < gridSize; i++) {
+#pragma omp parallel for schedule(guided)
+    for (size_t j = i; j < gridSize; j++) {
+      double res = 1;
+
+      for (size_t k = 0; k < gridDim; k++) {
+        const double lik = level.get(i, k);
+        const double ljk = level.get(j, k);
+        const double iik = index.get(i, k);
+        const double ijk = index.get(j, k);
+
+        if (lik == ljk) {
+          if (iik == ijk) {
+            res *= 2 / lik / 3;
+          } else {
+            res = 0.;
+            break;
+          }
+        } else if (std::max((iik - 1) / lik, (ijk - 1) / ljk) >=
+                   std::min((iik + 1) / lik, (ijk + 1) / ljk)) {
+          res = 0.;
+          break;
+        } else {
+          const double lSmall = std::max(lik, ljk);
+          const double lLarge = std::min(lik, ljk);
+          const double diff = (lik > ljk) ? (iik / lik - ijk / ljk) : (ijk / ljk - iik / lik);
+          double temp = std::abs(diff - 1 / lSmall) + std::abs(diff + 1 / lSmall) - std::abs(diff);
+          res *= (1 - temp * lLarge) / lSmall;
+        }
+      }
+
+      m.set(i, j, res);
+      m.set(j, i, res);
+    }
+  }
+}
+
+/**
+ * Measures the runtime of a function in seconds.
+ */
+template <class F>
+double measure(F f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Compares the assembly of explicit L2 dot product matrices (as used by the offline phase of the
+ * density estimation) visiting all pairs of grid points with the support-overlap assembly
+ * (dense and CSR output) for regular linear and B-spline grids.
+ */
+int main() {
+  const size_t dims[] = {2, 2, 3, 5};
+  const size_t levels[] = {8, 9, 7, 6};
+
+  for (size_t k = 0; k < sizeof(dims) / sizeof(dims[0]); k++) {
+    const size_t dim = dims[k];
+    const size_t level = levels[k];
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(level);
+    const size_t n = grid->getSize();
+
+    sgpp::base::DataMatrix reference(n, n);
+    sgpp::base::DataMatrix dense(n, n);
+    sgpp::base::SparseDataMatrix sparse;
+
+    const double timeAllPairs = measure([&]() { assembleAllPairs(*grid, reference); });
+    const double timeDense = measure([&]() {
+      std::unique_ptr<sgpp::base::OperationMatrix> op(
+          sgpp::op_factory::createOperationLTwoDotExplicit(&dense, *grid));
+    });
+    const double timeSparse = measure([&]() {
+      std::unique_ptr<sgpp::base::OperationMatrix> op(
+          sgpp::op_factory::createOperationLTwoDotExplicit(&sparse, *grid));
+    });
+
+    double maxError = 0.0;
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        maxError = std::max(maxError, std::abs(reference.get(i, j) - sparse.get(i, j)));
+      }
+    }
+
+    std::cout << "linear, d = " << dim << ", level " << level << ", N = " << n
+              << ", nnz = " << sparse.getNnz() << " ("
+              << 100.0 * static_cast<double>(sparse.getNnz()) / static_cast<double>(n * n)
+              << "%)\n"
+              << "  all pairs:              " << timeAllPairs << "s\n"
+              << "  overlap assembly dense: " << timeDense << "s\n"
+              << "  overlap assembly CSR:   " << timeSparse << "s\n"
+              << "  max. difference:        " << maxError << std::endl;
+  }
+
+  // grids for which the dense matrix would not fit into memory
+  for (size_t level : {10, 11}) {
+    const size_t dim = 2;
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(level);
+    const size_t n = grid->getSize();
+    sgpp::base::SparseDataMatrix sparse;
+
+    const double timeSparse = measure([&]() {
+      std::unique_ptr<sgpp::base::OperationMatrix> op(
+          sgpp::op_factory::createOperationLTwoDotExplicit(&sparse, *grid));
+    });
+
+    std::cout << "linear, d = " << dim << ", level " << level << ", N = " << n
+              << ", nnz = " << sparse.getNnz() << "\n"
+              << "  overlap assembly CSR:   " << timeSparse << "s" << std::endl;
+  }
+
+  for (size_t level : {3, 4}) {
+    const size_t dim = 5;
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createBsplineGrid(dim, 3));
+    grid->getGenerator().regular(level);
+    const size_t n = grid->getSize();
+    sgpp::base::SparseDataMatrix sparse;
+
+    const double timeSparse = measure([&]() {
+      std::unique_ptr<sgpp::base::OperationMatrix> op(
+          sgpp::op_factory::createOperationLTwoDotExplicit(&sparse, *grid));
+    });
+
+    std::cout << "B-spline (p = 3), d = " << dim << ", level " << level << ", N = " << n
+              << ", nnz = " << sparse.getNnz() << "\n"
+              << "  overlap assembly CSR:   " << timeSparse << "s" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,180 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystemParallelOMP.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * Measures the runtime of a function in seconds.
+ */
+template <class F>
+double measure(F f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Applies the operator to all columns, one column after another.
+ */
+void multColumnwise(sgpp::base::OperationMatrix& op, sgpp::base::DataMatrix& alpha,
+                    sgpp::base::DataMatrix& result) {
+  sgpp::base::DataVector alphaColumn(alpha.getNrows());
+  sgpp::base::DataVector resultColumn(result.getNrows());
+
+  for (size_t j = 0; j < alpha.getNcols(); j++) {
+    alpha.getColumn(j, alphaColumn);
+    op.mult(alphaColumn, resultColumn);
+    result.setColumn(j, resultColumn);
+  }
+}
+
+/**
+ * Measures the throughput of the Laplace and the L2 dot product operators applied to
+ * 64 right hand sides at once (mult for DataMatrix, one traversal of the grid for all columns)
+ * compared to applying them column by column, for regular linear grids in d = 3, ..., 6
+ * dimensions. Additionally, Crank-Nicolson timesteps of the heat equation
+ * (HeatEquationParabolicPDESolverSystemParallelOMP) are measured for all initial conditions
+ * at once and for one initial condition after another.
+ */
+int main() {
+  const size_t levels[] = {6, 5, 4, 4};
+  const size_t numRHS = 64;
+  const size_t numApplications = 5;
+  const size_t numTimesteps = 5;
+  const double timestepSize = 0.001;
+
+  for (size_t dim = 3; dim <= 6; dim++) {
+    const size_t level = levels[dim - 3];
+
+    // operators on the inner grid
+    std::unique_ptr<sgpp::base::Grid> innerGrid(sgpp::base::Grid::createLinearGrid(dim));
+    innerGrid->getGenerator().regular(level);
+    const size_t nInner = innerGrid->getSize();
+
+    sgpp::base::DataMatrix alpha(nInner, numRHS);
+
+    for (size_t i = 0; i < nInner; i++) {
+      for (size_t j = 0; j < numRHS; j++) {
+        alpha.set(i, j, std::sin(static_cast<double>(i * (j + 1))));
+      }
+    }
+
+    std::cout << "d = " << dim << ", level " << level << ", N (inner) = " << nInner << ", "
+              << numRHS << " right hand sides\n";
+
+    for (const std::string name : {"Laplace", "LTwoDotProduct"}) {
+      std::unique_ptr<sgpp::base::OperationMatrix> op(
+          (name == "Laplace") ? sgpp::op_factory::createOperationLaplace(*innerGrid)
+                              : sgpp::op_factory::createOperationLTwoDotProduct(*innerGrid));
+
+      sgpp::base::DataMatrix resultColumnwise(nInner, numRHS);
+      sgpp::base::DataMatrix result(nInner, numRHS);
+
+      const double timeColumnwise = measure([&]() {
+        for (size_t k = 0; k < numApplications; k++) {
+          multColumnwise(*op, alpha, resultColumnwise);
+        }
+      });
+      const double timeMatrix = measure([&]() {
+        for (size_t k = 0; k < numApplications; k++) {
+          op->mult(alpha, result);
+        }
+      });
+
+      double maxError = 0.0;
+
+      for (size_t i = 0; i < nInner; i++) {
+        for (size_t j = 0; j < numRHS; j++) {
+          maxError = std::max(maxError, std::abs(result.get(i, j) - resultColumnwise.get(i, j)));
+        }
+      }
+
+      std::cout << "  " << name << ", column by column: "
+                << static_cast<double>(numApplications * numRHS) / timeColumnwise
+                << " columns/s\n"
+                << "  " << name << ", all columns:      "
+                << static_cast<double>(numApplications * numRHS) / timeMatrix << " columns/s\n"
+                << "  max. difference:          " << maxError << "\n";
+    }
+
+    // Crank-Nicolson timesteps on the boundary grid
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(dim));
+    grid->getGenerator().regular(level);
+    const size_t n = grid->getSize();
+
+    sgpp::base::DataMatrix alphas(n, numRHS);
+
+    for (size_t i = 0; i < n; i++) {
+      sgpp::base::GridPoint& point = grid->getStorage().getPoint(i);
+
+      for (size_t j = 0; j < numRHS; j++) {
+        double value = 1.0;
+
+        for (size_t d = 0; d < dim; d++) {
+          value *= std::sin(static_cast<double>(j % 4 + 1) * M_PI *
+                            point.getStandardCoordinate(d));
+        }
+
+        alphas.set(i, j, value);
+      }
+    }
+
+    sgpp::base::DataMatrix alphasSequential(alphas);
+    const double timeSequential = measure([&]() {
+      sgpp::base::DataVector alphaColumn(n);
+
+      for (size_t j = 0; j < numRHS; j++) {
+        alphasSequential.getColumn(j, alphaColumn);
+        sgpp::pde::HeatEquationParabolicPDESolverSystemParallelOMP system(
+            *grid, alphaColumn, 1.0, timestepSize, "CrNic");
+        sgpp::solver::ConjugateGradients cg(1000, 1e-8);
+        sgpp::solver::CrankNicolson crankNicolson(numTimesteps, timestepSize);
+        crankNicolson.solve(cg, system, false, false);
+        alphasSequential.setColumn(j, alphaColumn);
+      }
+    });
+
+    const double timeMatrix = measure([&]() {
+      sgpp::base::DataVector alphaSystem(n);
+      alphas.getColumn(0, alphaSystem);
+      sgpp::pde::HeatEquationParabolicPDESolverSystemParallelOMP system(*grid, alphaSystem, 1.0,
+                                                                        timestepSize, "CrNic");
+      sgpp::solver::ConjugateGradients cg(1000, 1e-8);
+      sgpp::solver::CrankNicolson crankNicolson(numTimesteps, timestepSize);
+      crankNicolson.solve(cg, system, alphas);
+    });
+
+    double maxError = 0.0;
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < numRHS; j++) {
+        maxError = std::max(maxError, std::abs(alphas.get(i, j) - alphasSequential.get(i, j)));
+      }
+    }
+
+    std::cout << "  Crank-Nicolson, one initial condition after another: "
+              << static_cast<double>(numTimesteps * numRHS) / timeSequential
+              << " timesteps/s\n"
+              << "  Crank-Nicolson, all initial conditions at once:      "
+              << static_cast<double>(numTimesteps * numRHS) / timeMatrix << " timesteps/s\n"
+              << "  max. difference:          " << maxError << std::endl;
+  }
+
+  return 0;
+}
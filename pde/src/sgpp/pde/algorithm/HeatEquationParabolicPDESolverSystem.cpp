@@ -67,46 +67,51 @@ void HeatEquationParabolicPDESolverSystem::applyMassMatrixComplete(sgpp::base::D
                                                                    sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector temp(alpha.getSize());
-
   // Apply the mass matrix
-  this->OpMassBound->mult(alpha, temp);
-
-  result.add(temp);
+  this->OpMassBound->mult(alpha, result);
 }
 
 void HeatEquationParabolicPDESolverSystem::applyLOperatorComplete(sgpp::base::DataVector& alpha,
                                                                   sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector temp(alpha.getSize());
-
   // Apply the laplace Operator rate
-  this->OpLaplaceBound->mult(alpha, temp);
-  result.axpy((-1.0) * this->a, temp);
+  this->OpLaplaceBound->mult(alpha, result);
+  result.mult((-1.0) * this->a);
 }
 
 void HeatEquationParabolicPDESolverSystem::applyMassMatrixInner(sgpp::base::DataVector& alpha,
                                                                 sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector temp(alpha.getSize());
-
   // Apply the mass matrix
-  this->OpMassInner->mult(alpha, temp);
-
-  result.add(temp);
+  this->OpMassInner->mult(alpha, result);
 }
 
 void HeatEquationParabolicPDESolverSystem::applyLOperatorInner(sgpp::base::DataVector& alpha,
                                                                sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector temp(alpha.getSize());
-
   // Apply the laplace Operator rate
-  this->OpLaplaceInner->mult(alpha, temp);
-  result.axpy((-1.0) * this->a, temp);
+  this->OpLaplaceInner->mult(alpha, result);
+  result.mult((-1.0) * this->a);
+}
+
+void HeatEquationParabolicPDESolverSystem::applyMassMatrixInner(sgpp::base::DataMatrix& alpha,
+                                                                sgpp::base::DataMatrix& result) {
+  result.setAll(0.0);
+
+  // Apply the mass matrix to all columns at once
+  this->OpMassInner->mult(alpha, result);
+}
+
+void HeatEquationParabolicPDESolverSystem::applyLOperatorInner(sgpp::base::DataMatrix& alpha,
+                                                               sgpp::base::DataMatrix& result) {
+  result.setAll(0.0);
+
+  // Apply the laplace Operator rate to all columns at once
+  this->OpLaplaceInner->mult(alpha, result);
+  result.mult((-1.0) * this->a);
 }
 
 void HeatEquationParabolicPDESolverSystem::finishTimestep() {
@@ -6,6 +6,7 @@
 #ifndef HEATEQUATIONPARABOLICPDESOLVERSYSTEM_HPP
 #define HEATEQUATIONPARABOLICPDESOLVERSYSTEM_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/pde/operation/hash/OperationParabolicPDESolverSystemDirichlet.hpp>
@@ -42,6 +43,10 @@ class HeatEquationParabolicPDESolverSystem : public OperationParabolicPDESolverS
 
   void applyLOperatorInner(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  void applyMassMatrixInner(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
+  void applyLOperatorInner(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
  public:
   /**
    * Std-Constructor
@@ -68,6 +73,8 @@ class HeatEquationParabolicPDESolverSystem : public OperationParabolicPDESolverS
   virtual void coarsenAndRefine(bool isLastTimestep = false);
 
   virtual void startTimestep();
+
+  using OperationParabolicPDESolverSystemDirichlet::mult;
 };
 }  // namespace pde
 }  // namespace sgpp
@@ -11,13 +11,8 @@
 
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
 
-#include <vector>
 #include <string>
 
 namespace sgpp {
@@ -77,112 +72,43 @@ HeatEquationParabolicPDESolverSystemParallelOMP::
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixComplete(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
-  reinterpret_cast<StdUpDown*>(this->OpMassBound)->multParallelBuildingBlock(alpha, temp);
-
-  result.add(temp);
+  reinterpret_cast<StdUpDown*>(this->OpMassBound)->multParallelBuildingBlock(alpha, result);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorComplete(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-  temp.setAll(0.0);
-
-  std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
-  size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
-
   // Apply Laplace, parallel in Dimensions
-  for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
-    {
-      sgpp::base::DataVector myResult(result.getSize());
-
-      /// discuss methods in order to avoid this cast
-      reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceBound)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
-    }
-  }
+  /// discuss methods in order to avoid this cast
+  reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceBound)->multParallelBuildingBlock(alpha, result);
 
-#pragma omp taskwait
-
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
-
-  result.axpy((-1.0) * this->a, temp);
+  result.mult((-1.0) * this->a);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
-  reinterpret_cast<StdUpDown*>(this->OpMassInner)->multParallelBuildingBlock(alpha, temp);
-
-  result.add(temp);
+  reinterpret_cast<StdUpDown*>(this->OpMassInner)->multParallelBuildingBlock(alpha, result);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-  temp.setAll(0.0);
-
-  std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
-  size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
-
   // Apply Laplace, parallel in Dimensions
-  for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
-    {
-      sgpp::base::DataVector myResult(result.getSize());
-
-      /// discuss methods in order to avoid this cast
-      reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
-    }
-  }
+  /// discuss methods in order to avoid this cast
+  reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)->multParallelBuildingBlock(alpha, result);
 
-#pragma omp taskwait
+  result.mult((-1.0) * this->a);
+}
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
+void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
+    sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  reinterpret_cast<StdUpDown*>(this->OpMassInner)->multParallelBuildingBlock(alpha, result);
+}
+
+void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
+    sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  // Apply Laplace to all columns, parallel in Dimensions
+  reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)->multParallelBuildingBlock(alpha, result);
 
-  result.axpy((-1.0) * this->a, temp);
+  result.mult((-1.0) * this->a);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::finishTimestep() {
@@ -201,45 +127,43 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::mult(sgpp::base::DataVecto
   if (this->tOperationMode == "ExEul") {
     applyMassMatrixInner(alpha, result);
   } else if (this->tOperationMode == "ImEul") {
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
+    this->resizeMultBuffers(result.getSize());
 
-#pragma omp parallel shared(alpha, result, temp, temp2)
+#pragma omp parallel shared(alpha)
     {
 #pragma omp single nowait
       {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
+#pragma omp task shared(alpha)
+        { applyMassMatrixInner(alpha, this->multMassResult); }
 
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
+#pragma omp task shared(alpha)
+        { applyLOperatorInner(alpha, this->multLOperatorResult); }
 
 #pragma omp taskwait
       }
     }
 
-    result.add(temp);
-    result.axpy((-1.0) * this->TimestepSize, temp2);
+    result.add(this->multMassResult);
+    result.axpy((-1.0) * this->TimestepSize, this->multLOperatorResult);
   } else if (this->tOperationMode == "CrNic") {
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
+    this->resizeMultBuffers(result.getSize());
 
-#pragma omp parallel shared(alpha, result, temp, temp2)
+#pragma omp parallel shared(alpha)
     {
 #pragma omp single nowait
       {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
+#pragma omp task shared(alpha)
+        { applyMassMatrixInner(alpha, this->multMassResult); }
 
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
+#pragma omp task shared(alpha)
+        { applyLOperatorInner(alpha, this->multLOperatorResult); }
 
 #pragma omp taskwait
       }
     }
 
-    result.add(temp);
-    result.axpy((-0.5) * this->TimestepSize, temp2);
+    result.add(this->multMassResult);
+    result.axpy((-0.5) * this->TimestepSize, this->multLOperatorResult);
   } else {
     throw sgpp::base::algorithm_exception(
         " HeatEquationParabolicPDESolverSystemParallelOMP::mult : An unknown operation mode was "
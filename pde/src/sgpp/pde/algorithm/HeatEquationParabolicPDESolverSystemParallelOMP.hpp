@@ -6,6 +6,7 @@
 #ifndef HEATEQUATIONPARABOLICPDESOLVERSYSTEMPARALLELOMP_HPP
 #define HEATEQUATIONPARABOLICPDESOLVERSYSTEMPARALLELOMP_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/pde/operation/hash/OperationParabolicPDESolverSystemDirichlet.hpp>
@@ -43,6 +44,10 @@ class HeatEquationParabolicPDESolverSystemParallelOMP
 
   void applyLOperatorInner(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  void applyMassMatrixInner(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
+  void applyLOperatorInner(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
  public:
   /**
    * Std-Constructor
@@ -73,6 +78,9 @@ class HeatEquationParabolicPDESolverSystemParallelOMP
 
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  // the matrix version (several right hand sides at once) is not hidden by the vector version
+  using OperationParabolicPDESolverSystemDirichlet::mult;
+
   virtual sgpp::base::DataVector* generateRHS();
 };
 }  // namespace pde
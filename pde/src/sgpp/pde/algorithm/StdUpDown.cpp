@@ -28,6 +28,17 @@ void StdUpDown::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& resu
   result.add(beta);
 }
 
+void StdUpDown::mult(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  sgpp::base::DataMatrix beta(result.getNrows(), result.getNcols());
+  result.setAll(0.0);
+#pragma omp parallel
+  {
+#pragma omp single nowait
+    { this->updown(alpha, beta, this->numAlgoDims_ - 1); }
+  }
+  result.add(beta);
+}
+
 void StdUpDown::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result) {
   sgpp::base::DataVector beta(result.getSize());
@@ -38,6 +49,16 @@ void StdUpDown::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
   result.add(beta);
 }
 
+void StdUpDown::multParallelBuildingBlock(sgpp::base::DataMatrix& alpha,
+                                          sgpp::base::DataMatrix& result) {
+  sgpp::base::DataMatrix beta(result.getNrows(), result.getNcols());
+  result.setAll(0.0);
+
+  this->updown(alpha, beta, this->numAlgoDims_ - 1);
+
+  result.add(beta);
+}
+
 void StdUpDown::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) {
   size_t curNumAlgoDims = this->numAlgoDims_;
   size_t curMaxParallelDims = this->maxParallelDims_;
@@ -80,5 +101,75 @@ void StdUpDown::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& re
     result.add(temp);
   }
 }
+
+void StdUpDown::updown(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                       size_t dim) {
+  size_t curNumAlgoDims = this->numAlgoDims_;
+  size_t curMaxParallelDims = this->maxParallelDims_;
+  const size_t nrows = alpha.getNrows();
+  const size_t ncols = alpha.getNcols();
+
+  // Unidirectional scheme
+  if (dim > 0) {
+    // Reordering ups and downs
+    sgpp::base::DataMatrix temp(nrows, ncols);
+    sgpp::base::DataMatrix result_temp(nrows, ncols);
+    sgpp::base::DataMatrix temp_two(nrows, ncols);
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
+    {
+      up(alpha, temp, this->algoDims[dim]);
+      updown(temp, result, dim - 1);
+    }
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
+                                                                        result_temp)
+    {  // NOLINT(whitespace/braces)
+      updown(alpha, temp_two, dim - 1);
+      down(temp_two, result_temp, this->algoDims[dim]);
+    }
+
+#pragma omp taskwait
+
+    result.add(result_temp);
+  } else {
+    // Terminates dimension recursion
+    sgpp::base::DataMatrix temp(nrows, ncols);
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
+    up(alpha, result, this->algoDims[dim]);
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
+    down(alpha, temp, this->algoDims[dim]);
+
+#pragma omp taskwait
+
+    result.add(temp);
+  }
+}
+
+void StdUpDown::up(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim) {
+  sgpp::base::DataVector alphaColumn(alpha.getNrows());
+  sgpp::base::DataVector resultColumn(alpha.getNrows());
+
+  for (size_t j = 0; j < alpha.getNcols(); j++) {
+    alpha.getColumn(j, alphaColumn);
+    resultColumn.setAll(0.0);
+    up(alphaColumn, resultColumn, dim);
+    result.setColumn(j, resultColumn);
+  }
+}
+
+void StdUpDown::down(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim) {
+  sgpp::base::DataVector alphaColumn(alpha.getNrows());
+  sgpp::base::DataVector resultColumn(alpha.getNrows());
+
+  for (size_t j = 0; j < alpha.getNcols(); j++) {
+    alpha.getColumn(j, alphaColumn);
+    resultColumn.setAll(0.0);
+    down(alphaColumn, resultColumn, dim);
+    result.setColumn(j, resultColumn);
+  }
+}
 }  // namespace pde
 }  // namespace sgpp
@@ -8,6 +8,7 @@
 
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
@@ -41,6 +42,16 @@ class StdUpDown : public sgpp::base::OperationMatrix {
 
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Applies the operator to all columns of alpha (one row per grid point).
+   * The columns are processed together in the same up/down recursion, hence
+   * the grid is traversed only once per up/down for all columns.
+   *
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  virtual void mult(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
   /**
    * this functions provides the same functionality as the normal mult routine.
    * However, it doesn't set up an OpenMP task initialization as the mult routine.
@@ -57,6 +68,16 @@ class StdUpDown : public sgpp::base::OperationMatrix {
    */
   void multParallelBuildingBlock(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * this functions provides the same functionality as the mult routine for matrices.
+   * However, it doesn't set up an OpenMP task initialization as the mult routine.
+   * This method has to be called within a OpenMP task parallelized region.
+   *
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  void multParallelBuildingBlock(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
  protected:
   typedef sgpp::base::GridStorage::grid_iterator grid_iterator;
 
@@ -78,6 +99,15 @@ class StdUpDown : public sgpp::base::OperationMatrix {
    */
   void updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
+  /**
+   * Recursive procedure for updown, applied to all columns of alpha at once
+   *
+   * @param dim the current dimension
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  void updown(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
+
   /**
    * 1D up Operation
    *
@@ -95,6 +125,26 @@ class StdUpDown : public sgpp::base::OperationMatrix {
    * @param result vector to store the results in
    */
   virtual void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) = 0;
+
+  /**
+   * 1D up Operation applied to all columns of alpha.
+   * The default implementation applies the vector version to one column after another.
+   *
+   * @param dim dimension in which to apply the up-part
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  virtual void up(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
+
+  /**
+   * 1D down Operation applied to all columns of alpha.
+   * The default implementation applies the vector version to one column after another.
+   *
+   * @param dim dimension in which to apply the down-part
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  virtual void down(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
 };
 }  // namespace pde
 }  // namespace sgpp
@@ -0,0 +1,199 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/SupportOverlapAssembler.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+SupportOverlapAssembler::SupportOverlapAssembler(const base::GridStorage& storage,
+                                                 double supportRadius)
+    : size(storage.getSize()),
+      dim(storage.getDimension()),
+      supportRadius(supportRadius),
+      levels(size * dim),
+      indices(size * dim),
+      supportLeft(size * dim),
+      supportRight(size * dim),
+      pointsByLevel(dim) {
+  for (size_t i = 0; i < size; i++) {
+    const base::GridPoint& point = storage.getPoint(i);
+
+    for (size_t t = 0; t < dim; t++) {
+      const base::level_t l = point.getLevel(t);
+      const double h = std::ldexp(1.0, -static_cast<int>(l));
+      levels[i * dim + t] = l;
+      indices[i * dim + t] = point.getIndex(t);
+      supportLeft[i * dim + t] = (static_cast<double>(point.getIndex(t)) - supportRadius) * h;
+      supportRight[i * dim + t] = (static_cast<double>(point.getIndex(t)) + supportRadius) * h;
+
+      if (pointsByLevel[t].size() <= l) {
+        pointsByLevel[t].resize(l + 1);
+      }
+
+      pointsByLevel[t][l].emplace_back(point.getIndex(t), i);
+    }
+  }
+
+  for (size_t t = 0; t < dim; t++) {
+    for (auto& points : pointsByLevel[t]) {
+      std::sort(points.begin(), points.end());
+    }
+  }
+}
+
+std::pair<size_t, size_t> SupportOverlapAssembler::getOverlappingRange(size_t t,
+                                                                       base::level_t l1,
+                                                                       base::index_t i1,
+                                                                       base::level_t l2) const {
+  const std::vector<std::pair<base::index_t, size_t>>& points = pointsByLevel[t][l2];
+
+  // the support of (l2, i2) overlaps with the support of (l1, i1) iff
+  // lower < i2 < upper (exact, as h1 / h2 is a power of two)
+  const double ratio = std::ldexp(1.0, static_cast<int>(l2) - static_cast<int>(l1));
+  const double i1Dbl = static_cast<double>(i1);
+  const double lower = (i1Dbl - supportRadius) * ratio - supportRadius;
+  const double upper = (i1Dbl + supportRadius) * ratio + supportRadius;
+
+  if (upper <= 0.0) {
+    return std::make_pair(0, 0);
+  }
+
+  const base::index_t minIndex =
+      (lower < 0.0) ? 0 : static_cast<base::index_t>(std::floor(lower)) + 1;
+  const base::index_t maxIndex = static_cast<base::index_t>(std::ceil(upper)) - 1;
+
+  auto begin = std::lower_bound(points.begin(), points.end(), std::make_pair(minIndex, size_t(0)));
+  auto end = std::upper_bound(begin, points.end(),
+                              std::make_pair(maxIndex, std::numeric_limits<size_t>::max()));
+
+  return std::make_pair(begin - points.begin(), end - points.begin());
+}
+
+void SupportOverlapAssembler::getOverlappingPoints(size_t i, std::vector<size_t>& result,
+                                                   bool onlyUpper) const {
+  result.clear();
+  collectOverlappingPoints(i, result, onlyUpper);
+  std::sort(result.begin(), result.end());
+}
+
+void SupportOverlapAssembler::collectOverlappingPoints(size_t i, std::vector<size_t>& result,
+                                                       bool onlyUpper) const {
+  if (dim == 0) {
+    return;
+  }
+
+  const base::level_t* level = &levels[i * dim];
+  const base::index_t* index = &indices[i * dim];
+  const double* left = &supportLeft[i * dim];
+  const double* right = &supportRight[i * dim];
+
+  // find the dimension in which the fewest grid points overlap
+  size_t bestDim = 0;
+  size_t bestCount = std::numeric_limits<size_t>::max();
+
+  for (size_t t = 0; t < dim; t++) {
+    size_t count = 0;
+
+    for (size_t l2 = 0; (l2 < pointsByLevel[t].size()) && (count < bestCount); l2++) {
+      std::pair<size_t, size_t> range =
+          getOverlappingRange(t, level[t], index[t], static_cast<base::level_t>(l2));
+      count += range.second - range.first;
+    }
+
+    if (count < bestCount) {
+      bestDim = t;
+      bestCount = count;
+    }
+  }
+
+  // test the candidates in the remaining dimensions
+  for (size_t l2 = 0; l2 < pointsByLevel[bestDim].size(); l2++) {
+    const std::vector<std::pair<base::index_t, size_t>>& points = pointsByLevel[bestDim][l2];
+    std::pair<size_t, size_t> range = getOverlappingRange(bestDim, level[bestDim], index[bestDim],
+                                                          static_cast<base::level_t>(l2));
+
+    for (size_t k = range.first; k < range.second; k++) {
+      const size_t j = points[k].second;
+
+      if (onlyUpper && (j < i)) {
+        continue;
+      }
+
+      const double* leftJ = &supportLeft[j * dim];
+      const double* rightJ = &supportRight[j * dim];
+      bool overlap = true;
+
+      for (size_t t = 0; t < dim; t++) {
+        if (std::max(left[t], leftJ[t]) >= std::min(right[t], rightJ[t])) {
+          overlap = false;
+          break;
+        }
+      }
+
+      if (overlap) {
+        result.push_back(j);
+      }
+    }
+  }
+}
+
+void SupportOverlapAssembler::buildSymmetricCSR(std::vector<std::vector<size_t>>& upperColumns,
+                                                std::vector<std::vector<double>>& upperValues,
+                                                base::SparseDataMatrix& sparse) const {
+  // count the entries of each row (upper part and mirrored lower part)
+  std::vector<size_t> rowPointers(size + 1, 0);
+
+  for (size_t i = 0; i < size; i++) {
+    rowPointers[i + 1] += upperColumns[i].size();
+
+    for (size_t j : upperColumns[i]) {
+      if (j != i) {
+        rowPointers[j + 1]++;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    rowPointers[i + 1] += rowPointers[i];
+  }
+
+  std::vector<size_t> columnIndices(rowPointers[size]);
+  std::vector<double> values(rowPointers[size]);
+  std::vector<size_t> next(rowPointers.begin(), rowPointers.end() - 1);
+
+  // processing the rows in ascending order keeps the column indices of each row sorted:
+  // the lower part of row i (columns < i) has been written by the rows before
+  for (size_t i = 0; i < size; i++) {
+    for (size_t k = 0; k < upperColumns[i].size(); k++) {
+      const size_t j = upperColumns[i][k];
+      const double value = upperValues[i][k];
+
+      columnIndices[next[i]] = j;
+      values[next[i]++] = value;
+
+      if (j != i) {
+        columnIndices[next[j]] = i;
+        values[next[j]++] = value;
+      }
+    }
+
+    std::vector<size_t>().swap(upperColumns[i]);
+    std::vector<double>().swap(upperValues[i]);
+  }
+
+  sparse.assign(size, size, std::move(rowPointers), std::move(columnIndices), std::move(values));
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,179 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SUPPORTOVERLAPASSEMBLER_HPP
+#define SUPPORTOVERLAPASSEMBLER_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/SparseDataMatrix.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/LevelIndexTypes.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Assembles symmetric system matrices \f$(a(\Phi_i, \Phi_j))_{i,j}\f$ of sparse grids whose
+ * entries vanish if the supports of \f$\Phi_i\f$ and \f$\Phi_j\f$ do not overlap (e.g., L2 dot
+ * product or Laplace matrices).
+ *
+ * Instead of testing all \f$N^2\f$ pairs of grid points, the grid points are sorted by level and
+ * index in each dimension. For each grid point, the points whose one-dimensional supports overlap
+ * in the dimension with the fewest such points are looked up by binary search, and only these
+ * candidates are tested in the remaining dimensions. The rows are processed in parallel.
+ *
+ * The support of the basis function with level l and index i in one dimension is assumed to be
+ * contained in \f$[(i - r) h_l, (i + r) h_l]\f$ with \f$h_l = 2^{-l}\f$ and the support radius r
+ * (e.g., r = 1 for hat functions, r = (p + 1) / 2 for B-splines of degree p).
+ */
+class SupportOverlapAssembler {
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage grid storage of the sparse grid
+   * @param supportRadius support radius r of the basis functions (in multiples of \f$h_l\f$)
+   */
+  SupportOverlapAssembler(const base::GridStorage& storage, double supportRadius);
+
+  /**
+   * Determines the grid points whose supports overlap with the support of a grid point.
+   *
+   * @param i               sequence number of the grid point
+   * @param result          sequence numbers of the overlapping grid points in ascending order
+   *                        (including i itself)
+   * @param onlyUpper       if true, only grid points with sequence number >= i are returned
+   */
+  void getOverlappingPoints(size_t i, std::vector<size_t>& result, bool onlyUpper = false) const;
+
+  /**
+   * Assembles the symmetric matrix with the given entries. The entries are only evaluated for
+   * pairs (i, j), i <= j, of grid points with overlapping supports; all other entries are zero.
+   * Exactly one of dense and sparse has to be non-null.
+   *
+   * @param entry     thread-safe functor, entry(i, j) returns the entry (i, j) with i <= j
+   * @param dense     dense matrix that is resized to N x N and overwritten (or nullptr)
+   * @param sparse    CSR matrix that is overwritten (or nullptr); only non-zero entries are stored
+   */
+  template <class ENTRY>
+  void assemble(ENTRY entry, base::DataMatrix* dense, base::SparseDataMatrix* sparse) const;
+
+  /**
+   * @return number of grid points
+   */
+  size_t getSize() const { return size; }
+
+  /**
+   * @return dimensionality of the grid
+   */
+  size_t getDimension() const { return dim; }
+
+ private:
+  /// number of grid points
+  size_t size;
+  /// dimensionality
+  size_t dim;
+  /// support radius
+  double supportRadius;
+  /// levels of the grid points (row-major, size x dim)
+  std::vector<base::level_t> levels;
+  /// indices of the grid points (row-major, size x dim)
+  std::vector<base::index_t> indices;
+  /// left boundaries of the supports (row-major, size x dim)
+  std::vector<double> supportLeft;
+  /// right boundaries of the supports (row-major, size x dim)
+  std::vector<double> supportRight;
+  /**
+   * pointsByLevel[t][l] contains the pairs (index, sequence number) of all grid points with
+   * level l in dimension t, sorted by index
+   */
+  std::vector<std::vector<std::vector<std::pair<base::index_t, size_t>>>> pointsByLevel;
+
+  /**
+   * Appends the grid points whose supports overlap with the support of a grid point in
+   * unspecified order.
+   */
+  void collectOverlappingPoints(size_t i, std::vector<size_t>& result, bool onlyUpper) const;
+
+  /**
+   * Determines the range of grid points in pointsByLevel[t][l2] whose supports overlap with the
+   * support of (l1, i1) in dimension t.
+   */
+  std::pair<size_t, size_t> getOverlappingRange(size_t t, base::level_t l1, base::index_t i1,
+                                                base::level_t l2) const;
+
+  /**
+   * Builds the CSR matrix of the symmetric matrix from the upper triangular parts of the rows.
+   */
+  void buildSymmetricCSR(std::vector<std::vector<size_t>>& upperColumns,
+                         std::vector<std::vector<double>>& upperValues,
+                         base::SparseDataMatrix& sparse) const;
+};
+
+template <class ENTRY>
+void SupportOverlapAssembler::assemble(ENTRY entry, base::DataMatrix* dense,
+                                       base::SparseDataMatrix* sparse) const {
+  if ((dense == nullptr) == (sparse == nullptr)) {
+    throw base::data_exception(
+        "SupportOverlapAssembler::assemble : exactly one output matrix has to be given");
+  }
+
+  std::vector<std::vector<size_t>> upperColumns;
+  std::vector<std::vector<double>> upperValues;
+
+  if (dense != nullptr) {
+    dense->resizeZero(size, size);
+    dense->setAll(0.0);
+  } else {
+    upperColumns.resize(size);
+    upperValues.resize(size);
+  }
+
+#pragma omp parallel
+  {
+    std::vector<size_t> overlapping;
+
+    // rows have very different numbers of overlapping grid points
+#pragma omp for schedule(dynamic, 16)
+    for (size_t i = 0; i < size; i++) {
+      overlapping.clear();
+      collectOverlappingPoints(i, overlapping, true);
+
+      // the rows of the CSR matrix have to be sorted
+      if (sparse != nullptr) {
+        std::sort(overlapping.begin(), overlapping.end());
+      }
+
+      for (size_t j : overlapping) {
+        const double value = entry(i, j);
+
+        // (i, j) and (j, i) are only written by the thread processing row i
+        if (dense != nullptr) {
+          dense->set(i, j, value);
+          dense->set(j, i, value);
+        } else if (value != 0.0) {
+          upperColumns[i].push_back(j);
+          upperValues[i].push_back(value);
+        }
+      }
+    }
+  }
+
+  if (sparse != nullptr) {
+    buildSymmetricCSR(upperColumns, upperValues, *sparse);
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* SUPPORTOVERLAPASSEMBLER_HPP */
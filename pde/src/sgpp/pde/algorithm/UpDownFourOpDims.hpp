@@ -51,6 +51,12 @@ class UpDownFourOpDims : public sgpp::base::OperationMatrix {
 
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Multiplication with the columns of a sgpp::base::DataMatrix,
+   * the columns are multiplied one after another.
+   */
+  using sgpp::base::OperationMatrix::mult;
+
  protected:
   typedef sgpp::base::GridStorage::grid_iterator grid_iterator;
 
@@ -7,6 +7,10 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -14,46 +18,147 @@ UpDownOneOpDim::UpDownOneOpDim(sgpp::base::GridStorage* storage, sgpp::base::Dat
     : storage(storage),
       coefs(&coef),
       algoDims(storage->getAlgorithmicDimensions()),
-      numAlgoDims_(storage->getAlgorithmicDimensions().size()) {}
+      numAlgoDims_(storage->getAlgorithmicDimensions().size()),
+      buffersInUse(false) {}
 
 UpDownOneOpDim::UpDownOneOpDim(sgpp::base::GridStorage* storage)
     : storage(storage),
       coefs(NULL),
       algoDims(storage->getAlgorithmicDimensions()),
-      numAlgoDims_(storage->getAlgorithmicDimensions().size()) {}
+      numAlgoDims_(storage->getAlgorithmicDimensions().size()),
+      buffersInUse(false) {}
 
 UpDownOneOpDim::~UpDownOneOpDim() {}
 
 void UpDownOneOpDim::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
+#pragma omp parallel
+  {
+#pragma omp single nowait
+    { this->multParallelBuildingBlock(alpha, result); }
+  }
+}
 
+void UpDownOneOpDim::mult(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
 #pragma omp parallel
   {
 #pragma omp single nowait
+    { this->multParallelBuildingBlock(alpha, result); }
+  }
+}
+
+void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataMatrix& alpha,
+                                               sgpp::base::DataMatrix& result) {
+  const size_t nrows = alpha.getNrows();
+  const size_t ncols = alpha.getNcols();
+
+  // use the buffers of the operation unless another call is currently working with them,
+  // in that case fall back to buffers local to this call
+  std::vector<sgpp::base::DataMatrix> localDimensionResults;
+  const bool ownsBuffers = !this->buffersInUse.exchange(true, std::memory_order_acquire);
+  std::vector<sgpp::base::DataMatrix>& dimensionResults =
+      ownsBuffers ? this->matrixDimensionResults : localDimensionResults;
+
+  // (re-)allocate the buffers of the dimensions only if the grid or the number of columns
+  // has changed
+  dimensionResults.resize(this->numAlgoDims_);
+
+  for (sgpp::base::DataMatrix& dimensionResult : dimensionResults) {
+    if ((dimensionResult.getNrows() != nrows) || (dimensionResult.getNcols() != ncols)) {
+      dimensionResult.resizeZero(nrows, ncols);
+    }
+  }
+
+  // one up/down per dimension for all columns, each one writes into its own buffer
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    if ((this->coefs != NULL) && (this->coefs->get(i) == 0.0)) continue;
+
+#pragma omp task firstprivate(i) shared(alpha, dimensionResults)
+    {
+      sgpp::base::DataMatrix& beta = dimensionResults[i];
+      beta.setAll(0.0);
+      this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
+
+      if (this->coefs != NULL) {
+        beta.mult(this->coefs->get(i));
+      }
+    }
+  }
+
+#pragma omp taskwait
+
+  // sum up the buffers in the order of the dimensions
+  result.setAll(0.0);
+
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    if ((this->coefs != NULL) && (this->coefs->get(i) == 0.0)) continue;
+
+    result.add(dimensionResults[i]);
+  }
+
+  if (ownsBuffers) {
+    this->buffersInUse.store(false, std::memory_order_release);
+  }
+}
+
+void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
+                                               sgpp::base::DataVector& result) {
+  const size_t size = result.getSize();
+
+  // use the buffers of the operation unless another call is currently working with them,
+  // in that case fall back to buffers local to this call
+  std::vector<sgpp::base::DataVector> localDimensionResults;
+  const bool ownsBuffers = !this->buffersInUse.exchange(true, std::memory_order_acquire);
+  std::vector<sgpp::base::DataVector>& dimensionResults =
+      ownsBuffers ? this->dimensionResults : localDimensionResults;
+
+  // (re-)allocate the buffers of the dimensions only if the grid has changed
+  dimensionResults.resize(this->numAlgoDims_);
+
+  for (sgpp::base::DataVector& dimensionResult : dimensionResults) {
+    if (dimensionResult.getSize() != size) {
+      dimensionResult.resizeZero(size);
+    }
+  }
+
+  // one up/down per dimension, each one writes into its own buffer
+  for (size_t i = 0; i < this->numAlgoDims_; i++) {
+    if ((this->coefs != NULL) && (this->coefs->get(i) == 0.0)) continue;
+
+#pragma omp task firstprivate(i) shared(alpha, dimensionResults)
+    { this->multParallelBuildingBlock(alpha, dimensionResults[i], i); }
+  }
+
+#pragma omp taskwait
+
+  // sum up the buffers, parallel in chunks of the result vector
+  // (every entry is summed up in the order of the dimensions)
+  double* resultData = result.getPointer();
+
+  for (size_t begin = 0; begin < size; begin += sumChunkSize_) {
+#pragma omp task firstprivate(begin) shared(resultData, dimensionResults)
     {
+      const size_t end = std::min(begin + sumChunkSize_, size);
+
+      for (size_t j = begin; j < end; j++) {
+        resultData[j] = 0.0;
+      }
+
       for (size_t i = 0; i < this->numAlgoDims_; i++) {
-#pragma omp task firstprivate(i) shared(alpha, result)
-        {
-          sgpp::base::DataVector beta(result.getSize());
-
-          if (this->coefs != NULL) {
-            if (this->coefs->get(i) != 0.0) {
-              this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-              { result.axpy(this->coefs->get(i), beta); }
-            }
-          } else {
-            this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-            { result.add(beta); }
-          }
+        if ((this->coefs != NULL) && (this->coefs->get(i) == 0.0)) continue;
+
+        const double* dimensionResult = dimensionResults[i].getPointer();
+
+        for (size_t j = begin; j < end; j++) {
+          resultData[j] += dimensionResult[j];
         }
       }
+    }
+  }
 
 #pragma omp taskwait
-    }
+
+  if (ownsBuffers) {
+    this->buffersInUse.store(false, std::memory_order_release);
   }
 }
 
@@ -62,18 +167,14 @@ void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                size_t operationDim) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector beta(result.getSize());
-
   if (this->coefs != NULL) {
     if (this->coefs->get(operationDim) != 0.0) {
-      this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+      this->updown(alpha, result, this->numAlgoDims_ - 1, operationDim);
 
-      result.axpy(this->coefs->get(operationDim), beta);
+      result.mult(this->coefs->get(operationDim));
     }
   } else {
-    this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
-
-    result.add(beta);
+    this->updown(alpha, result, this->numAlgoDims_ - 1, operationDim);
   }
 }
 
@@ -170,5 +271,95 @@ void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVe
     result.add(temp);
   }
 }
+
+void UpDownOneOpDim::updown(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                            size_t dim, size_t op_dim) {
+  size_t curNumAlgoDims = this->numAlgoDims_;
+  size_t curMaxParallelDims = this->maxParallelDims_;
+  const size_t nrows = alpha.getNrows();
+  const size_t ncols = alpha.getNcols();
+
+  if (dim == op_dim) {
+    specialOP(alpha, result, dim, op_dim);
+  } else {
+    // Unidirectional scheme
+    if (dim > 0) {
+      // Reordering ups and downs
+      sgpp::base::DataMatrix temp(nrows, ncols);
+      sgpp::base::DataMatrix result_temp(nrows, ncols);
+      sgpp::base::DataMatrix temp_two(nrows, ncols);
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
+      {
+        up(alpha, temp, this->algoDims[dim]);
+        updown(temp, result, dim - 1, op_dim);
+      }
+
+// Same from the other direction:
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
+                                                                        result_temp)
+      {  // NOLINT(whitespace/braces)
+        updown(alpha, temp_two, dim - 1, op_dim);
+        down(temp_two, result_temp, this->algoDims[dim]);
+      }
+
+#pragma omp taskwait
+
+      result.add(result_temp);
+    } else {
+      // Terminates dimension recursion
+      sgpp::base::DataMatrix temp(nrows, ncols);
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
+      up(alpha, result, this->algoDims[dim]);
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
+      down(alpha, temp, this->algoDims[dim]);
+
+#pragma omp taskwait
+
+      result.add(temp);
+    }
+  }
+}
+
+void UpDownOneOpDim::specialOP(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                               size_t dim, size_t op_dim) {
+  sgpp::base::DataVector alphaColumn(alpha.getNrows());
+  sgpp::base::DataVector resultColumn(alpha.getNrows());
+
+  for (size_t j = 0; j < alpha.getNcols(); j++) {
+    alpha.getColumn(j, alphaColumn);
+    resultColumn.setAll(0.0);
+    specialOP(alphaColumn, resultColumn, dim, op_dim);
+    result.setColumn(j, resultColumn);
+  }
+}
+
+void UpDownOneOpDim::up(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                        size_t dim) {
+  sgpp::base::DataVector alphaColumn(alpha.getNrows());
+  sgpp::base::DataVector resultColumn(alpha.getNrows());
+
+  for (size_t j = 0; j < alpha.getNcols(); j++) {
+    alpha.getColumn(j, alphaColumn);
+    resultColumn.setAll(0.0);
+    up(alphaColumn, resultColumn, dim);
+    result.setColumn(j, resultColumn);
+  }
+}
+
+void UpDownOneOpDim::down(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                          size_t dim) {
+  sgpp::base::DataVector alphaColumn(alpha.getNrows());
+  sgpp::base::DataVector resultColumn(alpha.getNrows());
+
+  for (size_t j = 0; j < alpha.getNcols(); j++) {
+    alpha.getColumn(j, alphaColumn);
+    resultColumn.setAll(0.0);
+    down(alphaColumn, resultColumn, dim);
+    result.setColumn(j, resultColumn);
+  }
+}
 }  // namespace pde
 }  // namespace sgpp
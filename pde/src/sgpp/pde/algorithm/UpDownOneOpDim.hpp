@@ -8,6 +8,7 @@
 
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
@@ -16,6 +17,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <atomic>
 #include <vector>
 
 namespace sgpp {
@@ -50,8 +52,29 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
    */
   virtual ~UpDownOneOpDim();
 
+  /**
+   * Applies the operator to alpha.
+   * The up/downs of the dimensions write into buffers which are kept for subsequent calls.
+   * If the operation is applied concurrently (e.g., from several threads), only one call
+   * works with these buffers, the others use buffers local to the call.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   */
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Applies the operator to all columns of alpha (one row per grid point).
+   * The columns are processed together in the same up/down recursions, hence
+   * the grid is traversed only once per up/down for all columns.
+   * The up/downs of the dimensions are executed as tasks, their results are
+   * summed up in the order of the dimensions. Concurrent calls are handled as for vectors.
+   *
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  virtual void mult(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
   /**
    * This functions provides the same functionality as the normal mult routine.
    * However, it doesn't set up an OpenMP task initialization as the mult routine.
@@ -68,12 +91,40 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
    * in parallel, so here only one up/Down is executed, identified by its special dimension.
    *
    * @param alpha vector of coefficients
-   * @param result vector to store the results in
+   * @param result vector to store the results in (written directly, must not be alpha)
    * @param operationDim Dimension in which the special operator is applied
    */
   void multParallelBuildingBlock(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                  size_t operationDim);
 
+  /**
+   * This functions provides the same functionality as the normal mult routine.
+   * However, it doesn't set up an OpenMP parallel region as the mult routine,
+   * it has to be called within a OpenMP task parallelized region.
+   *
+   * The up/downs of the dimensions are executed as tasks writing into buffers which are
+   * kept for subsequent calls (e.g. in the next timestep), afterwards the buffers are summed
+   * up in parallel chunks of the result vector. If another call is currently working with
+   * these buffers, buffers local to this call are used instead.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   */
+  void multParallelBuildingBlock(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
+
+  /**
+   * This functions provides the same functionality as the mult routine for matrices.
+   * However, it doesn't set up an OpenMP parallel region as the mult routine,
+   * it has to be called within a OpenMP task parallelized region.
+   *
+   * Like for vectors, the buffers of the dimensions are kept for subsequent calls and
+   * concurrent calls fall back to buffers local to the call.
+   *
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  void multParallelBuildingBlock(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
  protected:
   typedef sgpp::base::GridStorage::grid_iterator grid_iterator;
 
@@ -87,6 +138,14 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   const size_t numAlgoDims_;
   /// max number of parallel stages (dimension recursive calls)
   static const size_t maxParallelDims_ = TASKS_PARALLEL_UPDOWN;
+  /// number of entries of the result vector summed up by one task
+  static const size_t sumChunkSize_ = 4096;
+  /// results of the up/downs of the dimensions, reused by subsequent calls
+  std::vector<sgpp::base::DataVector> dimensionResults;
+  /// results of the up/downs of the dimensions for all columns, reused by subsequent calls
+  std::vector<sgpp::base::DataMatrix> matrixDimensionResults;
+  /// set while a call works with dimensionResults or matrixDimensionResults
+  std::atomic<bool> buffersInUse;
 
   /**
    * Recursive procedure for updown(), parallel version using OpenMP 3
@@ -99,6 +158,17 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   void updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim,
               size_t op_dim);
 
+  /**
+   * Recursive procedure for updown(), applied to all columns of alpha at once
+   *
+   * @param dim the current dimension
+   * @param op_dim the dimension in which a special operation is applied
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  void updown(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim,
+              size_t op_dim);
+
   /**
    * All calculations for gradient_dim, parallel version using OpenMP 3
    *
@@ -147,6 +217,38 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
    */
   virtual void upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                        size_t dim) = 0;
+
+  /**
+   * All calculations for gradient_dim, applied to all columns of alpha.
+   * The default implementation applies the vector version to one column after another.
+   *
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   * @param dim the current dimension in the recursion
+   * @param op_dim the dimension in that a special operation is applied
+   */
+  virtual void specialOP(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                         size_t dim, size_t op_dim);
+
+  /**
+   * std 1D up operation applied to all columns of alpha.
+   * The default implementation applies the vector version to one column after another.
+   *
+   * @param dim dimension in which to apply the up-part
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  virtual void up(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
+
+  /**
+   * std 1D down operation applied to all columns of alpha.
+   * The default implementation applies the vector version to one column after another.
+   *
+   * @param dim dimension in which to apply the down-part
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  virtual void down(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
 };
 }  // namespace pde
 }  // namespace sgpp
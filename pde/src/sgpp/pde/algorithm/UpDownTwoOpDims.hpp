@@ -58,6 +58,12 @@ class UpDownTwoOpDims : public sgpp::base::OperationMatrix {
 
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Multiplication with the columns of a sgpp::base::DataMatrix,
+   * the columns are multiplied one after another.
+   */
+  using sgpp::base::OperationMatrix::mult;
+
   /**
    * this functions provides the same functionality as the normal mult routine.
    * However, it doesn't set up an OpenMP task initialization as the mult routine.
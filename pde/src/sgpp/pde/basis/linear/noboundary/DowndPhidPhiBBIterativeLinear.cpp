@@ -46,5 +46,30 @@ void DowndPhidPhiBBIterativeLinear::operator()(sgpp::base::DataVector& alpha,
     }
   }
 }
+
+void DowndPhidPhiBBIterativeLinear::operator()(sgpp::base::DataMatrix& alpha,
+                                               sgpp::base::DataMatrix& result, size_t dim) {
+  // Bounding Box handling
+  sgpp::base::BoundingBox* boundingBox = this->storage->getBoundingBox();
+  double q = boundingBox->getIntervalWidth(dim);
+  double Qqout = 1.0 / q;
+  const size_t ncols = alpha.getNcols();
+  const double* alphaData = alpha.getPointer();
+  double* resultData = result.getPointer();
+
+  // traverse all basis function by sequence number
+  for (size_t i = 0; i < storage->getSize(); i++) {
+    sgpp::base::level_t level;
+    sgpp::base::index_t index;
+    (*storage)[i].get(dim, level, index);
+    // only affects the diagonal of the stiffness matrix
+    const double diagonal = (q != 1.0) ? (Qqout * (static_cast<double>(1 << (level + 1))))
+                                       : static_cast<double>(1 << (level + 1));
+
+    for (size_t j = 0; j < ncols; j++) {
+      resultData[i * ncols + j] = alphaData[i * ncols + j] * diagonal;
+    }
+  }
+}
 }  // namespace pde
 }  // namespace sgpp
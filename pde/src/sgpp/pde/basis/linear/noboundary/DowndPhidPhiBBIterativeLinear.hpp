@@ -7,6 +7,7 @@
 #define DOWNDPHIDPHIDOWNBBITERATIVELINEAR_HPP
 
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -55,6 +56,17 @@ class DowndPhidPhiBBIterativeLinear {
    */
   virtual void operator()(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                           size_t dim);
+
+  /**
+   * This operations performs the calculation of Down in the direction of dimension <i>dim</i>
+   * for all columns of alpha at once (one row per gridpoint).
+   *
+   * @param alpha sgpp::base::DataMatrix that contains the gridpoint's coefficients
+   * @param result sgpp::base::DataMatrix that contains the result of the down operation
+   * @param dim current fixed dimension of the 'execution direction'
+   */
+  virtual void operator()(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                          size_t dim);
 };
 }  // namespace pde
 }  // namespace sgpp
@@ -36,6 +36,24 @@ void PhiPhiDownBBLinear::operator()(sgpp::base::DataVector& source, sgpp::base::
   }
 }
 
+void PhiPhiDownBBLinear::operator()(sgpp::base::DataMatrix& source,
+                                    sgpp::base::DataMatrix& result, grid_iterator& index,
+                                    size_t dim) {
+  double q = this->boundingBox->getIntervalWidth(dim);
+  const size_t ncols = source.getNcols();
+
+  // the first slot holds the (zero) boundary values of the whole pole
+  if (matrixBuffer.size() < ncols) {
+    matrixBuffer.resize(ncols);
+  }
+
+  for (size_t j = 0; j < ncols; j++) {
+    matrixBuffer[j] = 0.0;
+  }
+
+  recMatrix(source, result, index, dim, 0, 0, q);
+}
+
 void PhiPhiDownBBLinear::rec(sgpp::base::DataVector& source, sgpp::base::DataVector& result,
                              grid_iterator& index, size_t dim, double fl, double fr) {
   size_t seq = index.seq();
@@ -111,5 +129,56 @@ void PhiPhiDownBBLinear::recBB(sgpp::base::DataVector& source, sgpp::base::DataV
   }
 }
 
+void PhiPhiDownBBLinear::recMatrix(sgpp::base::DataMatrix& source,
+                                   sgpp::base::DataMatrix& result, grid_iterator& index,
+                                   size_t dim, size_t fl, size_t fr, double q) {
+  const size_t ncols = source.getNcols();
+  size_t seq = index.seq();
+
+  sgpp::base::level_t l;
+  sgpp::base::index_t i;
+
+  index.get(dim, l, i);
+
+  // the midpoint values are stored in the slot of the current level,
+  // the buffer is only addressed by offsets as it may grow in the recursion
+  const size_t fm = ncols * (l + 1);
+
+  if (matrixBuffer.size() < fm + ncols) {
+    matrixBuffer.resize(fm + ncols);
+  }
+
+  double* buffer = matrixBuffer.data();
+  const double* alpha_values = source.getPointer() + seq * ncols;
+  double* result_values = result.getPointer() + seq * ncols;
+  double h = 1.0 / static_cast<double>(1 << l);
+
+  for (size_t j = 0; j < ncols; j++) {
+    double tmp_m = ((buffer[fl + j] + buffer[fr + j]) / 2.0);
+
+    // integration
+    result_values[j] = ((h * tmp_m) + (((2.0 / 3.0) * h) * alpha_values[j])) * q;
+
+    // dehierarchisation
+    buffer[fm + j] = tmp_m + alpha_values[j];
+  }
+
+  if (!index.hint()) {
+    index.leftChild(dim);
+
+    if (!storage->isInvalidSequenceNumber(index.seq())) {
+      recMatrix(source, result, index, dim, fl, fm, q);
+    }
+
+    index.stepRight(dim);
+
+    if (!storage->isInvalidSequenceNumber(index.seq())) {
+      recMatrix(source, result, index, dim, fm, fr, q);
+    }
+
+    index.up(dim);
+  }
+}
+
 }  // namespace pde
 }  // namespace sgpp
@@ -7,10 +7,13 @@
 #define PHIPHIDOWNBBLINEAR_HPP
 
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -26,6 +29,8 @@ class PhiPhiDownBBLinear {
   sgpp::base::GridStorage* storage;
   /// Pointer to the bounding box Obejct
   sgpp::base::BoundingBox* boundingBox;
+  /// midpoint values of all columns in the recursion for matrices, one slot per level
+  std::vector<double> matrixBuffer;
 
  public:
   /**
@@ -53,6 +58,18 @@ class PhiPhiDownBBLinear {
   virtual void operator()(sgpp::base::DataVector& source, sgpp::base::DataVector& result,
                           grid_iterator& index, size_t dim);
 
+  /**
+   * This operations performs the calculation of down in the direction of dimension <i>dim</i>
+   * for all columns of source at once (one row per gridpoint).
+   *
+   * @param source sgpp::base::DataMatrix that contains the gridpoint's coefficients
+   * @param result sgpp::base::DataMatrix that contains the result of the down operation
+   * @param index a iterator object of the grid
+   * @param dim current fixed dimension of the 'execution direction'
+   */
+  virtual void operator()(sgpp::base::DataMatrix& source, sgpp::base::DataMatrix& result,
+                          grid_iterator& index, size_t dim);
+
  protected:
   /**
    * recursive function for the calculation of Down without Bounding Box
@@ -81,6 +98,21 @@ class PhiPhiDownBBLinear {
    */
   void recBB(sgpp::base::DataVector& source, sgpp::base::DataVector& result, grid_iterator& index,
              size_t dim, double fl, double fr, double q, double t);
+
+  /**
+   * recursive function for the calculation of Down for all columns of a matrix,
+   * the boundary values of the columns are stored in matrixBuffer
+   *
+   * @param source sgpp::base::DataMatrix that contains the coefficients of the ansatzfunction
+   * @param result sgpp::base::DataMatrix in which the result of the operation is stored
+   * @param index reference to a griditerator object that is used navigate through the grid
+   * @param dim the dimension in which the operation is executed
+   * @param fl offset of the function values on the left boundary in matrixBuffer
+   * @param fr offset of the function values on the right boundary in matrixBuffer
+   * @param q interval width in the current dimension <i>dim</i>
+   */
+  void recMatrix(sgpp::base::DataMatrix& source, sgpp::base::DataMatrix& result,
+                 grid_iterator& index, size_t dim, size_t fl, size_t fr, double q);
 };
 
 }  // namespace pde
@@ -37,6 +37,20 @@ void PhiPhiUpBBLinear::operator()(sgpp::base::DataVector& source, sgpp::base::Da
   }
 }
 
+void PhiPhiUpBBLinear::operator()(sgpp::base::DataMatrix& source,
+                                  sgpp::base::DataMatrix& result, grid_iterator& index,
+                                  size_t dim) {
+  double q = boundingBox->getIntervalWidth(dim);
+  const size_t ncols = source.getNcols();
+
+  // the first slot holds the boundary values of the whole pole
+  if (matrixBuffer.size() < 2 * ncols) {
+    matrixBuffer.resize(2 * ncols);
+  }
+
+  recMatrix(source, result, index, dim, 0, ncols, q);
+}
+
 void PhiPhiUpBBLinear::rec(sgpp::base::DataVector& source, sgpp::base::DataVector& result,
                            grid_iterator& index, size_t dim, double& fl, double& fr) {
   size_t seq = index.seq();
@@ -120,5 +134,66 @@ void PhiPhiUpBBLinear::recBB(sgpp::base::DataVector& source, sgpp::base::DataVec
   fr = tmp + fr;
 }
 
+void PhiPhiUpBBLinear::recMatrix(sgpp::base::DataMatrix& source,
+                                 sgpp::base::DataMatrix& result, grid_iterator& index,
+                                 size_t dim, size_t fl, size_t fr, double q) {
+  const size_t ncols = source.getNcols();
+  size_t seq = index.seq();
+
+  sgpp::base::level_t current_level;
+  sgpp::base::index_t current_index;
+
+  index.get(dim, current_level, current_index);
+
+  // the values of the children are stored in the slot of the current level,
+  // the buffer is only addressed by offsets as it may grow in the recursion
+  const size_t fml = 2 * ncols * (current_level + 1);
+  const size_t fmr = fml + ncols;
+
+  if (matrixBuffer.size() < fmr + ncols) {
+    matrixBuffer.resize(fmr + ncols);
+  }
+
+  for (size_t j = 0; j < ncols; j++) {
+    matrixBuffer[fl + j] = 0.0;
+    matrixBuffer[fr + j] = 0.0;
+    matrixBuffer[fml + j] = 0.0;
+    matrixBuffer[fmr + j] = 0.0;
+  }
+
+  if (!index.hint()) {
+    index.leftChild(dim);
+
+    if (!storage->isInvalidSequenceNumber(index.seq())) {
+      recMatrix(source, result, index, dim, fl, fml, q);
+    }
+
+    index.stepRight(dim);
+
+    if (!storage->isInvalidSequenceNumber(index.seq())) {
+      recMatrix(source, result, index, dim, fmr, fr, q);
+    }
+
+    index.up(dim);
+  }
+
+  double* buffer = matrixBuffer.data();
+  const double* alpha_values = source.getPointer() + seq * ncols;
+  double* result_values = result.getPointer() + seq * ncols;
+  const double level_factor = static_cast<double>(1 << (current_level + 1));
+
+  for (size_t j = 0; j < ncols; j++) {
+    double fm = buffer[fml + j] + buffer[fmr + j];
+
+    // transposed operations:
+    result_values[j] = fm;
+
+    double tmp = ((fm / 2.0) + ((alpha_values[j] / level_factor) * q));
+
+    buffer[fl + j] = tmp + buffer[fl + j];
+    buffer[fr + j] = tmp + buffer[fr + j];
+  }
+}
+
 }  // namespace pde
 }  // namespace sgpp
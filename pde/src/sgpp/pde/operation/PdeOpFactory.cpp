@@ -156,6 +156,16 @@ base::OperationMatrix* createOperationLaplaceExplicit(base::DataMatrix* m, base:
   }
 }
 
+base::OperationMatrix* createOperationLaplaceExplicit(base::SparseDataMatrix* m,
+                                                      base::Grid& grid) {
+  if (grid.getType() == base::GridType::Linear) {
+    return new pde::OperationLaplaceExplicitLinear(m, &grid.getStorage());
+  } else {
+    throw base::factory_exception(
+        "Sparse OperationLaplaceExplicit is not implemented for this grid type.");
+  }
+}
+
 base::OperationMatrix* createOperationLTwoDotProduct(base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear) {
     return new pde::OperationLTwoDotProductLinear(&grid.getStorage());
@@ -272,6 +282,22 @@ base::OperationMatrix* createOperationLTwoDotExplicit(base::DataMatrix* m, base:
   }
 }
 
+base::OperationMatrix* createOperationLTwoDotExplicit(base::SparseDataMatrix* m,
+                                                      base::Grid& grid) {
+  if (grid.getType() == base::GridType::Linear) {
+    return new pde::OperationMatrixLTwoDotExplicitLinear(m, &grid);
+  } else if (grid.getType() == base::GridType::ModLinear) {
+    return new pde::OperationMatrixLTwoDotExplicitModLinear(m, &grid);
+  } else if (grid.getType() == base::GridType::Bspline) {
+    return new pde::OperationMatrixLTwoDotExplicitBspline(m, &grid);
+  } else if (grid.getType() == base::GridType::Poly) {
+    return new pde::OperationMatrixLTwoDotExplicitPoly(m, &grid);
+  } else {
+    throw base::factory_exception(
+        "Sparse OperationLTwoDotExplicit is not implemented for this grid type.");
+  }
+}
+
 base::OperationMatrix* createOperationLaplaceEnhanced(base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear) {
     return new pde::OperationLaplaceEnhancedLinear(&grid.getStorage());
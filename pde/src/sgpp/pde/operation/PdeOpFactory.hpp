@@ -6,6 +6,7 @@
 #ifndef PDE_OP_FACTORY_HPP
 #define PDE_OP_FACTORY_HPP
 
+#include <sgpp/base/datatypes/SparseDataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
@@ -59,6 +60,20 @@ base::OperationMatrix* createOperationLaplaceExplicit(base::Grid& grid);
 base::OperationMatrix* createOperationLaplaceExplicit(
     base::DataMatrix* m, base::Grid& grid);
 
+/**
+   * Factory method, returning an OperationLaplaceExplicit (OperationMatrix) that stores the
+   * matrix in compressed sparse row format. Only pairs of basis functions with overlapping
+   * supports are visited during the assembly. Supported for linear grids.
+   * Note: object has to be freed after use. The SparseDataMatrix m is not destroyed if the
+   * OperationMatrix is destroyed.
+   *
+   * @param m SparseDataMatrix in which the matrix is stored
+   * @param grid Grid which is to be used
+   * @return Pointer to the new OperationMatrix object for the Grid grid
+   */
+base::OperationMatrix* createOperationLaplaceExplicit(
+    base::SparseDataMatrix* m, base::Grid& grid);
+
 /**
  * Factory method, returning an OperationLTwoDotProduct (OperationMatrix) for the grid at hand.
  * Note: object has to be freed after use.
@@ -89,6 +104,21 @@ base::OperationMatrix* createOperationLTwoDotExplicit(base::Grid& grid);
 base::OperationMatrix* createOperationLTwoDotExplicit(
     base::DataMatrix* m, base::Grid& grid);
 
+/**
+   * Factory method, returning an OperationLTwoDotExplicit (OperationMatrix) that stores the
+   * matrix in compressed sparse row format. Only pairs of basis functions with overlapping
+   * supports are visited during the assembly. Supported for linear, modified linear,
+   * polynomial and B-spline grids.
+   * Note: object has to be freed after use. The SparseDataMatrix m is not destroyed if the
+   * OperationMatrix is destroyed.
+   *
+   * @param m SparseDataMatrix in which the matrix is stored
+   * @param grid Grid which is to be used
+   * @return Pointer to the new OperationMatrix object for the Grid grid
+   */
+base::OperationMatrix* createOperationLTwoDotExplicit(
+    base::SparseDataMatrix* m, base::Grid& grid);
+
 /**
  * Factory method, returning an OperationLaplace (OperationMatrix) for the grid at hand.
  * Note: object has to be freed after use.
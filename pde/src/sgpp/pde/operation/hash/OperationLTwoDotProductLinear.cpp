@@ -37,5 +37,35 @@ void OperationLTwoDotProductLinear::down(sgpp::base::DataVector& alpha,
 
   s.sweep1D(alpha, result, dim);
 }
+
+void OperationLTwoDotProductLinear::up(sgpp::base::DataMatrix& alpha,
+                                       sgpp::base::DataMatrix& result, size_t dim) {
+  // the sweep over matrices descends only in the algorithmic dimensions
+  if (this->numAlgoDims_ != this->storage->getDimension()) {
+    StdUpDown::up(alpha, result, dim);
+    return;
+  }
+
+  // phi * phi
+  PhiPhiUpBBLinear func(this->storage);
+  sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
+
+  s.sweep1D(alpha, result, dim);
+}
+
+void OperationLTwoDotProductLinear::down(sgpp::base::DataMatrix& alpha,
+                                         sgpp::base::DataMatrix& result, size_t dim) {
+  // the sweep over matrices descends only in the algorithmic dimensions
+  if (this->numAlgoDims_ != this->storage->getDimension()) {
+    StdUpDown::down(alpha, result, dim);
+    return;
+  }
+
+  // phi * phi
+  PhiPhiDownBBLinear func(this->storage);
+  sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
+
+  s.sweep1D(alpha, result, dim);
+}
 }  // namespace pde
 }  // namespace sgpp
@@ -53,6 +53,26 @@ class OperationLTwoDotProductLinear : public StdUpDown {
    * @param result vector to store the results in
    */
   virtual void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
+
+  /**
+   * Up-step in dimension <i>dim</i> for \f$(\phi_i(x),\phi_j(x))_{L_2}\f$,
+   * applied to all columns of alpha within one traversal of the grid.
+   *
+   * @param dim dimension in which to apply the up-part
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  virtual void up(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
+
+  /**
+   * Down-step in dimension <i>dim</i> for \f$(\phi_i(x),\phi_j(x))_{L_2}\f$,
+   * applied to all columns of alpha within one traversal of the grid.
+   *
+   * @param dim dimension in which to apply the down-part
+   * @param alpha matrix of coefficients, one coefficient vector per column
+   * @param result matrix to store the results in
+   */
+  virtual void down(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
 };
 }  // namespace pde
 }  // namespace sgpp
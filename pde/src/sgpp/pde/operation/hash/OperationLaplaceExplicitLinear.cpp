@@ -4,10 +4,12 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/type/LinearGrid.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
+#include <sgpp/pde/algorithm/SupportOverlapAssembler.hpp>
 #include <sgpp/pde/operation/hash/OperationLaplaceExplicitLinear.hpp>
 #include <sgpp/pde/operation/hash/OperationLaplaceLinear.hpp>
 #include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiDownBBLinear.hpp>
@@ -30,28 +32,86 @@ namespace pde {
 
 OperationLaplaceExplicitLinear::OperationLaplaceExplicitLinear(sgpp::base::DataMatrix* m,
                                                                sgpp::base::GridStorage* storage)
-  : UpDownOneOpDim(storage), ownsMatrix_(false) {
+  : UpDownOneOpDim(storage), sparseM_(nullptr), ownsMatrix_(false) {
   m_ = m;
   buildMatrix(storage);
 }
 
 OperationLaplaceExplicitLinear::OperationLaplaceExplicitLinear(sgpp::base::GridStorage* storage)
-  : UpDownOneOpDim(storage), ownsMatrix_(true) {
+  : UpDownOneOpDim(storage), sparseM_(nullptr), ownsMatrix_(true) {
   m_ = new sgpp::base::DataMatrix(storage->getSize(), storage->getSize());
   buildMatrix(storage);
 }
 
+OperationLaplaceExplicitLinear::OperationLaplaceExplicitLinear(sgpp::base::SparseDataMatrix* m,
+                                                               sgpp::base::GridStorage* storage)
+  : UpDownOneOpDim(storage), m_(nullptr), sparseM_(m), ownsMatrix_(false) {
+  buildMatrix(storage);
+}
+
 void OperationLaplaceExplicitLinear::buildMatrix(sgpp::base::GridStorage* storage) {
-  size_t ncols = m_->getNcols();
-  base::DataVector alpha(ncols);
-  base::DataVector beta(ncols);
-  // FIXME: inefficient
-  for (size_t i = 0; i < ncols; i++) {
-    alpha.setAll(0.0);
-    alpha.set(i, 1.0);
-    UpDownOneOpDim::mult(alpha, beta);
-    m_->setColumn(i, beta);
+  const size_t gridDim = storage->getDimension();
+
+  // The entries are sum_k (dPhi_i_k, dPhi_j_k) * prod_{t != k} (Phi_i_t, Phi_j_t), which
+  // vanish if the supports of Phi_i and Phi_j do not overlap. If two hat functions of different
+  // levels overlap, the smaller one lies within a linear piece of the larger one, i.e., their
+  // derivatives are orthogonal and the L2 product is h_small * Phi_large(x_small).
+  // On a bounding box, the 1D mass terms scale with the interval width q_k and the 1D stiffness
+  // terms with 1 / q_k.
+  std::vector<double> intervalWidths(gridDim);
+  base::BoundingBox* boundingBox = storage->getBoundingBox();
+
+  for (size_t k = 0; k < gridDim; k++) {
+    intervalWidths[k] = boundingBox->getIntervalWidth(k);
   }
+
+  SupportOverlapAssembler assembler(*storage, 1.0);
+
+  assembler.assemble(
+      [storage, gridDim, &intervalWidths](size_t i, size_t j) {
+        const base::GridPoint& pointI = storage->getPoint(i);
+        const base::GridPoint& pointJ = storage->getPoint(j);
+        double mass = 1.0;
+        double stiffnessOverMass = 0.0;
+
+        for (size_t k = 0; k < gridDim; k++) {
+          const base::level_t lik = pointI.getLevel(k);
+          const base::level_t ljk = pointJ.getLevel(k);
+          const base::index_t iik = pointI.getIndex(k);
+          const base::index_t ijk = pointJ.getIndex(k);
+          const double q = intervalWidths[k];
+
+          if (lik == ljk) {
+            if (iik != ijk) {
+              return 0.0;
+            }
+
+            // identical hat functions: (Phi, Phi) = 2h/3, (dPhi, dPhi) = 2/h
+            const double h = 1.0 / static_cast<double>(1 << lik);
+            mass *= 2.0 * h * q / 3.0;
+            stiffnessOverMass += 3.0 / (h * h * q * q);
+          } else {
+            const base::level_t lSmall = std::max(lik, ljk);
+            const base::level_t lLarge = std::min(lik, ljk);
+            const base::index_t iSmall = (lik > ljk) ? iik : ijk;
+            const base::index_t iLarge = (lik > ljk) ? ijk : iik;
+            const double hSmall = 1.0 / static_cast<double>(1 << lSmall);
+            const double xSmall = static_cast<double>(iSmall) * hSmall;
+            const double value =
+                1.0 - std::abs(xSmall * static_cast<double>(1 << lLarge) -
+                               static_cast<double>(iLarge));
+
+            if (value <= 0.0) {
+              return 0.0;
+            }
+
+            mass *= hSmall * q * value;
+          }
+        }
+
+        return mass * stiffnessOverMass;
+      },
+      m_, sparseM_);
 }
 
 OperationLaplaceExplicitLinear::~OperationLaplaceExplicitLinear() {
@@ -60,6 +120,11 @@ OperationLaplaceExplicitLinear::~OperationLaplaceExplicitLinear() {
 
 void OperationLaplaceExplicitLinear::mult(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result) {
+  if (sparseM_ != nullptr) {
+    sparseM_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -84,6 +149,12 @@ void OperationLaplaceExplicitLinear::mult(sgpp::base::DataVector& alpha,
   }
 }
 
+void OperationLaplaceExplicitLinear::mult(sgpp::base::DataMatrix& alpha,
+                                          sgpp::base::DataMatrix& result) {
+  // the up/down scheme of UpDownOneOpDim is not used by the explicit matrix
+  sgpp::base::OperationMatrix::mult(alpha, result);
+}
+
 void OperationLaplaceExplicitLinear::specialOP(sgpp::base::DataVector& alpha,
                                                sgpp::base::DataVector& result, size_t dim,
                                                size_t gradient_dim) {
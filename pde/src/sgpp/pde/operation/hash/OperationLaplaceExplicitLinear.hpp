@@ -7,6 +7,7 @@
 
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/SparseDataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/pde/operation/hash/OperationLaplaceLinear.hpp>
 
@@ -36,6 +37,18 @@ class OperationLaplaceExplicitLinear : public UpDownOneOpDim {
    */
   explicit OperationLaplaceExplicitLinear(sgpp::base::GridStorage* storage);
 
+  /**
+   * Constructor that assembles the matrix in compressed sparse row format into an external
+   * matrix, i.e. matrix is NOT destroyed by the destructor of OperationLaplaceExplicitLinear.
+   * Only pairs of basis functions with overlapping supports are considered.
+   *
+   * @param m pointer to the sparse matrix, overwritten with the (number of grid points) x
+   * (number of grid points) matrix
+   * @param storage pointer to the sparse grid storage
+   */
+  OperationLaplaceExplicitLinear(sgpp::base::SparseDataMatrix* m,
+                                 sgpp::base::GridStorage* storage);
+
   /**
    * Destructor
    */
@@ -48,6 +61,16 @@ class OperationLaplaceExplicitLinear : public UpDownOneOpDim {
    * @param result DataVector into which the result of multiplication is stored
    */
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
+
+  /**
+   * Multiplication of the explicit matrix with the columns of alpha,
+   * one column after another
+   *
+   * @param alpha DataMatrix whose columns are multiplied to the matrix
+   * @param result DataMatrix into which the results of multiplication are stored
+   */
+  virtual void mult(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
   virtual void specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim,
                          size_t gradient_dim);
 
@@ -61,11 +84,12 @@ class OperationLaplaceExplicitLinear : public UpDownOneOpDim {
 
  private:
   /**
-   * This method is used by both constructors to build the matrix
+   * This method is used by all constructors to build the matrix
    */
   void buildMatrix(sgpp::base::GridStorage* storage);
 
   sgpp::base::DataMatrix* m_;
+  sgpp::base::SparseDataMatrix* sparseM_;
   bool ownsMatrix_;
 };
 
@@ -63,5 +63,48 @@ void OperationLaplaceLinear::downOpDim(sgpp::base::DataVector& alpha,
 
 void OperationLaplaceLinear::upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                      size_t dim) {}
+
+void OperationLaplaceLinear::specialOP(sgpp::base::DataMatrix& alpha,
+                                       sgpp::base::DataMatrix& result, size_t dim,
+                                       size_t gradient_dim) {
+  // In direction gradient_dim we only calculate the norm of the gradient
+  // The up-part is empty, thus omitted
+  DowndPhidPhiBBIterativeLinear myDown(this->storage);
+
+  if (dim > 0) {
+    sgpp::base::DataMatrix temp(alpha.getNrows(), alpha.getNcols());
+    updown(alpha, temp, dim - 1, gradient_dim);
+    myDown(temp, result, gradient_dim);
+  } else {
+    // Terminates dimension recursion
+    myDown(alpha, result, gradient_dim);
+  }
+}
+
+void OperationLaplaceLinear::up(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                                size_t dim) {
+  // the sweep over matrices descends only in the algorithmic dimensions
+  if (this->numAlgoDims_ != this->storage->getDimension()) {
+    UpDownOneOpDim::up(alpha, result, dim);
+    return;
+  }
+
+  PhiPhiUpBBLinear func(this->storage);
+  sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
+  s.sweep1D(alpha, result, dim);
+}
+
+void OperationLaplaceLinear::down(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result,
+                                  size_t dim) {
+  // the sweep over matrices descends only in the algorithmic dimensions
+  if (this->numAlgoDims_ != this->storage->getDimension()) {
+    UpDownOneOpDim::down(alpha, result, dim);
+    return;
+  }
+
+  PhiPhiDownBBLinear func(this->storage);
+  sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
+  s.sweep1D(alpha, result, dim);
+}
 }  // namespace pde
 }  // namespace sgpp
@@ -50,6 +50,13 @@ class OperationLaplaceLinear : public UpDownOneOpDim {
   virtual void downOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
   virtual void upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
+
+  virtual void specialOP(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim,
+                         size_t gradient_dim);
+
+  virtual void up(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
+
+  virtual void down(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, size_t dim);
 };
 }  // namespace pde
 }  // namespace sgpp
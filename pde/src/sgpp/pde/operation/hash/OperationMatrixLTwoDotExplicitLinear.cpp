@@ -5,6 +5,7 @@
 
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/algorithm/SupportOverlapAssembler.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitLinear.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -19,17 +20,23 @@ namespace pde {
 
 OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
-    : ownsMatrix_(false) {
+    : sparseM_(nullptr), ownsMatrix_(false) {
   m_ = m;
   buildMatrix(grid);
 }
 
 OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear(sgpp::base::Grid* grid)
-    : ownsMatrix_(true) {
+    : sparseM_(nullptr), ownsMatrix_(true) {
   m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
   buildMatrix(grid);
 }
 
+OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear(
+    sgpp::base::SparseDataMatrix* m, sgpp::base::Grid* grid)
+    : m_(nullptr), sparseM_(m), ownsMatrix_(false) {
+  buildMatrix(grid);
+}
+
 void OperationMatrixLTwoDotExplicitLinear::buildMatrix(sgpp::base::Grid* grid) {
   size_t gridSize = grid->getSize();
   size_t gridDim = grid->getDimension();
@@ -39,32 +46,27 @@ void OperationMatrixLTwoDotExplicitLinear::buildMatrix(sgpp::base::Grid* grid) {
 
   grid->getStorage().getLevelIndexArraysForEval(level, index);
 
-  for (size_t i = 0; i < gridSize; i++) {
-#pragma omp parallel for schedule(guided)
-    for (size_t j = i; j < gridSize; j++) {
-      double res = 1;
-
-      for (size_t k = 0; k < gridDim; k++) {
-        double lik = level.get(i, k);
-        double ljk = level.get(j, k);
-        double iik = index.get(i, k);
-        double ijk = index.get(j, k);
-
-        if (lik == ljk) {
-          if (iik == ijk) {
-            // Use formula for identical ansatz functions:
-            res *= 2 / lik / 3;
-          } else {
-            // Different index, but same level => ansatz functions do not overlap:
-            res = 0.;
-            break;
-          }
-        } else {
-          if (std::max((iik - 1) / lik, (ijk - 1) / ljk) >=
-              std::min((iik + 1) / lik, (ijk + 1) / ljk)) {
-            // Ansatz functions do not not overlap:
-            res = 0.;
-            break;
+  // only pairs of hat functions with overlapping supports are visited
+  SupportOverlapAssembler assembler(grid->getStorage(), 1.0);
+
+  assembler.assemble(
+      [&level, &index, gridDim](size_t i, size_t j) {
+        double res = 1;
+
+        for (size_t k = 0; k < gridDim; k++) {
+          double lik = level.get(i, k);
+          double ljk = level.get(j, k);
+          double iik = index.get(i, k);
+          double ijk = index.get(j, k);
+
+          if (lik == ljk) {
+            if (iik == ijk) {
+              // Use formula for identical ansatz functions:
+              res *= 2 / lik / 3;
+            } else {
+              // Different index, but same level => ansatz functions do not overlap:
+              return 0.;
+            }
           } else {
             // Use formula for different overlapping ansatz functions:
             if (lik > ljk) {                            // Phi_i_k is the "smaller" ansatz function
@@ -82,12 +84,10 @@ void OperationMatrixLTwoDotExplicitLinear::buildMatrix(sgpp::base::Grid* grid) {
             }
           }
         }
-      }
 
-      m_->set(i, j, res);
-      m_->set(j, i, res);
-    }
-  }
+        return res;
+      },
+      m_, sparseM_);
 }
 
 OperationMatrixLTwoDotExplicitLinear::~OperationMatrixLTwoDotExplicitLinear() {
@@ -96,6 +96,11 @@ OperationMatrixLTwoDotExplicitLinear::~OperationMatrixLTwoDotExplicitLinear() {
 
 void OperationMatrixLTwoDotExplicitLinear::mult(sgpp::base::DataVector& alpha,
                                                 sgpp::base::DataVector& result) {
+  if (sparseM_ != nullptr) {
+    sparseM_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -8,6 +8,7 @@
 
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/SparseDataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -36,6 +37,18 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
    */
   explicit OperationMatrixLTwoDotExplicitModLinear(sgpp::base::Grid* grid);
 
+  /**
+   * Constructor that assembles the matrix in compressed sparse row format into an external
+   * matrix, i.e. matrix is NOT destroyed by the destructor of
+   * OperationMatrixLTwoDotExplicitModLinear. Only pairs of basis functions
+   * with overlapping supports are considered.
+   *
+   * @param m pointer to the sparse matrix, overwritten with the (number of grid points) x
+   * (number of grid points) matrix
+   * @param grid the sparse grid
+   */
+  OperationMatrixLTwoDotExplicitModLinear(sgpp::base::SparseDataMatrix* m, sgpp::base::Grid* grid);
+
   /**
    * Destructor
    */
@@ -51,11 +64,12 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
 
  private:
   /**
-   * This method is used by both constructors to build the matrix
+   * This method is used by all constructors to build the matrix
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
   sgpp::base::DataMatrix* m_;
+  sgpp::base::SparseDataMatrix* sparseM_;
   bool ownsMatrix_;
 };
 
@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitPoly.hpp>
+#include <sgpp/pde/algorithm/SupportOverlapAssembler.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/grid/type/PolyGrid.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
@@ -21,19 +22,24 @@ namespace pde {
 
 OperationMatrixLTwoDotExplicitPoly::OperationMatrixLTwoDotExplicitPoly(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
-    : ownsMatrix_(false) {
+    : sparseM_(nullptr), ownsMatrix_(false) {
   m_ = m;
   buildMatrix(grid);
 }
 
 OperationMatrixLTwoDotExplicitPoly::OperationMatrixLTwoDotExplicitPoly(sgpp::base::Grid* grid)
-    : ownsMatrix_(true) {
+    : sparseM_(nullptr), ownsMatrix_(true) {
   m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
   buildMatrix(grid);
 }
 
+OperationMatrixLTwoDotExplicitPoly::OperationMatrixLTwoDotExplicitPoly(
+    sgpp::base::SparseDataMatrix* m, sgpp::base::Grid* grid)
+    : m_(nullptr), sparseM_(m), ownsMatrix_(false) {
+  buildMatrix(grid);
+}
+
 void OperationMatrixLTwoDotExplicitPoly::buildMatrix(sgpp::base::Grid* grid) {
-  size_t gridSize = grid->getSize();
   size_t gridDim = grid->getDimension();
   const size_t p = dynamic_cast<sgpp::base::PolyGrid*>(grid)->getDegree();
   // const double pp1hDbl = static_cast<double>(pp1h);
@@ -45,39 +51,40 @@ void OperationMatrixLTwoDotExplicitPoly::buildMatrix(sgpp::base::Grid* grid) {
   base::DataVector weights;
   base::GaussLegendreQuadRule1D gauss;
   gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
-  for (size_t i = 0; i < gridSize; i++) {
-    for (size_t j = i; j < gridSize; j++) {
-      double res = 1.0;
-      for (size_t k = 0; k < gridDim; k++) {
-        const base::level_t lik = storage[i].getLevel(k);
-        const base::level_t ljk = storage[j].getLevel(k);
-        const base::index_t iik = storage[i].getIndex(k);
-        const base::index_t ijk = storage[j].getIndex(k);
-        const double left_i = 1.0/(1 << lik) * (iik - 1);
-        const double left_j = 1.0/(1 << ljk) * (ijk - 1);
-        const double right_i = 1.0/(1 << lik) * (iik + 1);
-        const double right_j = 1.0/(1 << ljk) * (ijk + 1);
-
-        if (left_j >= right_i || left_i >= right_j) {
-          // Ansatz functions do not not overlap:
-          res = 0.0;
-          break;
-        } else {
-          const double left = std::max(left_i, left_j);
-          const double right = std::min(right_i, right_j);
-          const double scaling = right - left;
-          double temp_res = 0.0;
-          for (size_t c = 0; c < quadOrder; c++) {
-            const double x = left + scaling * coordinates[c];
-            temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
+  SupportOverlapAssembler assembler(storage, 1.0);
+
+  assembler.assemble(
+      [&](size_t i, size_t j) {
+        double res = 1.0;
+        for (size_t k = 0; k < gridDim; k++) {
+          const base::level_t lik = storage[i].getLevel(k);
+          const base::level_t ljk = storage[j].getLevel(k);
+          const base::index_t iik = storage[i].getIndex(k);
+          const base::index_t ijk = storage[j].getIndex(k);
+          const double left_i = 1.0/(1 << lik) * (iik - 1);
+          const double left_j = 1.0/(1 << ljk) * (ijk - 1);
+          const double right_i = 1.0/(1 << lik) * (iik + 1);
+          const double right_j = 1.0/(1 << ljk) * (ijk + 1);
+
+          if (left_j >= right_i || left_i >= right_j) {
+            // Ansatz functions do not not overlap:
+            return 0.;
+          } else {
+            const double left = std::max(left_i, left_j);
+            const double right = std::min(right_i, right_j);
+            const double scaling = right - left;
+            double temp_res = 0.0;
+            for (size_t c = 0; c < quadOrder; c++) {
+              const double x = left + scaling * coordinates[c];
+              temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
+            }
+            res *= scaling*temp_res;
           }
-          res *= scaling*temp_res;
         }
-      }
-      m_->set(i, j, res);
-      m_->set(j, i, res);
-    }
-  }
+
+        return res;
+      },
+      m_, sparseM_);
 }
 
 OperationMatrixLTwoDotExplicitPoly::~OperationMatrixLTwoDotExplicitPoly() {
@@ -86,6 +93,11 @@ OperationMatrixLTwoDotExplicitPoly::~OperationMatrixLTwoDotExplicitPoly() {
 
 void OperationMatrixLTwoDotExplicitPoly::mult(sgpp::base::DataVector& alpha,
                                                  sgpp::base::DataVector& result) {
+  if (sparseM_ != nullptr) {
+    sparseM_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -7,6 +7,7 @@
 
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/SparseDataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -35,6 +36,18 @@ class OperationMatrixLTwoDotExplicitPoly : public sgpp::base::OperationMatrix {
    */
   explicit OperationMatrixLTwoDotExplicitPoly(sgpp::base::Grid* grid);
 
+  /**
+   * Constructor that assembles the matrix in compressed sparse row format into an external
+   * matrix, i.e. matrix is NOT destroyed by the destructor of
+   * OperationMatrixLTwoDotExplicitPoly. Only pairs of basis functions
+   * with overlapping supports are considered.
+   *
+   * @param m pointer to the sparse matrix, overwritten with the (number of grid points) x
+   * (number of grid points) matrix
+   * @param grid the sparse grid
+   */
+  OperationMatrixLTwoDotExplicitPoly(sgpp::base::SparseDataMatrix* m, sgpp::base::Grid* grid);
+
   /**
    * Destructor
    */
@@ -50,11 +63,12 @@ class OperationMatrixLTwoDotExplicitPoly : public sgpp::base::OperationMatrix {
 
  private:
   /**
-   * This method is used by both constructors to build the matrix
+   * This method is used by all constructors to build the matrix
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
   sgpp::base::DataMatrix* m_;
+  sgpp::base::SparseDataMatrix* sparseM_;
   bool ownsMatrix_;
 };
 
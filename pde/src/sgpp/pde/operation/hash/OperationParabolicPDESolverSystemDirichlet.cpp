@@ -18,6 +18,13 @@ OperationParabolicPDESolverSystemDirichlet::OperationParabolicPDESolverSystemDir
 
 OperationParabolicPDESolverSystemDirichlet::~OperationParabolicPDESolverSystemDirichlet() {}
 
+void OperationParabolicPDESolverSystemDirichlet::resizeMultBuffers(size_t size) {
+  if (this->multMassResult.getSize() != size) {
+    this->multMassResult.resizeZero(size);
+    this->multLOperatorResult.resizeZero(size);
+  }
+}
+
 void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataVector& alpha,
                                                       sgpp::base::DataVector& result) {
   result.setAll(0.0);
@@ -27,47 +34,45 @@ void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataVector& al
   } else if (this->tOperationMode == "ImEul") {
     result.setAll(0.0);
 
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
+    this->resizeMultBuffers(result.getSize());
 
-#pragma omp parallel shared(alpha, result, temp, temp2)
+#pragma omp parallel shared(alpha)
     {
 #pragma omp single nowait
       {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
+#pragma omp task shared(alpha)
+        { applyMassMatrixInner(alpha, this->multMassResult); }
 
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
+#pragma omp task shared(alpha)
+        { applyLOperatorInner(alpha, this->multLOperatorResult); }
 
 #pragma omp taskwait
       }
     }
 
-    result.add(temp);
-    result.axpy((-1.0) * this->TimestepSize, temp2);
+    result.add(this->multMassResult);
+    result.axpy((-1.0) * this->TimestepSize, this->multLOperatorResult);
   } else if (this->tOperationMode == "CrNic") {
     result.setAll(0.0);
 
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
+    this->resizeMultBuffers(result.getSize());
 
-#pragma omp parallel shared(alpha, result, temp, temp2)
+#pragma omp parallel shared(alpha)
     {
 #pragma omp single nowait
       {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
+#pragma omp task shared(alpha)
+        { applyMassMatrixInner(alpha, this->multMassResult); }
 
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
+#pragma omp task shared(alpha)
+        { applyLOperatorInner(alpha, this->multLOperatorResult); }
 
 #pragma omp taskwait
       }
     }
 
-    result.add(temp);
-    result.axpy((-0.5) * this->TimestepSize, temp2);
+    result.add(this->multMassResult);
+    result.axpy((-0.5) * this->TimestepSize, this->multLOperatorResult);
   } else if (this->tOperationMode == "AdBas" || this->tOperationMode == "AdBasC") {
     result.setAll(0.0);
 
@@ -102,6 +107,72 @@ void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataVector& al
   }
 }
 
+void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataMatrix& alpha,
+                                                      sgpp::base::DataMatrix& result) {
+  if (this->tOperationMode == "ExEul") {
+    result.setAll(0.0);
+
+    applyMassMatrixInner(alpha, result);
+  } else if (this->tOperationMode == "ImEul" || this->tOperationMode == "CrNic") {
+    double factor = (-0.5) * this->TimestepSize;
+
+    if (this->tOperationMode == "ImEul") {
+      factor = (-1.0) * this->TimestepSize;
+    }
+
+    if ((this->multMassResults.getNrows() != alpha.getNrows()) ||
+        (this->multMassResults.getNcols() != alpha.getNcols())) {
+      this->multMassResults.resizeZero(alpha.getNrows(), alpha.getNcols());
+      this->multLOperatorResults.resizeZero(alpha.getNrows(), alpha.getNcols());
+    }
+
+#pragma omp parallel shared(alpha)
+    {
+#pragma omp single nowait
+      {
+#pragma omp task shared(alpha)
+        { applyMassMatrixInner(alpha, this->multMassResults); }
+
+#pragma omp task shared(alpha)
+        { applyLOperatorInner(alpha, this->multLOperatorResults); }
+
+#pragma omp taskwait
+      }
+    }
+
+    this->multLOperatorResults.mult(factor);
+    result.setAll(0.0);
+    result.add(this->multMassResults);
+    result.add(this->multLOperatorResults);
+  } else {
+    sgpp::base::OperationMatrix::mult(alpha, result);
+  }
+}
+
+void OperationParabolicPDESolverSystemDirichlet::applyMassMatrixInner(
+    sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  sgpp::base::DataVector alphaColumn(alpha.getNrows());
+  sgpp::base::DataVector resultColumn(alpha.getNrows());
+
+  for (size_t j = 0; j < alpha.getNcols(); j++) {
+    alpha.getColumn(j, alphaColumn);
+    applyMassMatrixInner(alphaColumn, resultColumn);
+    result.setColumn(j, resultColumn);
+  }
+}
+
+void OperationParabolicPDESolverSystemDirichlet::applyLOperatorInner(
+    sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  sgpp::base::DataVector alphaColumn(alpha.getNrows());
+  sgpp::base::DataVector resultColumn(alpha.getNrows());
+
+  for (size_t j = 0; j < alpha.getNcols(); j++) {
+    alpha.getColumn(j, alphaColumn);
+    applyLOperatorInner(alphaColumn, resultColumn);
+    result.setColumn(j, resultColumn);
+  }
+}
+
 sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHS() {
   sgpp::base::DataVector rhs_complete(this->alpha_complete->getSize());
 
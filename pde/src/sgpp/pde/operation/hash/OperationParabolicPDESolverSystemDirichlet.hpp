@@ -45,6 +45,21 @@ class OperationParabolicPDESolverSystemDirichlet
   sgpp::base::DirichletGridConverter* GridConverter;
   /// Pointer to the inner grid object
   sgpp::base::Grid* InnerGrid;
+  /// result of the mass matrix in mult, reused in all iterations and timesteps
+  sgpp::base::DataVector multMassResult;
+  /// result of the L-operator in mult, reused in all iterations and timesteps
+  sgpp::base::DataVector multLOperatorResult;
+  /// results of the mass matrix in mult for several columns, reused in all iterations
+  sgpp::base::DataMatrix multMassResults;
+  /// results of the L-operator in mult for several columns, reused in all iterations
+  sgpp::base::DataMatrix multLOperatorResults;
+
+  /**
+   * resizes the buffers used in mult if the number of inner grid points has changed
+   *
+   * @param size number of inner grid points
+   */
+  void resizeMultBuffers(size_t size);
 
   /**
    * applies the PDE's mass matrix, on complete grid - with boundaries
@@ -82,6 +97,26 @@ class OperationParabolicPDESolverSystemDirichlet
   virtual void applyLOperatorInner(sgpp::base::DataVector& alpha,
                                    sgpp::base::DataVector& result) = 0;
 
+  /**
+   * applies the PDE's mass matrix, on inner grid only, to all columns of alpha.
+   * The default implementation applies the vector version to one column after another.
+   *
+   * @param alpha the coefficients of the sparse grid's ansatzfunctions, one column per vector
+   * @param result reference to the sgpp::base::DataMatrix into which the result is written
+   */
+  virtual void applyMassMatrixInner(sgpp::base::DataMatrix& alpha,
+                                    sgpp::base::DataMatrix& result);
+
+  /**
+   * applies the PDE's system matrix, on inner grid only, to all columns of alpha.
+   * The default implementation applies the vector version to one column after another.
+   *
+   * @param alpha the coefficients of the sparse grid's ansatzfunctions, one column per vector
+   * @param result reference to the sgpp::base::DataMatrix into which the result is written
+   */
+  virtual void applyLOperatorInner(sgpp::base::DataMatrix& alpha,
+                                   sgpp::base::DataMatrix& result);
+
  public:
   /**
    * Constructor
@@ -102,6 +137,17 @@ class OperationParabolicPDESolverSystemDirichlet
    */
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Multiplicates the columns of a matrix with the system matrix. For ExEul, ImEul and CrNic
+   * the operators are applied to all columns at once, the other modes multiply one column
+   * after another.
+   *
+   * @param alpha sgpp::base::DataMatrix that contains the ansatzfunctions' coefficients,
+   * one column per vector
+   * @param result sgpp::base::DataMatrix into which the results are stored
+   */
+  virtual void mult(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result);
+
   /**
    * generates the right hand side of the system
    *
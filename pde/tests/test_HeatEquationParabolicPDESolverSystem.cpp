@@ -0,0 +1,150 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp_pde.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystemParallelOMP.hpp>
+#include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <omp.h>
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::pde::HeatEquationParabolicPDESolverSystem;
+using sgpp::pde::HeatEquationParabolicPDESolverSystemParallelOMP;
+
+BOOST_AUTO_TEST_SUITE(testHeatEquationParabolicPDESolverSystem)
+
+BOOST_AUTO_TEST_CASE(testParallelOMPSystem) {
+  const size_t d = 4;
+  const size_t l = 4;
+  const int maxThreads = omp_get_max_threads();
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(d));
+  grid->getGenerator().regular(l);
+  const size_t n = grid->getSize();
+
+  DataVector alpha(n);
+
+  for (size_t i = 0; i < n; i++) {
+    alpha[i] = std::sin(static_cast<double>(i));
+  }
+
+  for (const std::string mode : {"ExEul", "ImEul", "CrNic"}) {
+    DataVector alphaReference(alpha);
+    HeatEquationParabolicPDESolverSystem reference(*grid, alphaReference, 0.5, 0.01, mode);
+    DataVector rhsReference(*reference.generateRHS());
+    DataVector alphaInner(rhsReference.getSize());
+
+    for (size_t i = 0; i < alphaInner.getSize(); i++) {
+      alphaInner[i] = std::cos(static_cast<double>(i));
+    }
+
+    DataVector resultReference(alphaInner.getSize());
+    reference.mult(alphaInner, resultReference);
+
+    for (int threads : {1, 2, 3}) {
+      omp_set_num_threads(threads);
+      DataVector alphaParallel(alpha);
+      HeatEquationParabolicPDESolverSystemParallelOMP system(*grid, alphaParallel, 0.5, 0.01,
+                                                             mode);
+
+      // generate the right-hand side and apply the system matrix twice
+      // (the buffers are reused in the second run)
+      for (size_t repetition = 0; repetition < 2; repetition++) {
+        DataVector* rhs = system.generateRHS();
+        BOOST_REQUIRE_EQUAL(rhs->getSize(), rhsReference.getSize());
+
+        for (size_t i = 0; i < rhs->getSize(); i++) {
+          BOOST_CHECK_SMALL((*rhs)[i] - rhsReference[i], 1e-12);
+        }
+
+        DataVector result(alphaInner.getSize());
+        system.mult(alphaInner, result);
+
+        for (size_t i = 0; i < result.getSize(); i++) {
+          BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-12);
+        }
+
+        // the matrix version is not hidden by the vector version
+        DataMatrix alphaColumns(alphaInner.getSize(), 2);
+        DataMatrix results(alphaInner.getSize(), 2);
+        alphaColumns.setColumn(0, alphaInner);
+        alphaColumns.setColumn(1, alphaInner);
+        system.mult(alphaColumns, results);
+
+        for (size_t i = 0; i < results.getNrows(); i++) {
+          BOOST_CHECK_SMALL(results.get(i, 0) - resultReference[i], 1e-12);
+          BOOST_CHECK_SMALL(results.get(i, 1) - resultReference[i], 1e-12);
+        }
+      }
+    }
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
+BOOST_AUTO_TEST_CASE(testCrankNicolsonMultipleRHS) {
+  const size_t d = 3;
+  const size_t l = 4;
+  const size_t numRHS = 4;
+  const size_t numTimesteps = 5;
+  const double timestepSize = 0.01;
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(d));
+  grid->getGenerator().regular(l);
+  const size_t n = grid->getSize();
+
+  DataMatrix alphas(n, numRHS);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < numRHS; j++) {
+      alphas.set(i, j, std::sin(static_cast<double>(i * (j + 1))));
+    }
+  }
+
+  for (bool parallel : {false, true}) {
+    DataMatrix alphasMatrix(alphas);
+    DataVector alphaSystem(alphas.getNrows());
+    alphas.getColumn(0, alphaSystem);
+    std::unique_ptr<sgpp::pde::OperationParabolicPDESolverSystemDirichlet> system;
+
+    if (parallel) {
+      system.reset(new HeatEquationParabolicPDESolverSystemParallelOMP(*grid, alphaSystem, 0.5,
+                                                                       timestepSize, "CrNic"));
+    } else {
+      system.reset(new HeatEquationParabolicPDESolverSystem(*grid, alphaSystem, 0.5, timestepSize,
+                                                            "CrNic"));
+    }
+
+    sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+    sgpp::solver::CrankNicolson crankNicolson(numTimesteps, timestepSize);
+    crankNicolson.solve(cg, *system, alphasMatrix);
+
+    for (size_t j = 0; j < numRHS; j++) {
+      DataVector alphaReference(n);
+      alphas.getColumn(j, alphaReference);
+      HeatEquationParabolicPDESolverSystem reference(*grid, alphaReference, 0.5, timestepSize,
+                                                     "CrNic");
+      sgpp::solver::ConjugateGradients cgReference(1000, 1e-10);
+      sgpp::solver::CrankNicolson crankNicolsonReference(numTimesteps, timestepSize);
+      crankNicolsonReference.solve(cgReference, reference, false, false);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(alphasMatrix.get(i, j) - alphaReference[i], 1e-10);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -11,6 +11,12 @@
 #include <sgpp_pde.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <omp.h>
+
+#include <cmath>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
   /*
@@ -41,6 +47,232 @@ namespace pde {
     }
   }
 
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceExplicitLinear) {
+    const size_t d = 3;
+    const size_t l = 4;
+    sgpp::base::Grid* grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getGenerator().regular(l);
+    const size_t n = grid->getSize();
+
+    sgpp::base::DataMatrix dense(n, n);
+    sgpp::base::SparseDataMatrix sparse;
+    sgpp::base::OperationMatrix* opDense =
+      sgpp::op_factory::createOperationLaplaceExplicit(&dense, *grid);
+    sgpp::base::OperationMatrix* opSparse =
+      sgpp::op_factory::createOperationLaplaceExplicit(&sparse, *grid);
+    sgpp::base::OperationMatrix* opImplicit =
+      sgpp::op_factory::createOperationLaplace(*grid);
+
+    // compare all columns with the up/down implementation
+    sgpp::base::DataVector alpha(n);
+    sgpp::base::DataVector resultImplicit(n);
+    sgpp::base::DataVector resultSparse(n);
+
+    for (size_t j = 0; j < n; j++) {
+      alpha.setAll(0.0);
+      alpha[j] = 1.0;
+      opImplicit->mult(alpha, resultImplicit);
+      opSparse->mult(alpha, resultSparse);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(resultImplicit[i] - dense.get(i, j), 1e-10);
+        BOOST_CHECK_SMALL(resultImplicit[i] - resultSparse[i], 1e-10);
+      }
+    }
+
+    delete opDense;
+    delete opSparse;
+    delete opImplicit;
+    delete grid;
+  }
+
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceExplicitLinearBoundingBox) {
+    const size_t d = 3;
+    const size_t l = 4;
+    sgpp::base::Grid* grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getBoundingBox().setBoundary(0, sgpp::base::BoundingBox1D(-0.5, 2.0));
+    grid->getBoundingBox().setBoundary(2, sgpp::base::BoundingBox1D(1.0, 1.25));
+    grid->getGenerator().regular(l);
+    const size_t n = grid->getSize();
+
+    sgpp::base::DataMatrix dense(n, n);
+    sgpp::base::OperationMatrix* opDense =
+      sgpp::op_factory::createOperationLaplaceExplicit(&dense, *grid);
+    sgpp::base::OperationMatrix* opImplicit =
+      sgpp::op_factory::createOperationLaplace(*grid);
+
+    // compare all columns with the up/down implementation, which respects the bounding box
+    sgpp::base::DataVector alpha(n);
+    sgpp::base::DataVector resultImplicit(n);
+
+    for (size_t j = 0; j < n; j++) {
+      alpha.setAll(0.0);
+      alpha[j] = 1.0;
+      opImplicit->mult(alpha, resultImplicit);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(resultImplicit[i] - dense.get(i, j), 1e-10);
+      }
+    }
+
+    delete opDense;
+    delete opImplicit;
+    delete grid;
+  }
+
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceLinearParallelInDimensions) {
+    const size_t d = 4;
+    const size_t l = 5;
+    const int maxThreads = omp_get_max_threads();
+    sgpp::base::Grid* grid(sgpp::base::Grid::createLinearBoundaryGrid(d));
+    grid->getGenerator().regular(l);
+    const size_t n = grid->getSize();
+
+    sgpp::base::DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = static_cast<double>(i % 11) - 5.0;
+    }
+
+    // with and without coefficients (one dimension is skipped)
+    sgpp::base::DataVector coef(d, 1.5);
+    coef[2] = 0.0;
+    sgpp::base::OperationMatrix* ops[] = {sgpp::op_factory::createOperationLaplace(*grid),
+                                          sgpp::op_factory::createOperationLaplace(*grid, coef)};
+
+    for (sgpp::base::OperationMatrix* op : ops) {
+      UpDownOneOpDim* upDown = dynamic_cast<UpDownOneOpDim*>(op);
+      BOOST_REQUIRE(upDown != nullptr);
+
+      // reference: sum of the up/downs of the dimensions in the order of the dimensions
+      sgpp::base::DataVector reference(n, 0.0);
+      sgpp::base::DataVector dimensionResult(n);
+
+      for (size_t k = 0; k < d; k++) {
+        if ((op == ops[1]) && (coef[k] == 0.0)) continue;
+
+        upDown->multParallelBuildingBlock(alpha, dimensionResult, k);
+        reference.add(dimensionResult);
+      }
+
+      for (int threads : {1, 2, 3}) {
+        omp_set_num_threads(threads);
+
+        // apply twice to check that the buffers are reused correctly
+        for (size_t repetition = 0; repetition < 2; repetition++) {
+          sgpp::base::DataVector result(n, 1.0);
+          op->mult(alpha, result);
+
+          for (size_t i = 0; i < n; i++) {
+            BOOST_CHECK_EQUAL(result[i], reference[i]);
+          }
+        }
+      }
+
+      delete op;
+    }
+
+    omp_set_num_threads(maxThreads);
+    delete grid;
+  }
+
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceLinearConcurrentMult) {
+    const size_t d = 3;
+    const size_t l = 5;
+    const size_t numberOfCalls = 8;
+    sgpp::base::Grid* grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getGenerator().regular(l);
+    const size_t n = grid->getSize();
+    sgpp::base::OperationMatrix* op = sgpp::op_factory::createOperationLaplace(*grid);
+
+    // different coefficient vectors, applied concurrently to the same operation
+    std::vector<sgpp::base::DataVector> alphas(numberOfCalls, sgpp::base::DataVector(n));
+    std::vector<sgpp::base::DataVector> references(numberOfCalls, sgpp::base::DataVector(n));
+    std::vector<sgpp::base::DataVector> results(numberOfCalls, sgpp::base::DataVector(n));
+
+    for (size_t k = 0; k < numberOfCalls; k++) {
+      for (size_t i = 0; i < n; i++) {
+        alphas[k][i] = static_cast<double>((i + 3 * k) % 7) - 3.0;
+      }
+
+      op->mult(alphas[k], references[k]);
+    }
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (size_t k = 0; k < numberOfCalls; k++) {
+      for (size_t repetition = 0; repetition < 5; repetition++) {
+        op->mult(alphas[k], results[k]);
+      }
+    }
+
+    for (size_t k = 0; k < numberOfCalls; k++) {
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_EQUAL(results[k][i], references[k][i]);
+      }
+    }
+
+    delete op;
+    delete grid;
+  }
+
+  BOOST_AUTO_TEST_CASE(testOperationMultMatrix) {
+    const size_t d = 3;
+    const size_t l = 5;
+    const size_t numColumns = 5;
+
+    for (bool boundary : {false, true}) {
+      sgpp::base::Grid* grid(boundary ? sgpp::base::Grid::createLinearBoundaryGrid(d)
+                                      : sgpp::base::Grid::createLinearGrid(d));
+      grid->getGenerator().regular(l);
+      const size_t n = grid->getSize();
+
+      sgpp::base::DataMatrix alpha(n, numColumns);
+
+      for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < numColumns; j++) {
+          alpha.set(i, j, std::sin(static_cast<double>(i * numColumns + j)));
+        }
+      }
+
+      // with and without bounding box
+      for (bool boundingBox : {false, true}) {
+        if (boundingBox) {
+          grid->getBoundingBox().setBoundary(1, sgpp::base::BoundingBox1D(-0.5, 2.0));
+        }
+
+        sgpp::base::DataVector coef(d, 1.5);
+        coef[2] = 0.0;
+        sgpp::base::OperationMatrix* ops[] = {
+            sgpp::op_factory::createOperationLaplace(*grid),
+            sgpp::op_factory::createOperationLaplace(*grid, coef),
+            sgpp::op_factory::createOperationLTwoDotProduct(*grid)};
+
+        for (sgpp::base::OperationMatrix* op : ops) {
+          // all columns at once
+          sgpp::base::DataMatrix result(n, numColumns, 1.0);
+          op->mult(alpha, result);
+
+          // reference: one column after another
+          sgpp::base::DataVector alphaColumn(n);
+          sgpp::base::DataVector resultColumn(n);
+
+          for (size_t j = 0; j < numColumns; j++) {
+            alpha.getColumn(j, alphaColumn);
+            op->mult(alphaColumn, resultColumn);
+
+            for (size_t i = 0; i < n; i++) {
+              BOOST_CHECK_SMALL(result.get(i, j) - resultColumn[i], 1e-12);
+            }
+          }
+
+          delete op;
+        }
+      }
+
+      delete grid;
+    }
+  }
+
   BOOST_AUTO_TEST_CASE(testOperationLaplaceBsplineBoundary1D) {
     const size_t resolution = 10000;
     const size_t d = 1;
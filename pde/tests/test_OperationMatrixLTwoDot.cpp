@@ -8,8 +8,12 @@
 
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -502,6 +506,82 @@ BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitBsplineClenshawCurtis) {
   delete opExplicit;
 }
 
+// test the sparse assembly against the dense assembly on an adaptively refined grid
+BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitSparse) {
+  const size_t d = 3;
+  const size_t l = 3;
+  std::vector<sgpp::base::Grid*> grids = {
+      sgpp::base::Grid::createLinearGrid(d), sgpp::base::Grid::createModLinearGrid(d),
+      sgpp::base::Grid::createPolyGrid(d, 3), sgpp::base::Grid::createBsplineGrid(d, 3)};
+
+  for (sgpp::base::Grid* grid : grids) {
+    grid->getGenerator().regular(l);
+
+    // refine a few grid points to obtain overlapping supports across many levels
+    for (size_t r = 0; r < 2; r++) {
+      sgpp::base::DataVector surplus(grid->getSize());
+
+      for (size_t i = 0; i < grid->getSize(); i++) {
+        surplus[i] = static_cast<double>(i % 7) + 1.0;
+      }
+
+      sgpp::base::SurplusRefinementFunctor functor(surplus, 3);
+      grid->getGenerator().refine(functor);
+    }
+
+    const size_t n = grid->getSize();
+    sgpp::base::DataMatrix dense(n, n);
+    sgpp::base::SparseDataMatrix sparse;
+    sgpp::base::OperationMatrix* opDense =
+        sgpp::op_factory::createOperationLTwoDotExplicit(&dense, *grid);
+    sgpp::base::OperationMatrix* opSparse =
+        sgpp::op_factory::createOperationLTwoDotExplicit(&sparse, *grid);
+
+    BOOST_CHECK_EQUAL(sparse.getNrows(), n);
+    BOOST_CHECK_LT(sparse.getNnz(), n * n);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        BOOST_CHECK_EQUAL(sparse.get(i, j), dense.get(i, j));
+      }
+    }
+
+    // check the overlap detection against the quadrature of all pairs
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = i; j < n; j++) {
+        BOOST_CHECK_SMALL(uniform_distributed_approximation(*grid, i, j) - dense.get(i, j), 1e-3);
+      }
+    }
+
+    sgpp::base::DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = static_cast<double>(i % 5) - 2.0;
+    }
+
+    sgpp::base::DataVector resultDense(n);
+    sgpp::base::DataVector resultSparse(n);
+    opDense->mult(alpha, resultDense);
+    opSparse->mult(alpha, resultSparse);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(resultDense[i] - resultSparse[i], 1e-12);
+    }
+
+    delete opDense;
+    delete opSparse;
+    delete grid;
+  }
+
+  // grid types without support-overlap assembly are rejected
+  sgpp::base::Grid* grid(sgpp::base::Grid::createLinearBoundaryGrid(d));
+  grid->getGenerator().regular(l);
+  sgpp::base::SparseDataMatrix sparse;
+  BOOST_CHECK_THROW(sgpp::op_factory::createOperationLTwoDotExplicit(&sparse, *grid),
+                    sgpp::base::factory_exception);
+  delete grid;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
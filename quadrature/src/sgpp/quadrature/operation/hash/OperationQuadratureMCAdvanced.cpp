@@ -12,15 +12,27 @@
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/NaiveSampleGenerator.hpp>
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <memory>
+#include <numeric>
 #include <vector>
 
 namespace sgpp {
 namespace quadrature {
 
+namespace {
+
+// number of samples per block, the blocks are evaluated in parallel and
+// their partial sums are added up in a fixed order
+const size_t samplesPerBlock = 1024;
+
+}  // namespace
+
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(sgpp::base::Grid& grid,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
@@ -76,60 +88,119 @@ void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
   myGenerator = new sgpp::quadrature::HaltonSampleGenerator(dimensions);
 }
 
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithSobolSequences() {
+  if (myGenerator != NULL) {
+    delete myGenerator;
+  }
+
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions, false, seed);
+}
+
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithScrambledSobolSequences() {
+  if (myGenerator != NULL) {
+    delete myGenerator;
+  }
+
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions, true, seed);
+}
+
 double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha) {
   sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
-
   myGenerator->getSamples(dm);
 
-  sgpp::base::DataVector res = sgpp::base::DataVector(numberOfSamples);
-  sgpp::op_factory::createOperationMultipleEval(*grid, dm)->mult(alpha, res);
-  return res.sum() / static_cast<double>(numberOfSamples);
+  const size_t numberOfBlocks = getNumberOfBlocks();
+  std::vector<double> blockSums(numberOfBlocks, 0.0);
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t block = 0; block < numberOfBlocks; block++) {
+    const size_t begin = block * samplesPerBlock;
+    const size_t end = std::min(begin + samplesPerBlock, numberOfSamples);
+
+    sgpp::base::DataMatrix blockSamples(end - begin, dimensions);
+    std::copy(dm.getPointer() + begin * dimensions, dm.getPointer() + end * dimensions,
+              blockSamples.getPointer());
+
+    sgpp::base::DataVector res(end - begin);
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opMultipleEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, blockSamples));
+    opMultipleEval->mult(alpha, res);
+    blockSums[block] = res.sum();
+  }
+
+  // add up the partial sums in the order of the blocks
+  return std::accumulate(blockSums.begin(), blockSums.end(), 0.0) /
+         static_cast<double>(numberOfSamples);
 }
 
 double OperationQuadratureMCAdvanced::doQuadratureFunc(FUNC func, void* clientdata) {
-  // double* p = new double[dimensions];
-
   sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
   myGenerator->getSamples(dm);
 
-  // create number of paths (uniformly drawn from [0,1]^d)
-  double res = 0;
+  const int dim = static_cast<int>(dimensions);
+  const size_t numberOfBlocks = getNumberOfBlocks();
+  std::vector<double> blockSums(numberOfBlocks, 0.0);
 
-  for (size_t i = 0; i < numberOfSamples; i++) {
+#pragma omp parallel
+  {
     sgpp::base::DataVector dv(dimensions);
-    dm.getRow(i, dv);
-    res += func(*reinterpret_cast<int*>(&dimensions), dv.getPointer(), clientdata);
+
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numberOfBlocks; block++) {
+      const size_t begin = block * samplesPerBlock;
+      const size_t end = std::min(begin + samplesPerBlock, numberOfSamples);
+      double res = 0;
+
+      for (size_t i = begin; i < end; i++) {
+        dm.getRow(i, dv);
+        res += func(dim, dv.getPointer(), clientdata);
+      }
+
+      blockSums[block] = res;
+    }
   }
 
-  // delete p;
-  return res / static_cast<double>(numberOfSamples);
+  // add up the partial sums in the order of the blocks
+  return std::accumulate(blockSums.begin(), blockSums.end(), 0.0) /
+         static_cast<double>(numberOfSamples);
 }
 
 double OperationQuadratureMCAdvanced::doQuadratureL2Error(FUNC func, void* clientdata,
                                                           sgpp::base::DataVector& alpha) {
-  // create number of paths (uniformly drawn from [0,1]^d)
   sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
   myGenerator->getSamples(dm);
 
-  double x;
-  double* p = new double[dimensions];
+  const int dim = static_cast<int>(dimensions);
+  const size_t numberOfBlocks = getNumberOfBlocks();
+  std::vector<double> blockSums(numberOfBlocks, 0.0);
+
+#pragma omp parallel
+  {
+    sgpp::base::DataVector point(dimensions);
+    std::unique_ptr<sgpp::base::OperationEval> opEval(
+        sgpp::op_factory::createOperationEval(*grid));
 
-  sgpp::base::DataVector point(dimensions);
-  std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
-  double res = 0;
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numberOfBlocks; block++) {
+      const size_t begin = block * samplesPerBlock;
+      const size_t end = std::min(begin + samplesPerBlock, numberOfSamples);
+      double res = 0;
 
-  for (size_t i = 0; i < numberOfSamples; i++) {
-    for (size_t d = 0; d < dimensions; d++) {
-      x = dm.get(i, d);
-      p[d] = x;
-      point[d] = x;
+      for (size_t i = begin; i < end; i++) {
+        dm.getRow(i, point);
+        res += pow(func(dim, point.getPointer(), clientdata) - opEval->eval(alpha, point), 2);
+      }
+
+      blockSums[block] = res;
     }
-    res += pow(
-        func(*reinterpret_cast<int*>(&dimensions), p, clientdata) - opEval->eval(alpha, point), 2);
   }
 
-  delete[] p;
-  return sqrt(res / static_cast<double>(numberOfSamples));
+  // add up the partial sums in the order of the blocks
+  return sqrt(std::accumulate(blockSums.begin(), blockSums.end(), 0.0) /
+              static_cast<double>(numberOfSamples));
+}
+
+size_t OperationQuadratureMCAdvanced::getNumberOfBlocks() const {
+  return (numberOfSamples + samplesPerBlock - 1) / samplesPerBlock;
 }
 
 size_t OperationQuadratureMCAdvanced::getDimensions() { return dimensions; }
@@ -26,6 +26,10 @@ typedef double (*FUNC)(int, double*, void*);
 /**
  * Quadrature on any sparse grid (that has OperationMultipleEval implemented)
  * using various Monte Carlo Methods (Advanced).
+ *
+ * The samples are evaluated in parallel in blocks of fixed size. The partial sums
+ * of the blocks are added up in the order of the blocks, hence the results
+ * do not depend on the number of threads.
  */
 
 class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
@@ -67,6 +71,7 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
   /**
    * @brief Quadrature of an arbitrary function using
    * advanced MC in @f$\Omega=[0,1]^d@f$.
+   * The function is evaluated in parallel, hence it has to be thread-safe.
    *
    * @param func The function to integrate
    * @param clientdata Optional data to pass to FUNC
@@ -78,6 +83,7 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
    * @f$ ||f(x)-u(x)||_{L^2} @f$, between a given function and the
    * current sparse grid function using
    * advanced MC in @f$\Omega=[0,1]^d@f$.
+   * The function is evaluated in parallel, hence it has to be thread-safe.
    *
    * @param func The function @f$f(x)@f$
    * @param clientdata Optional data to pass to FUNC
@@ -126,6 +132,11 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
   size_t getDimensions();
 
  protected:
+  /**
+   * @return number of blocks of samples that are evaluated in parallel
+   */
+  size_t getNumberOfBlocks() const;
+
   // Pointer to the grid object
   sgpp::base::Grid* grid;
   // Number of MC samples
@@ -0,0 +1,249 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
+
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+namespace {
+
+// number of bits of the digits of the samples
+const size_t numberOfBits = 32;
+
+// number of consecutive samples generated by a thread in getSamples
+const size_t samplesPerBlock = 1024;
+
+/**
+ * Primitive polynomial (degree and coefficients) and initial direction numbers
+ * of one dimension, taken from the table new-joe-kuo-6.21201 of Joe and Kuo.
+ * The first dimension is the van der Corput sequence in base 2.
+ */
+struct SobolParameters {
+  std::uint32_t degree;
+  std::uint32_t coefficients;
+  std::uint32_t initialDirections[7];
+};
+
+const SobolParameters sobolParameters[] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}}};
+
+const size_t numberOfTabulatedDimensions = sizeof(sobolParameters) / sizeof(SobolParameters) + 1;
+
+std::uint32_t reverseBits(std::uint32_t x) {
+  x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+  x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+  x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+  x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+  return (x >> 16) | (x << 16);
+}
+
+/**
+ * Nested uniform scrambling of the digits (hash-based approximation by Laine and Karras,
+ * constants of Burley). After reversing the bits, every operation only mixes
+ * lower bits into higher bits, i.e., each digit is permuted depending on the leading digits.
+ */
+std::uint32_t scrambleDigits(std::uint32_t x, std::uint32_t seed) {
+  x = reverseBits(x);
+  x += seed;
+  x ^= x * 0x6c50b47cu;
+  x ^= x * 0xb82f1e52u;
+  x ^= x * 0xc7afe638u;
+  x ^= x * 0x8d22f6e6u;
+  return reverseBits(x);
+}
+
+/**
+ * @return position of the lowest zero bit of the index, i.e., the direction that changes
+ *         from the sample with this index to the next one (Gray code)
+ */
+size_t lowestZeroBit(std::uint64_t index) {
+  size_t bit = 0;
+
+  while ((index & 1) == 1) {
+    index >>= 1;
+    bit++;
+  }
+
+  return bit;
+}
+
+}  // namespace
+
+SobolSampleGenerator::SobolSampleGenerator(size_t dimensions, bool scrambled, std::uint64_t seed)
+    : SampleGenerator(dimensions, seed),
+      directions(dimensions * numberOfBits),
+      scramblingSeeds(dimensions, 0),
+      currentDigits(dimensions, 0),
+      index(0),
+      scrambled(scrambled) {
+  if (dimensions > numberOfTabulatedDimensions) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator: number of dimensions not supported");
+  }
+
+  // first dimension: van der Corput sequence
+  if (dimensions > 0) {
+    for (size_t k = 0; k < numberOfBits; k++) {
+      directions[k] = static_cast<std::uint32_t>(1) << (numberOfBits - 1 - k);
+    }
+  }
+
+  // remaining dimensions: recurrence given by the primitive polynomials
+  for (size_t d = 1; d < dimensions; d++) {
+    const SobolParameters& parameters = sobolParameters[d - 1];
+    const size_t s = parameters.degree;
+    std::uint32_t* v = &directions[d * numberOfBits];
+
+    for (size_t k = 0; k < s; k++) {
+      v[k] = parameters.initialDirections[k] << (numberOfBits - 1 - k);
+    }
+
+    for (size_t k = s; k < numberOfBits; k++) {
+      v[k] = v[k - s] ^ (v[k - s] >> s);
+
+      for (size_t l = 1; l < s; l++) {
+        if ((parameters.coefficients >> (s - 1 - l)) & 1) {
+          v[k] ^= v[k - l];
+        }
+      }
+    }
+  }
+
+  if (scrambled) {
+    std::uniform_int_distribution<std::uint32_t> distSeed;
+
+    for (size_t d = 0; d < dimensions; d++) {
+      scramblingSeeds[d] = distSeed(rng);
+    }
+  }
+}
+
+SobolSampleGenerator::~SobolSampleGenerator() {}
+
+void SobolSampleGenerator::getSample(sgpp::base::DataVector& sample) {
+  if (index >> numberOfBits) {
+    throw sgpp::base::application_exception("SobolSampleGenerator: sequence exhausted");
+  }
+
+  digitsToSample(currentDigits, sample.getPointer());
+
+  const size_t bit = lowestZeroBit(index);
+  index++;
+
+  if (bit < numberOfBits) {
+    for (size_t d = 0; d < dimensions; d++) {
+      currentDigits[d] ^= directions[d * numberOfBits + bit];
+    }
+  }
+}
+
+void SobolSampleGenerator::getSamples(sgpp::base::DataMatrix& samples) {
+  // Number of columns has to correspond to the number of dimensions
+  if (samples.getNcols() != dimensions) return;
+
+  const size_t numberOfSamples = samples.getNrows();
+
+  if (numberOfSamples == 0) return;
+
+  if ((index + numberOfSamples - 1) >> numberOfBits) {
+    throw sgpp::base::application_exception("SobolSampleGenerator: sequence exhausted");
+  }
+
+  const size_t numberOfBlocks = (numberOfSamples + samplesPerBlock - 1) / samplesPerBlock;
+  double* data = samples.getPointer();
+
+  // each block starts with a direct computation of its first sample
+#pragma omp parallel
+  {
+    std::vector<std::uint32_t> digits(dimensions);
+
+#pragma omp for schedule(static)
+    for (size_t block = 0; block < numberOfBlocks; block++) {
+      const size_t begin = block * samplesPerBlock;
+      const size_t end = std::min(begin + samplesPerBlock, numberOfSamples);
+      computeDigits(index + begin, digits);
+
+      for (size_t i = begin; i < end; i++) {
+        digitsToSample(digits, &data[i * dimensions]);
+        const size_t bit = lowestZeroBit(index + i);
+
+        if (bit < numberOfBits) {
+          for (size_t d = 0; d < dimensions; d++) {
+            digits[d] ^= directions[d * numberOfBits + bit];
+          }
+        }
+      }
+    }
+  }
+
+  skipTo(index + numberOfSamples);
+}
+
+void SobolSampleGenerator::skipTo(std::uint64_t index) {
+  this->index = index;
+  computeDigits(index, currentDigits);
+}
+
+std::uint64_t SobolSampleGenerator::getIndex() const { return index; }
+
+size_t SobolSampleGenerator::getMaxDimensions() { return numberOfTabulatedDimensions; }
+
+void SobolSampleGenerator::computeDigits(std::uint64_t index,
+                                         std::vector<std::uint32_t>& digits) const {
+  // the sample with index i is the sum of the directions of the bits of its Gray code
+  std::uint64_t grayCode = index ^ (index >> 1);
+
+  for (size_t d = 0; d < dimensions; d++) {
+    digits[d] = 0;
+  }
+
+  for (size_t k = 0; (k < numberOfBits) && (grayCode != 0); k++, grayCode >>= 1) {
+    if (grayCode & 1) {
+      for (size_t d = 0; d < dimensions; d++) {
+        digits[d] ^= directions[d * numberOfBits + k];
+      }
+    }
+  }
+}
+
+void SobolSampleGenerator::digitsToSample(const std::vector<std::uint32_t>& digits,
+                                          double* sample) const {
+  const double scaling = 1.0 / 4294967296.0;
+
+  for (size_t d = 0; d < dimensions; d++) {
+    const std::uint32_t x = scrambled ? scrambleDigits(digits[d], scramblingSeeds[d]) : digits[d];
+    sample[d] = static_cast<double>(x) * scaling;
+  }
+}
+
+}  // namespace quadrature
+}  // namespace sgpp
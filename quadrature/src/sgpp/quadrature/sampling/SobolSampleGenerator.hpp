@@ -0,0 +1,114 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SOBOLSAMPLEGENERATOR_HPP
+#define SOBOLSAMPLEGENERATOR_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/sampling/SampleGenerator.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * Sample generator for the Sobol sequence (direction numbers of Joe and Kuo),
+ * optionally with a nested uniform (Owen) scrambling of the digits.
+ *
+ * The i-th sample of the sequence can be computed directly from i, hence
+ * the generator can skip ahead to any position in constant time and
+ * getSamples generates blocks of samples in parallel.
+ * The scrambling is a hash-based permutation of the bits of each coordinate,
+ * where every bit only depends on the bits in front of it. It is determined
+ * by the seed alone, so the samples do not depend on the order of generation either.
+ * At most 2^32 samples can be generated.
+ */
+class SobolSampleGenerator : public SampleGenerator {
+ public:
+  /**
+   * Standard constructor
+   *
+   * @param dimensions number of dimensions used for sample generation
+   *        (at most getMaxDimensions())
+   * @param scrambled apply a nested uniform scrambling to the samples
+   * @param seed custom seed for the scrambling (defaults to default seed of mt19937_64)
+   */
+  explicit SobolSampleGenerator(size_t dimensions, bool scrambled = false,
+                                std::uint64_t seed = std::mt19937_64::default_seed);
+
+  /**
+   * Destructor
+   */
+  ~SobolSampleGenerator();
+
+  /**
+   * This method generates the next sample of the sequence.
+   *
+   * @param sample DataVector storing the new generated sample vector.
+   */
+  void getSample(sgpp::base::DataVector& sample) override;
+
+  /**
+   * This method generates the next samples of the sequence (one per row),
+   * blocks of samples are generated in parallel.
+   *
+   * @param samples DataMatrix to hold the generated samples
+   */
+  void getSamples(sgpp::base::DataMatrix& samples) override;
+
+  /**
+   * Sets the position of the generator in the sequence,
+   * the next generated sample will be the sample with the given index.
+   *
+   * @param index index of the next sample
+   */
+  void skipTo(std::uint64_t index);
+
+  /**
+   * @return index of the next sample
+   */
+  std::uint64_t getIndex() const;
+
+  /**
+   * @return maximal number of dimensions supported by the generator
+   */
+  static size_t getMaxDimensions();
+
+ private:
+  /**
+   * Computes the digits of the sample with the given index directly.
+   *
+   * @param index index of the sample
+   * @param digits vector of length dimensions storing the digits of the sample
+   */
+  void computeDigits(std::uint64_t index, std::vector<std::uint32_t>& digits) const;
+
+  /**
+   * Converts the digits of a sample to a point in the unit cube.
+   *
+   * @param digits digits of the sample
+   * @param sample pointer to the coordinates of the sample
+   */
+  void digitsToSample(const std::vector<std::uint32_t>& digits, double* sample) const;
+
+  // direction numbers, 32 per dimension
+  std::vector<std::uint32_t> directions;
+  // seeds of the scrambling per dimension
+  std::vector<std::uint32_t> scramblingSeeds;
+  // digits of the next sample (unscrambled)
+  std::vector<std::uint32_t> currentDigits;
+  // index of the next sample
+  std::uint64_t index;
+  bool scrambled;
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* SOBOLSAMPLEGENERATOR_HPP */
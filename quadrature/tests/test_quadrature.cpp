@@ -26,20 +26,26 @@ std::string normalize_test_case_name(const_string name) {
 #endif
 
 #include <sgpp_base.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
 #include <sgpp_quadrature.hpp>
 #include <sgpp/quadrature/QuadratureOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <omp.h>
+
+#include <algorithm>
 #include <vector>
 
+using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::quadrature::HaltonSampleGenerator;
 using sgpp::quadrature::LatinHypercubeSampleGenerator;
 using sgpp::quadrature::NaiveSampleGenerator;
 using sgpp::quadrature::SampleGenerator;
+using sgpp::quadrature::SobolSampleGenerator;
 using sgpp::quadrature::StratifiedSampleGenerator;
 
 double f(DataVector x) {
@@ -82,11 +88,95 @@ BOOST_AUTO_TEST_CASE(testSamplers) {
   }
 
   StratifiedSampleGenerator pSSampler(blockSize);
+  SobolSampleGenerator pSobolSampler(dim);
+  SobolSampleGenerator pScrambledSobolSampler(dim, true, seed);
 
   testSampler(pNSampler, dim, numSamples, analyticResult, 5e-2);
   testSampler(pHSampler, dim, numSamples, analyticResult, 1e-3);
   testSampler(pLHSampler, dim, numSamples, analyticResult, 1e-3);
   testSampler(pSSampler, dim, numSamples, analyticResult, 1e-3);
+  testSampler(pSobolSampler, dim, numSamples, analyticResult, 1e-3);
+  testSampler(pScrambledSobolSampler, dim, numSamples, analyticResult, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(testSobolSampler) {
+  const size_t dim = SobolSampleGenerator::getMaxDimensions();
+  const int maxThreads = omp_get_max_threads();
+
+  // first samples of the Sobol sequence in the first two dimensions
+  const double expected[8][2] = {{0.0, 0.0},     {0.5, 0.5},     {0.75, 0.25},   {0.25, 0.75},
+                                 {0.375, 0.375}, {0.875, 0.875}, {0.625, 0.125}, {0.125, 0.625}};
+  SobolSampleGenerator sobolSampler(2);
+  DataVector sample(2);
+
+  for (size_t i = 0; i < 8; i++) {
+    sobolSampler.getSample(sample);
+    BOOST_CHECK_EQUAL(sample[0], expected[i][0]);
+    BOOST_CHECK_EQUAL(sample[1], expected[i][1]);
+  }
+
+  for (bool scrambled : {false, true}) {
+    // reference: samples generated one by one
+    const size_t numSamples = 5000;
+    SobolSampleGenerator referenceSampler(dim, scrambled, 42);
+    DataMatrix reference(numSamples, dim);
+    sample.resize(dim);
+
+    for (size_t i = 0; i < numSamples; i++) {
+      referenceSampler.getSample(sample);
+      reference.setRow(i, sample);
+    }
+
+    // each of the first 2^m samples lies in a different interval of length 2^-m
+    for (size_t d = 0; d < dim; d++) {
+      std::vector<bool> occupied(4096, false);
+
+      for (size_t i = 0; i < 4096; i++) {
+        const double x = reference.get(i, d);
+        BOOST_REQUIRE(x >= 0.0 && x < 1.0);
+        const size_t interval = static_cast<size_t>(x * 4096.0);
+        BOOST_CHECK(!occupied[interval]);
+        occupied[interval] = true;
+      }
+    }
+
+    // skip ahead
+    SobolSampleGenerator skippingSampler(dim, scrambled, 42);
+    skippingSampler.skipTo(1234);
+    skippingSampler.getSample(sample);
+
+    for (size_t d = 0; d < dim; d++) {
+      BOOST_CHECK_EQUAL(sample[d], reference.get(1234, d));
+    }
+
+    // blocks of samples generated in parallel
+    for (int threads : {1, 2, 3}) {
+      omp_set_num_threads(threads);
+      SobolSampleGenerator blockSampler(dim, scrambled, 42);
+      DataMatrix samples(1000, dim);
+      blockSampler.getSample(sample);
+      blockSampler.getSamples(samples);
+      BOOST_CHECK_EQUAL(blockSampler.getIndex(), 1001);
+
+      for (size_t i = 0; i < 1000; i++) {
+        for (size_t d = 0; d < dim; d++) {
+          BOOST_CHECK_EQUAL(samples.get(i, d), reference.get(i + 1, d));
+        }
+      }
+
+      DataMatrix samplesLarge(numSamples - 1001, dim);
+      blockSampler.getSamples(samplesLarge);
+
+      for (size_t i = 0; i < numSamples - 1001; i++) {
+        for (size_t d = 0; d < dim; d++) {
+          BOOST_CHECK_EQUAL(samplesLarge.get(i, d), reference.get(i + 1001, d));
+        }
+      }
+    }
+  }
+
+  BOOST_CHECK_THROW(SobolSampleGenerator(dim + 1), sgpp::base::application_exception);
+  omp_set_num_threads(maxThreads);
 }
 
 void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
@@ -113,6 +203,14 @@ void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
       opQuad->useQuasiMonteCarloWithHaltonSequences();
       break;
 
+    case sgpp::quadrature::SamplerTypes::Sobol:
+      opQuad->useQuasiMonteCarloWithSobolSequences();
+      break;
+
+    case sgpp::quadrature::SamplerTypes::ScrambledSobol:
+      opQuad->useQuasiMonteCarloWithScrambledSobolSequences();
+      break;
+
     default:
       std::cout << "test_quadrature::testOperationQuadratureMCAdvanced : sampler type not available"
                 << std::endl;
@@ -155,4 +253,63 @@ BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
                                     dim, numSamples, blockSize, analyticResult, 1e-3, seed);
   testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Halton, dim,
                                     numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Sobol, dim,
+                                    numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::ScrambledSobol,
+                                    dim, numSamples, blockSize, analyticResult, 1e-3, seed);
+}
+
+double productFunction(int dim, double* x, void* clientdata) {
+  double res = 1.0;
+
+  for (int i = 0; i < dim; i++) {
+    res *= 4 * (1 - x[i]) * x[i];
+  }
+
+  return res;
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMCAdvancedReproducible) {
+  size_t dim = 3;
+  size_t numSamples = 10000;
+  double analyticResult = std::pow(2. / 3., dim);
+  const int maxThreads = omp_get_max_threads();
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i % 7) / 7.0;
+  }
+
+  std::vector<double> results;
+
+  for (int threads : {1, 2, 3}) {
+    omp_set_num_threads(threads);
+
+    for (bool scrambled : {false, true}) {
+      std::unique_ptr<sgpp::quadrature::OperationQuadratureMCAdvanced> opQuad(
+          sgpp::op_factory::createOperationQuadratureMCAdvanced(*grid, numSamples, 1234567));
+
+      if (scrambled) {
+        opQuad->useQuasiMonteCarloWithScrambledSobolSequences();
+      } else {
+        opQuad->useQuasiMonteCarloWithSobolSequences();
+      }
+
+      const double resFunc = opQuad->doQuadratureFunc(productFunction, nullptr);
+      BOOST_CHECK_CLOSE(resFunc, analyticResult, 1e-1);
+      results.push_back(resFunc);
+      results.push_back(opQuad->doQuadrature(alpha));
+      results.push_back(opQuad->doQuadratureL2Error(productFunction, nullptr, alpha));
+    }
+  }
+
+  // results have to be identical for all numbers of threads
+  for (size_t i = 6; i < results.size(); i++) {
+    BOOST_CHECK_EQUAL(results[i], results[i % 6]);
+  }
+
+  omp_set_num_threads(maxThreads);
 }
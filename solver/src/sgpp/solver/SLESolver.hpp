@@ -6,6 +6,7 @@
 #ifndef SLESOLVER_HPP
 #define SLESOLVER_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 
@@ -17,6 +18,8 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+
 namespace sgpp {
 namespace solver {
 
@@ -49,6 +52,42 @@ class SLESolver : public SGSolver {
   virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = DEFAULT_RES_THRESHOLD) = 0;
+
+  /**
+   * Solves the system for several right hand sides, which are stored in the columns of B
+   * (one row per grid point). The default implementation solves the systems one after another,
+   * afterwards the number of iterations and the residuum are the maximal ones of all columns.
+   *
+   * @param SystemMatrix reference to an sgpp::base::OperationMatrix Object that implements the
+   * matrix vector multiplication
+   * @param alpha the sparse grid's coefficients which have to be determined, one column per
+   * right hand side (same size as B)
+   * @param B the right hand sides of the systems of linear equations
+   * @param reuse identifies if the alphas, stored in alpha at calling time, should be reused
+   * @param verbose prints information during execution of the solver
+   * @param max_threshold additional abort criteria for solver, default value is 10^-9!
+   */
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& B, bool reuse = false, bool verbose = false,
+                     double max_threshold = DEFAULT_RES_THRESHOLD) {
+    sgpp::base::DataVector alphaColumn(alpha.getNrows());
+    sgpp::base::DataVector bColumn(B.getNrows());
+    size_t maxIterations = 0;
+    double maxResiduum = 0.0;
+
+    for (size_t j = 0; j < B.getNcols(); j++) {
+      alpha.getColumn(j, alphaColumn);
+      B.getColumn(j, bColumn);
+      solve(SystemMatrix, alphaColumn, bColumn, reuse, verbose, max_threshold);
+      alpha.setColumn(j, alphaColumn);
+
+      maxIterations = std::max(maxIterations, this->nIterations);
+      maxResiduum = std::max(maxResiduum, this->residuum);
+    }
+
+    this->nIterations = maxIterations;
+    this->residuum = maxResiduum;
+  }
 };
 
 }  // namespace solver
@@ -78,5 +78,55 @@ void CrankNicolson::solve(SLESolver& LinearSystemSolver,
   this->nIterations = allIter;
 }
 
+void CrankNicolson::solve(SLESolver& LinearSystemSolver,
+                          sgpp::solver::OperationParabolicPDESolverSystem& System,
+                          sgpp::base::DataMatrix& alphas, bool verbose) {
+  size_t allIter = 0;
+  sgpp::base::DataMatrix rhs;
+  sgpp::base::DataMatrix alphasCG;
+
+  for (size_t i = 0; i < this->nMaxIterations; i++) {
+    // generate right hand sides
+    System.generateRHSColumns(alphas, rhs);
+
+    // solve the systems of the current timestep
+    System.getGridCoefficientsForCGColumns(alphas, alphasCG);
+    LinearSystemSolver.solve(System, alphasCG, rhs, true, false, -1.0);
+    allIter += LinearSystemSolver.getNumberIterations();
+
+    if (verbose == true) {
+      if (myScreen == NULL) {
+        std::cout << "Final residuum (max.) " << LinearSystemSolver.getResiduum() << "; with "
+                  << LinearSystemSolver.getNumberIterations()
+                  << " Iterations (Total Iter.: " << allIter << ")" << std::endl;
+      }
+    }
+
+    if (myScreen != NULL) {
+      std::stringstream soutput;
+      soutput << "Final residuum (max.) " << LinearSystemSolver.getResiduum() << "; with "
+              << LinearSystemSolver.getNumberIterations() << " Iterations (Total Iter.: " << allIter
+              << ")";
+
+      if (i < this->nMaxIterations - 1) {
+        myScreen->update((size_t)((static_cast<double>(i + 1) * 100.0) /
+            static_cast<double>(this->nMaxIterations)),
+                         soutput.str());
+      } else {
+        myScreen->update(100, soutput.str());
+      }
+    }
+
+    System.finishTimestepColumns(alphasCG, alphas);
+  }
+
+  // write some empty lines to console
+  if (myScreen != NULL) {
+    myScreen->writeEmptyLines(2);
+  }
+
+  this->nIterations = allIter;
+}
+
 }  // namespace solver
 }  // namespace sgpp
@@ -7,6 +7,7 @@
 #define CRANKNICOLSON_HPP
 
 #include <sgpp/base/application/ScreenOutput.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/solver/ODESolver.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -45,6 +46,23 @@ class CrankNicolson : public ODESolver {
   virtual void solve(SLESolver& LinearSystemSolver,
                      sgpp::solver::OperationParabolicPDESolverSystem& System,
                      bool bIdentifyLastStep = false, bool verbose = false);
+
+  /**
+   * Executes the timesteps for several sets of coefficients on the same grid at once
+   * (e.g. several initial conditions), one per column of alphas.
+   * The systems of all columns are solved together in each timestep
+   * (SLESolver::solve for DataMatrix), hence the system matrix is applied to all
+   * columns at once. The grid is neither coarsened nor refined.
+   *
+   * @param LinearSystemSolver reference to the solver of the systems of linear equations
+   * @param System reference to the system of the PDE
+   * @param alphas coefficients of the complete grid, one column per set of coefficients;
+   * overwritten by the coefficients after the last timestep
+   * @param verbose enables verbose output
+   */
+  virtual void solve(SLESolver& LinearSystemSolver,
+                     sgpp::solver::OperationParabolicPDESolverSystem& System,
+                     sgpp::base::DataMatrix& alphas, bool verbose = false);
 };
 
 }  // namespace solver
@@ -26,6 +26,68 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystem::getGridCoefficients()
   return this->alpha_complete;
 }
 
+void OperationParabolicPDESolverSystem::generateRHSColumns(
+    sgpp::base::DataMatrix& alphasComplete, sgpp::base::DataMatrix& rhs) {
+  // the coefficients of the column temporarily replace alpha_complete
+  sgpp::base::DataVector* alphaCompleteSaved = this->alpha_complete;
+  sgpp::base::DataVector alphaColumn(alphasComplete.getNrows());
+  this->alpha_complete = &alphaColumn;
+
+  for (size_t j = 0; j < alphasComplete.getNcols(); j++) {
+    alphasComplete.getColumn(j, alphaColumn);
+    sgpp::base::DataVector* rhsColumn = this->generateRHS();
+
+    if ((rhs.getNrows() != rhsColumn->getSize()) ||
+        (rhs.getNcols() != alphasComplete.getNcols())) {
+      rhs.resize(rhsColumn->getSize(), alphasComplete.getNcols());
+    }
+
+    rhs.setColumn(j, *rhsColumn);
+  }
+
+  this->alpha_complete = alphaCompleteSaved;
+}
+
+void OperationParabolicPDESolverSystem::getGridCoefficientsForCGColumns(
+    sgpp::base::DataMatrix& alphasComplete, sgpp::base::DataMatrix& alphasCG) {
+  sgpp::base::DataVector* alphaCompleteSaved = this->alpha_complete;
+  sgpp::base::DataVector alphaColumn(alphasComplete.getNrows());
+  this->alpha_complete = &alphaColumn;
+
+  for (size_t j = 0; j < alphasComplete.getNcols(); j++) {
+    alphasComplete.getColumn(j, alphaColumn);
+    sgpp::base::DataVector* alphaCG = this->getGridCoefficientsForCG();
+
+    if ((alphasCG.getNrows() != alphaCG->getSize()) ||
+        (alphasCG.getNcols() != alphasComplete.getNcols())) {
+      alphasCG.resize(alphaCG->getSize(), alphasComplete.getNcols());
+    }
+
+    alphasCG.setColumn(j, *alphaCG);
+  }
+
+  this->alpha_complete = alphaCompleteSaved;
+}
+
+void OperationParabolicPDESolverSystem::finishTimestepColumns(
+    sgpp::base::DataMatrix& alphasCG, sgpp::base::DataMatrix& alphasComplete) {
+  sgpp::base::DataVector* alphaCompleteSaved = this->alpha_complete;
+  sgpp::base::DataVector alphaColumn(alphasComplete.getNrows());
+  this->alpha_complete = &alphaColumn;
+
+  for (size_t j = 0; j < alphasComplete.getNcols(); j++) {
+    alphasComplete.getColumn(j, alphaColumn);
+
+    // the solution of the column replaces the coefficients used in the CG method
+    alphasCG.getColumn(j, *this->getGridCoefficientsForCG());
+    this->finishTimestep();
+
+    alphasComplete.setColumn(j, alphaColumn);
+  }
+
+  this->alpha_complete = alphaCompleteSaved;
+}
+
 sgpp::base::Grid* OperationParabolicPDESolverSystem::getGrid() { return this->BoundGrid; }
 
 void OperationParabolicPDESolverSystem::setODESolver(std::string ode) {
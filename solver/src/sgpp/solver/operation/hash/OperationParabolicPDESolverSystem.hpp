@@ -8,6 +8,7 @@
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -126,6 +127,40 @@ class OperationParabolicPDESolverSystem : public sgpp::base::OperationMatrix {
    */
   sgpp::base::DataVector* getGridCoefficients();
 
+  /**
+   * generates the right hand sides of the system for several sets of coefficients of the
+   * complete grid (e.g. several initial conditions solved at once on the same grid).
+   * The default implementation calls generateRHS for one column after another.
+   *
+   * @param alphasComplete coefficients of the complete grid, one column per set of coefficients
+   * @param rhs matrix into which the right hand sides are stored, one column per set of
+   * coefficients (resized if needed)
+   */
+  virtual void generateRHSColumns(sgpp::base::DataMatrix& alphasComplete,
+                                  sgpp::base::DataMatrix& rhs);
+
+  /**
+   * gets the coefficients used in the CG method for several sets of coefficients
+   * of the complete grid, one column per set (see getGridCoefficientsForCG).
+   *
+   * @param alphasComplete coefficients of the complete grid, one column per set of coefficients
+   * @param alphasCG matrix into which the coefficients for the CG method are stored
+   * (resized if needed)
+   */
+  virtual void getGridCoefficientsForCGColumns(sgpp::base::DataMatrix& alphasComplete,
+                                               sgpp::base::DataMatrix& alphasCG);
+
+  /**
+   * performs finishTimestep for several sets of coefficients, i.e. the solutions of the CG
+   * method are written back to the coefficients of the complete grid.
+   * The default implementation calls finishTimestep for one column after another.
+   *
+   * @param alphasCG solutions of the CG method, one column per set of coefficients
+   * @param alphasComplete coefficients of the complete grid, one column per set of coefficients
+   */
+  virtual void finishTimestepColumns(sgpp::base::DataMatrix& alphasCG,
+                                     sgpp::base::DataMatrix& alphasComplete);
+
   /**
    * defines the used ODE Solver for this instance, this is important because
    * the implementation of mult and generateRHS depends on the used
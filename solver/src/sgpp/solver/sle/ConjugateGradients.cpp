@@ -10,11 +10,36 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cstdio>
+#include <vector>
 
 namespace sgpp {
 namespace solver {
 
+namespace {
+
+/**
+ * Computes the dot products of corresponding columns of x and y
+ * (summed up in the order of the rows, as DataVector::dotProduct does).
+ */
+void columnDotProducts(const sgpp::base::DataMatrix& x, const sgpp::base::DataMatrix& y,
+                       std::vector<double>& result) {
+  const size_t ncols = x.getNcols();
+  const double* xData = x.getPointer();
+  const double* yData = y.getPointer();
+
+  std::fill(result.begin(), result.end(), 0.0);
+
+  for (size_t i = 0; i < x.getNrows(); i++) {
+    for (size_t j = 0; j < ncols; j++) {
+      result[j] += xData[i * ncols + j] * yData[i * ncols + j];
+    }
+  }
+}
+
+}  // namespace
+
 ConjugateGradients::ConjugateGradients(size_t imax, double epsilon) : SLESolver(imax, epsilon) {}
 
 ConjugateGradients::~ConjugateGradients() {}
@@ -33,10 +58,14 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
   // number off current iterations
   this->nIterations = 0;
 
-  // define temporal vectors
-  sgpp::base::DataVector temp(alpha.getSize());
-  sgpp::base::DataVector q(alpha.getSize());
-  sgpp::base::DataVector r(b);
+  // define temporal vectors (reused in subsequent calls)
+  sgpp::base::DataVector& temp = workspace.getVector(0, alpha.getSize());
+  sgpp::base::DataVector& q = workspace.getVector(1, alpha.getSize());
+  sgpp::base::DataVector& r = workspace.getVector(2, b.getSize());
+  sgpp::base::DataVector& d = workspace.getVector(3, b.getSize());
+  temp.setAll(0.0);
+  q.setAll(0.0);
+  r.copyFrom(b);
 
   double delta_0 = 0.0;
   double delta_old = 0.0;
@@ -63,7 +92,7 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
 
   r.sub(temp);
 
-  sgpp::base::DataVector d(r);
+  d.copyFrom(r);
 
   delta_old = 0.0;
   delta_new = r.dotProduct(r);
@@ -150,6 +179,191 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
   }
 }
 
+void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                               sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& B,
+                               bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  const size_t nrows = B.getNrows();
+  const size_t ncols = B.getNcols();
+
+  if (verbose == true) {
+    std::cout << "Starting Conjugated Gradients for " << ncols << " right hand sides"
+              << std::endl;
+  }
+
+  // needed for residuum calculation
+  double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // number off current iterations
+  this->nIterations = 0;
+
+  // temporal matrices, one column per right hand side
+  sgpp::base::DataMatrix temp(nrows, ncols);
+  sgpp::base::DataMatrix q(nrows, ncols);
+  sgpp::base::DataMatrix r(B);
+  sgpp::base::DataMatrix d(nrows, ncols);
+
+  // deltas and step sizes of the columns, columns which have converged are inactive
+  std::vector<double> delta_0(ncols, 0.0);
+  std::vector<double> delta_new(ncols, 0.0);
+  std::vector<double> delta(ncols, 0.0);
+  std::vector<double> a(ncols, 0.0);
+  std::vector<double> beta(ncols, 0.0);
+  std::vector<bool> active(ncols, true);
+
+  if (reuse == true) {
+    // r = b - A*0
+    columnDotProducts(r, r, delta_0);
+
+    for (size_t j = 0; j < ncols; j++) {
+      delta_0[j] *= epsilonSquared;
+    }
+  } else {
+    alpha.setAll(0.0);
+  }
+
+  // calculate the starting residuum
+  SystemMatrix.mult(alpha, temp);
+
+  r.sub(temp);
+
+  d = r;
+
+  columnDotProducts(r, r, delta_new);
+
+  double maxDelta_0 = 0.0;
+  size_t numActive = 0;
+
+  for (size_t j = 0; j < ncols; j++) {
+    if (reuse == false) {
+      delta_0[j] = delta_new[j] * epsilonSquared;
+    }
+
+    maxDelta_0 = std::max(maxDelta_0, delta_0[j]);
+    active[j] = (delta_new[j] > delta_0[j]) && (delta_new[j] > max_threshold);
+
+    if (active[j]) numActive++;
+  }
+
+  this->residuum = (maxDelta_0 / epsilonSquared);
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum (max.): " << (maxDelta_0 / epsilonSquared)
+              << std::endl;
+  }
+
+  double* alphaData = alpha.getPointer();
+  double* bData = B.getPointer();
+  double* tempData = temp.getPointer();
+  double* qData = q.getPointer();
+  double* rData = r.getPointer();
+  double* dData = d.getPointer();
+
+  while ((this->nIterations < this->nMaxIterations) && (numActive > 0)) {
+    // q = A*d for all columns
+    SystemMatrix.mult(d, q);
+
+    columnDotProducts(d, q, delta);
+
+    for (size_t j = 0; j < ncols; j++) {
+      if (!active[j]) continue;
+
+      if (delta[j] == 0.0) {
+        active[j] = false;
+        numActive--;
+        continue;
+      }
+
+      // a = d_new / d.q
+      a[j] = delta_new[j] / delta[j];
+    }
+
+    // x = x + a*d
+    for (size_t i = 0; i < nrows; i++) {
+      for (size_t j = 0; j < ncols; j++) {
+        if (active[j]) alphaData[i * ncols + j] += a[j] * dData[i * ncols + j];
+      }
+    }
+
+    if ((this->nIterations % 50) == 0 && this->nIterations > 0) {
+      // r = b - A*x
+      SystemMatrix.mult(alpha, temp);
+
+      for (size_t i = 0; i < nrows; i++) {
+        for (size_t j = 0; j < ncols; j++) {
+          if (active[j]) rData[i * ncols + j] = bData[i * ncols + j] - tempData[i * ncols + j];
+        }
+      }
+    } else {
+      // r = r - a*q
+      for (size_t i = 0; i < nrows; i++) {
+        for (size_t j = 0; j < ncols; j++) {
+          if (active[j]) rData[i * ncols + j] += (-a[j]) * qData[i * ncols + j];
+        }
+      }
+    }
+
+    // calculate new deltas and determine beta (d_new / d_old)
+    columnDotProducts(r, r, delta);
+
+#ifdef X86_MIC_SYMMETRIC
+    MPI_Bcast(delta.data(), static_cast<int>(ncols), MPI_DOUBLE, 0, MPI_COMM_WORLD);
+#endif
+
+    double maxDelta = 0.0;
+
+    for (size_t j = 0; j < ncols; j++) {
+      if (active[j]) {
+        beta[j] = delta[j] / delta_new[j];
+        delta_new[j] = delta[j];
+      }
+
+      maxDelta = std::max(maxDelta, delta_new[j]);
+    }
+
+    this->residuum = maxDelta;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta (max.): " << maxDelta << std::endl;
+    }
+
+    // d = beta*d + r
+    for (size_t i = 0; i < nrows; i++) {
+      for (size_t j = 0; j < ncols; j++) {
+        if (active[j]) {
+          dData[i * ncols + j] = dData[i * ncols + j] * beta[j] + rData[i * ncols + j];
+        }
+      }
+    }
+
+    for (size_t j = 0; j < ncols; j++) {
+      if (active[j] && ((delta_new[j] <= delta_0[j]) || (delta_new[j] <= max_threshold))) {
+        active[j] = false;
+        numActive--;
+      }
+    }
+
+    this->nIterations++;
+  }
+
+  double maxDelta = 0.0;
+
+  for (size_t j = 0; j < ncols; j++) {
+    maxDelta = std::max(maxDelta, delta_new[j]);
+  }
+
+  this->residuum = maxDelta;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum (max.): " << maxDelta << std::endl;
+  }
+}
+
 void ConjugateGradients::starting() {}
 
 void ConjugateGradients::calcStarting() {}
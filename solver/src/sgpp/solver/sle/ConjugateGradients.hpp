@@ -7,7 +7,9 @@
 #define CONJUGATEGRADIENTS_HPP
 
 #include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/ScratchWorkspace.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -32,6 +34,28 @@ class ConjugateGradients : public SLESolver {
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = -1.0);
 
+  /**
+   * Solves the system for several right hand sides (the columns of B) simultaneously.
+   * Every column runs the same CG recurrence as the single right hand side version,
+   * but the system matrix is applied to the search directions of all columns at once
+   * (sgpp::base::OperationMatrix::mult(DataMatrix&, DataMatrix&)), such that operators
+   * traversing the grid only once for all columns can be used. Columns which have converged
+   * are not updated anymore; the iteration stops when all columns have converged.
+   * The residuum is the maximal one of all columns.
+   *
+   * @param SystemMatrix reference to an sgpp::base::OperationMatrix Object that implements the
+   * matrix vector multiplication
+   * @param alpha the sparse grid's coefficients which have to be determined, one column per
+   * right hand side (same size as B)
+   * @param B the right hand sides of the systems of linear equations
+   * @param reuse identifies if the alphas, stored in alpha at calling time, should be reused
+   * @param verbose prints information during execution of the solver
+   * @param max_threshold additional abort criteria for solver
+   */
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& B, bool reuse = false, bool verbose = false,
+                     double max_threshold = -1.0);
+
   // Define functions for observer pattern in python
 
   /**
@@ -54,6 +78,10 @@ class ConjugateGradients : public SLESolver {
    * function that signals the finish of the cg method (used in python)
    */
   virtual void complete();
+
+ protected:
+  /// temporary vectors of solve, kept between subsequent calls
+  sgpp::base::ScratchWorkspace workspace;
 };
 
 }  // namespace solver
@@ -0,0 +1,103 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Dense symmetric positive definite matrix (diagonally dominant),
+ * which only implements the matrix-vector product.
+ */
+class DenseSPDMatrix : public sgpp::base::OperationMatrix {
+ public:
+  explicit DenseSPDMatrix(size_t n) : A(n, n) {
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        A.set(i, j, (i == j) ? static_cast<double>(n) : 1.0 / static_cast<double>(1 + i + j));
+      }
+    }
+  }
+
+  void mult(DataVector& alpha, DataVector& result) override { A.mult(alpha, result); }
+
+  using sgpp::base::OperationMatrix::mult;
+
+ private:
+  DataMatrix A;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testSolveMultipleRHS) {
+  const size_t n = 40;
+  const size_t numRHS = 6;
+  DenseSPDMatrix A(n);
+
+  DataMatrix B(n, numRHS);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < numRHS; j++) {
+      // the last right hand side is zero
+      B.set(i, j, (j == numRHS - 1) ? 0.0 : std::sin(static_cast<double>(i * (j + 1))));
+    }
+  }
+
+  for (bool reuse : {false, true}) {
+    DataMatrix alpha(n, numRHS, 0.0);
+    sgpp::solver::ConjugateGradients cg(100, 1e-10);
+    cg.solve(A, alpha, B, reuse, false);
+
+    DataMatrix alphaBiCGStab(n, numRHS, 0.0);
+    sgpp::solver::BiCGStab biCGStab(100, 1e-10);
+    sgpp::solver::SLESolver& solver = biCGStab;
+    solver.solve(A, alphaBiCGStab, B, reuse, false);
+
+    size_t maxIterations = 0;
+
+    for (size_t j = 0; j < numRHS; j++) {
+      DataVector b(n);
+      DataVector alphaColumn(n, 0.0);
+      B.getColumn(j, b);
+      sgpp::solver::ConjugateGradients cgColumn(100, 1e-10);
+      cgColumn.solve(A, alphaColumn, b, reuse, false);
+      maxIterations = std::max(maxIterations, cgColumn.getNumberIterations());
+
+      // residual of the multiple right hand side solution
+      DataVector x(n);
+      DataVector Ax(n);
+      alpha.getColumn(j, x);
+      A.mult(x, Ax);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(x[i] - alphaColumn[i], 1e-12);
+        BOOST_CHECK_SMALL(Ax[i] - b[i], 1e-8);
+        BOOST_CHECK_SMALL(alphaBiCGStab.get(i, j) - alphaColumn[i], 1e-8);
+      }
+    }
+
+    BOOST_CHECK_EQUAL(cg.getNumberIterations(), maxIterations);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()